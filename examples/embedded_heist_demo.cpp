@@ -73,4 +73,20 @@ int main() {
     (display "\nAdios!\n")
 
   )"_heist;
+
+
+  // Independent interpreters each have their own global environment
+  heist::interpreter sandbox;
+  sandbox.eval("(define factorial-of-5 'sandboxed)");
+  std::cout << "Sandboxed factorial-of-5 = " << sandbox.eval("factorial-of-5") << '\n';
+  std::cout << "Default factorial-of-5 = " << heist::eval("factorial-of-5") << '\n';
+
+
+  // Serve jobs across a pool of threads, each owning its own interpreter
+  //   (Heist data can't leave its thread, hence we return the written result)
+  heist::interpreter_pool pool(2);
+  auto squares = pool.submit([](heist::interpreter& worker){
+    return worker.eval("(map (lambda (n) (* n n)) '(1 2 3))").write();
+  });
+  std::cout << "Squared by a pooled interpreter: " << squares.get() << '\n';
 }
\ No newline at end of file
@@ -404,7 +404,15 @@ int interpret_premade_AST_code(){
   //    in case such needs to be shown in the error message upon an evaluation error.
   for(const auto& input : HEIST_PRECOMPILED_READ_AST_EXPS) {
     try {
+#ifdef HEIST_INTERPRETING_COMPILED_CPS_AST
+      // Apply the CPS-converted AST to <id> (as per <((scm->cps <exp> ...) id)>)
+      heist::execute_application(
+        heist::scm_analyze(heist::data(input),false,true)(heist::G.GLOBAL_ENVIRONMENT_POINTER), // (*)HERE(*)
+        heist::data_vector(1,heist::fcn_type("id",heist::DEFAULT_TOPMOST_CONTINUATION::id)),
+        heist::G.GLOBAL_ENVIRONMENT_POINTER,false,false);
+#else
       heist::scm_eval(heist::data(input),heist::G.GLOBAL_ENVIRONMENT_POINTER); // (*)HERE(*)
+#endif
     } catch(const heist::SCM_EXCEPT& eval_throw) {
       if(eval_throw == heist::SCM_EXCEPT::EXIT) return heist::GLOBALS::HEIST_EXIT_CODE;
       if(eval_throw == heist::SCM_EXCEPT::JUMP) {
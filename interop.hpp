@@ -1,24 +1,160 @@
 // Author: Jordan Randleman -- jordanran199@gmail.com -- interop.hpp
 // => Wrapper around the Heist Scheme Interpreter to set up C++17 interop
 
-/**************************************************
- * DESIGNED FOR ___SINGLE-THREADED___ APPLICATIONS
- *************************************************/
-
 #ifndef HEIST_SCHEME_CORE_CPP_INTEROP_HPP_
 #define HEIST_SCHEME_CORE_CPP_INTEROP_HPP_
 
-// Defines 3 Functions for C++ Interop w/ Heist:
-//   0) eval   // evaluate heist code string, same as _heist literal (see below)
+// Defines the "heist::interpreter" Class for C++ Interop w/ Heist:
+//   0) eval   // evaluate heist code string
 //   1) apply  // apply args to Heist callable (procedure or functor)
 //   2) define // define C++ Heist primitive _OR_ a global Heist variable
+//   3) reset  // discard all definitions (restoring Heist's default bindings)
+//
+// Each interpreter owns its own global environment, process invariants, & stack
+//   trace. Heist's GC & reference counts are per-thread, hence interpreters (& 
+//   the data they return) are confined to the thread that created them:
+//   "heist::interpreter_pool" serves jobs across threads each owning an interpreter.
+//
+// The free functions "heist::eval", "heist::apply", & "heist::define" use the
+//   calling thread's default interpreter, as does the "_heist" literal (see below).
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
 
 #include "heist.cpp"
 
+/******************************************************************************
+* EMBEDDED INTERPRETER
+******************************************************************************/
+
 namespace heist {
+  class interpreter {
+  public:
+    // Layers a fresh global environment atop the thread's booted snapshot (see "new-universe")
+    interpreter()noexcept : owner(std::this_thread::get_id()) {reset();}
+    interpreter(const interpreter&) = delete;
+    interpreter& operator=(const interpreter&) = delete;
+
+    // The calling thread's default interpreter (used by the free functions below)
+    static interpreter& thread_default()noexcept;
+
+    data eval(std::string exp)noexcept;
+    data apply(data& heist_procedure, data_vector args)noexcept;
+    data apply(const std::string& heist_procedure_name, data_vector args)noexcept;
+    void define(const std::string& heist_primitive_name, prm_ptr_t cpp_function, bool append_env_to_args=false)noexcept;
+    void define(const std::string& heist_variable_name, const data& variable_value)noexcept;
+    void reset()noexcept;
+
+  private:
+    struct default_instance_tag {};
+    struct activation;
+
+    process_invariants_t invariants; // held in <G> while active
+    str_vector stack_trace;          // held in <GLOBALS::STACK_TRACE> while active
+    std::thread::id owner;
+    bool is_thread_default = false;
+
+    // The thread's default interpreter's state starts out in <G>, & is booted lazily
+    explicit interpreter(default_instance_tag)noexcept
+      : owner(std::this_thread::get_id()), is_thread_default(true) {}
+
+    // The interpreter whose state is in <G> (nullptr denotes the thread's default)
+    static interpreter*& active()noexcept{
+      static thread_local interpreter* active_interpreter = nullptr;
+      return active_interpreter;
+    }
+
+    static interpreter* current()noexcept{return active() ? active() : &thread_default();}
+
+    void store_state()noexcept{
+      invariants = std::move(G);
+      stack_trace = std::move(GLOBALS::STACK_TRACE);
+      GLOBALS::STACK_TRACE.clear();
+    }
+
+    void load_state()noexcept{
+      G = std::move(invariants);
+      GLOBALS::STACK_TRACE = std::move(stack_trace);
+      stack_trace.clear();
+    }
+
+    bool confirm_owner_thread()const noexcept{
+      if(owner == std::this_thread::get_id()) return true;
+      HEIST_PRINT_ERR("heist::interpreter used outside of the thread that created it!");
+      return false;
+    }
+
+    static data handle_uncaught_throw(const SCM_EXCEPT& eval_throw)noexcept{
+      if(eval_throw == heist::SCM_EXCEPT::JUMP) {
+        HEIST_PRINT_ERR("Uncaught JUMP procedure! JUMPed value: " 
+          << HEIST_PROFILE(heist::GLOBALS::JUMP_GLOBAL_PRIMITIVE_ARGUMENT));
+      } else if(eval_throw == heist::SCM_EXCEPT::EXIT) {
+        if(heist::GLOBALS::HEIST_EXIT_CODE)
+          return data(heist::symconst::exit_failure);
+        return data(heist::symconst::exit_success);
+      }
+      return data();
+    }
+  };
+
+
+  // Swaps the interpreter's state into <G> for the duration of a call
+  //   (no-op if already active, thus C++ primitives may re-enter it)
+  struct interpreter::activation {
+    interpreter& self;
+    interpreter* previous;
+    explicit activation(interpreter& in)noexcept : self(in), previous(current()) {
+      if(previous != &self) {
+        previous->store_state();
+        self.load_state();
+        active() = &self;
+      }
+      if(!G.GLOBAL_ENVIRONMENT_POINTER) set_default_global_environment();
+    }
+    ~activation()noexcept{
+      if(previous == &self) return;
+      self.store_state();
+      previous->load_state();
+      active() = previous;
+    }
+  };
+
+
+  interpreter& interpreter::thread_default()noexcept{
+    static thread_local interpreter instance{default_instance_tag()};
+    return instance;
+  }
+
+  /******************************************************************************
+  * INTERPRETER RESET
+  ******************************************************************************/
+
+  void interpreter::reset()noexcept{
+    if(!confirm_owner_thread()) return;
+    auto fresh = stdlib_sysinterface::reset_process_invariant_state(); // <G> is now fresh
+    std::swap(fresh,G);
+    if(current() == this) {
+      G = std::move(fresh);
+      GLOBALS::STACK_TRACE.clear();
+    } else {
+      invariants = std::move(fresh);
+      stack_trace.clear();
+    }
+  }
+
+  /******************************************************************************
+  * INTERPRETER EVALUATION
+  ******************************************************************************/
+
   // Evaluate Heist Scheme Expression in String
-  data eval(std::string exp) noexcept {
-    if(!G.GLOBAL_ENVIRONMENT_POINTER) set_default_global_environment(); 
+  data interpreter::eval(std::string exp)noexcept{
+    if(!confirm_owner_thread()) return data();
+    activation scope(*this);
     data_vector abstract_syntax_tree;
     try {
       // Evaluate AST if successfully parsed an expression
@@ -31,16 +167,9 @@ namespace heist {
             return scm_eval(data(abstract_syntax_tree[i]),G.GLOBAL_ENVIRONMENT_POINTER); // (*)HERE(*)
           scm_eval(data(abstract_syntax_tree[i]),G.GLOBAL_ENVIRONMENT_POINTER);          // (*)HERE(*)
         } catch(const SCM_EXCEPT& eval_throw) {
-          if(eval_throw == heist::SCM_EXCEPT::JUMP) {
-            HEIST_PRINT_ERR("Uncaught JUMP procedure! JUMPed value: " 
-              << HEIST_PROFILE(heist::GLOBALS::JUMP_GLOBAL_PRIMITIVE_ARGUMENT));
-          } else if(eval_throw == heist::SCM_EXCEPT::EXIT) {
-            if(heist::GLOBALS::HEIST_EXIT_CODE)
-              return data(heist::symconst::exit_failure);
-            return data(heist::symconst::exit_success);
-          }
-          fputs("\n",stderr);
-          return data();
+          auto result = handle_uncaught_throw(eval_throw);
+          if(eval_throw != heist::SCM_EXCEPT::EXIT) fputs("\n",stderr);
+          return result;
         } catch(...) {
           HEIST_PRINT_ERR("Uncaught C++ Exception Detected! -:- BUG ALERT -:-"
                "\n     Triggered By: " << abstract_syntax_tree[i].noexcept_write() << 
@@ -64,12 +193,16 @@ namespace heist {
     return data();
   }
 
+  /******************************************************************************
+  * INTERPRETER DEFINITIONS
+  ******************************************************************************/
 
   // Define C++ Primitive for Heist Scheme
   //  => NOTE: "append_env_to_args" is used by higher-order procedures to apply
   //           heist procedures received as arguments
-  void define(const std::string& heist_primitive_name, prm_ptr_t cpp_function, bool append_env_to_args=false) noexcept {
-    if(!G.GLOBAL_ENVIRONMENT_POINTER) set_default_global_environment();
+  void interpreter::define(const std::string& heist_primitive_name, prm_ptr_t cpp_function, bool append_env_to_args)noexcept{
+    if(!confirm_owner_thread()) return;
+    activation scope(*this);
     G.GLOBAL_ENVIRONMENT_POINTER->define_variable(heist_primitive_name, fcn_type(heist_primitive_name,cpp_function));
     if(append_env_to_args)
       GLOBALS::USER_DEFINED_PRIMITIVES_REQUIRING_ENV.push_back(cpp_function);
@@ -77,15 +210,20 @@ namespace heist {
 
 
   // Define Heist Scheme Variable
-  void define(const std::string& heist_variable_name, const data& variable_value) noexcept {
-    if(!G.GLOBAL_ENVIRONMENT_POINTER) set_default_global_environment();
+  void interpreter::define(const std::string& heist_variable_name, const data& variable_value)noexcept{
+    if(!confirm_owner_thread()) return;
+    activation scope(*this);
     G.GLOBAL_ENVIRONMENT_POINTER->define_variable(heist_variable_name, variable_value);
   }
 
+  /******************************************************************************
+  * INTERPRETER APPLICATION
+  ******************************************************************************/
 
   // Apply Heist Scheme Callable by Value
-  data apply(data& heist_procedure, data_vector args) noexcept {
-    if(!G.GLOBAL_ENVIRONMENT_POINTER) set_default_global_environment();
+  data interpreter::apply(data& heist_procedure, data_vector args)noexcept{
+    if(!confirm_owner_thread()) return data();
+    activation scope(*this);
     if(!primitive_toolkit::data_is_callable(heist_procedure)) {
       HEIST_PRINT_ERR("Invalid Heist Scheme Callable: " << HEIST_PROFILE(heist_procedure));
       return data();
@@ -93,35 +231,129 @@ namespace heist {
     try {
       return primitive_toolkit::apply_callable(heist_procedure, std::move(args));
     } catch(const SCM_EXCEPT& eval_throw) {
-      if(eval_throw == heist::SCM_EXCEPT::JUMP) {
-        HEIST_PRINT_ERR("Uncaught JUMP procedure! JUMPed value: " 
-          << HEIST_PROFILE(heist::GLOBALS::JUMP_GLOBAL_PRIMITIVE_ARGUMENT));
-      } else if(eval_throw == heist::SCM_EXCEPT::EXIT) {
-        if(heist::GLOBALS::HEIST_EXIT_CODE)
-          return data(heist::symconst::exit_failure);
-        return data(heist::symconst::exit_success);
-      }
-      return data();
+      return handle_uncaught_throw(eval_throw);
     }
   }
 
+
   // Apply Heist Scheme Callable by Name
-  data apply(const std::string& heist_procedure_name, data_vector args) noexcept {
-    if(!G.GLOBAL_ENVIRONMENT_POINTER) set_default_global_environment();
+  data interpreter::apply(const std::string& heist_procedure_name, data_vector args)noexcept{
+    if(!confirm_owner_thread()) return data();
+    activation scope(*this);
     try {
       auto val = lookup_variable_value(heist_procedure_name,G.GLOBAL_ENVIRONMENT_POINTER);
       return primitive_toolkit::apply_callable(val, std::move(args));
     } catch(const SCM_EXCEPT& eval_throw) {
-      if(eval_throw == heist::SCM_EXCEPT::JUMP) {
-        HEIST_PRINT_ERR("Uncaught JUMP procedure! JUMPed value: " 
-          << HEIST_PROFILE(heist::GLOBALS::JUMP_GLOBAL_PRIMITIVE_ARGUMENT));
-      } else if(eval_throw == heist::SCM_EXCEPT::EXIT) {
-        if(heist::GLOBALS::HEIST_EXIT_CODE)
-          return data(heist::symconst::exit_failure);
-        return data(heist::symconst::exit_success);
+      return handle_uncaught_throw(eval_throw);
+    }
+  }
+} // End of namespace heist
+
+/******************************************************************************
+* INTERPRETER POOL
+******************************************************************************/
+
+namespace heist {
+  // Runs jobs on worker threads, each owning its own interpreter. Jobs receive their
+  //   worker's interpreter, & must convert any Heist data to C++ values before
+  //   returning (Heist data can't leave its thread). Call "reset" on the given
+  //   interpreter to isolate a job from those previously run by its worker.
+  class interpreter_pool {
+  public:
+    explicit interpreter_pool(size_type workers = std::max(1u,std::thread::hardware_concurrency())) {
+      for(size_type i = 0, n = std::max(size_type(1),workers); i < n; ++i)
+        threads.emplace_back([this]{run_worker();});
+    }
+    interpreter_pool(const interpreter_pool&) = delete;
+    interpreter_pool& operator=(const interpreter_pool&) = delete;
+
+    // Finishes every queued job before joining the workers
+    ~interpreter_pool()noexcept{
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+      }
+      job_ready.notify_all();
+      for(auto& worker : threads) worker.join();
+    }
+
+    size_type size()const noexcept{return threads.size();}
+
+    // Queues <job> (invoked as "job(heist::interpreter&)") for the next idle worker
+    template<typename Job>
+    auto submit(Job&& job) -> std::future<std::invoke_result_t<std::decay_t<Job>,interpreter&>> {
+      using result_t = std::invoke_result_t<std::decay_t<Job>,interpreter&>;
+      auto task = std::make_shared<std::packaged_task<result_t(interpreter&)>>(std::forward<Job>(job));
+      auto result = task->get_future();
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.emplace_back([task](interpreter& in){(*task)(in);});
+      }
+      job_ready.notify_one();
+      return result;
+    }
+
+    // Evaluates <exp> in the next idle worker's interpreter, returning the written result
+    std::future<std::string> eval(std::string exp) {
+      return submit([exp=std::move(exp)](interpreter& in)mutable{return in.eval(std::move(exp)).noexcept_write();});
+    }
+
+  private:
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable job_ready;
+    std::deque<std::function<void(interpreter&)>> jobs;
+    bool stopping = false;
+
+    void run_worker()noexcept{
+      interpreter in;
+      for(;;) {
+        std::function<void(interpreter&)> job;
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          job_ready.wait(lock,[this]{return stopping || !jobs.empty();});
+          if(jobs.empty()) return;
+          job = std::move(jobs.front());
+          jobs.pop_front();
+        }
+        job(in);
       }
-      return data();
     }
+  };
+} // End of namespace heist
+
+/******************************************************************************
+* DEFAULT INTERPRETER FREE FUNCTIONS
+******************************************************************************/
+
+namespace heist {
+  // Evaluate Heist Scheme Expression in String
+  data eval(std::string exp)noexcept{
+    return interpreter::thread_default().eval(std::move(exp));
+  }
+
+
+  // Define C++ Primitive for Heist Scheme
+  void define(const std::string& heist_primitive_name, prm_ptr_t cpp_function, bool append_env_to_args=false)noexcept{
+    interpreter::thread_default().define(heist_primitive_name,cpp_function,append_env_to_args);
+  }
+
+
+  // Define Heist Scheme Variable
+  void define(const std::string& heist_variable_name, const data& variable_value)noexcept{
+    interpreter::thread_default().define(heist_variable_name,variable_value);
+  }
+
+
+  // Apply Heist Scheme Callable by Value
+  data apply(data& heist_procedure, data_vector args)noexcept{
+    return interpreter::thread_default().apply(heist_procedure,std::move(args));
+  }
+
+
+  // Apply Heist Scheme Callable by Name
+  data apply(const std::string& heist_procedure_name, data_vector args)noexcept{
+    return interpreter::thread_default().apply(heist_procedure_name,std::move(args));
   }
 } // End of namespace heist
 
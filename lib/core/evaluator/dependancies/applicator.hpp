@@ -90,13 +90,15 @@ data apply_primitive_procedure(data& proc,data_vector&& args,env_type& env,const
   if(tracing_proc) output_call_trace_invocation(proc.fcn,args);
   // Provide the environment to primitives applying user-defined procedures
   if(primitive_requires_environment(proc.fcn.prm)) args.push_back(env);
-  if(proc.fcn.prm == primitive_APPLY) args.push_back(boolean(tail_call));
+  // Provide whether in a tail call to primitives that may return on behalf of their caller
+  if(proc.fcn.prm == primitive_APPLY || proc.fcn.prm == primitive_JUMP_BANG || proc.fcn.prm == primitive_ESCAPE_CONTINUATION)
+    args.push_back(boolean(tail_call));
   // Extend partially applied args as needed
-  if(!proc.fcn.param_instances.empty()) {
+  if(!proc.fcn.param_instances().empty()) {
     if(args.empty())
       HEIST_THROW_ERR('\''<<proc.fcn.printable_procedure_name()<<" partial procedure didn't receive any arguments!"
-        << "\n     Partial Bindings: " << procedure_call_signature(proc.fcn.printable_procedure_name(),proc.fcn.param_instances[0].first));
-    args.insert(args.begin(),proc.fcn.param_instances[0].first.begin(),proc.fcn.param_instances[0].first.end());
+        << "\n     Partial Bindings: " << procedure_call_signature(proc.fcn.printable_procedure_name(),proc.fcn.param_instances()[0].first));
+    args.insert(args.begin(),proc.fcn.param_instances()[0].first.begin(),proc.fcn.param_instances()[0].first.end());
   }
   auto result = proc.fcn.prm(std::move(args));
   // Clear call from stack strace
@@ -107,14 +109,34 @@ data apply_primitive_procedure(data& proc,data_vector&& args,env_type& env,const
 }
 
 
+// -- APPLICATION DEPTH
+// Tracks a non-tail compound application in its procedure's recursive depth & the 
+//   stack's application depth (restoring both even if unwound by a jump or an error)
+// => The stack also records the recursive depths it raised, so that suspended
+//    coroutines don't count against their procedures' recursion limits
+struct compound_application_depth_guard {
+  size_type& recursive_depth;
+  compound_application_depth_guard(size_type& depth) : recursive_depth(depth) {
+    GLOBALS::RECURSIVE_DEPTHS.push_back(&recursive_depth);
+    ++recursive_depth;
+    ++GLOBALS::APPLICATION_DEPTH;
+  }
+  ~compound_application_depth_guard()noexcept{
+    --recursive_depth;
+    --GLOBALS::APPLICATION_DEPTH;
+    GLOBALS::RECURSIVE_DEPTHS.pop_back();
+  }
+};
+
+
 // -- APPLY
 // Applies the given procedure, & then reapplies iteratively if at a tail call
-data apply_compound_procedure(exe_fcn_t& proc, env_type& extended_env) {
+data apply_compound_procedure(const exe_fcn_t& proc, env_type& extended_env) {
   auto result = proc(extended_env);
   size_type count = 1;
 tail_call_recur:
   if(result.is_type(types::exp) && is_tagged_list(result.exp,symconst::tail_call)) { // if tail call
-    result = result.exp[1].fcn.bodies[0](result.exp[1].fcn.env);
+    result = (*result.exp[1].fcn.tail_call_body)(result.exp[1].fcn.env);
     ++count;
     goto tail_call_recur;
   }
@@ -146,7 +168,9 @@ data execute_application(data& procedure,data_vector&& arguments,env_type& env,c
   if(procedure.fcn.is_primitive())
     return apply_primitive_procedure(procedure,std::move(arguments),env,tail_call);
   // compound proc -- create the procedure body's extended environment frame
-  exe_fcn_t fcn_body;
+  // => <code> keeps <fcn_body> alive even if applying <procedure> reassigns it
+  auto code = procedure.fcn.code;
+  const exe_fcn_t* fcn_body = nullptr;
   auto extended_env = procedure.fcn.get_extended_environment(arguments,fcn_body,applying_in_cps);
   // splice in current env for dynamic scope as needed
   if(procedure.fcn.is_using_dynamic_scope()) {
@@ -154,12 +178,11 @@ data execute_application(data& procedure,data_vector&& arguments,env_type& env,c
   }
   // add the 'self' object iff applying a method
   if(procedure.fcn.self) {
-    extended_env->define_variable("self",procedure.fcn.self);
+    extended_env->self = procedure.fcn.self;
   }
   // confirm max recursive depth hasn't been exceeded
   auto& recursive_depth = procedure.fcn.recursive_depth();
   if(recursive_depth > G.MAX_RECURSION_DEPTH) {
-    recursive_depth = 0;
     HEIST_THROW_ERR("Maximum recursion depth of "<<G.MAX_RECURSION_DEPTH<<" exceeded!"
       << HEIST_FCN_ERR(procedure.fcn.printable_procedure_name(), arguments));
   }
@@ -170,13 +193,15 @@ data execute_application(data& procedure,data_vector&& arguments,env_type& env,c
   if(tail_call) {
     data_vector tail_call_signature(2); // {tail-call-tag, proc-body, extended-env}
     tail_call_signature[0] = symconst::tail_call;
-    tail_call_signature[1] = fcn_type(extended_env,fcn_body);
+    tail_call_signature[1] = fcn_type(extended_env,code,fcn_body);
     return tail_call_signature;
   }
   // execute compound procedure
-  ++recursive_depth;
-  auto result = apply_compound_procedure(fcn_body,extended_env);
-  --recursive_depth;
+  data result;
+  {
+    compound_application_depth_guard depth_guard(recursive_depth);
+    result = apply_compound_procedure(*fcn_body,extended_env);
+  }
   // output result's trace as needed
   if(tracing_proc) output_call_trace_result(procedure.fcn,result);
   return result;
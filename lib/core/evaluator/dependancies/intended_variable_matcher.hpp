@@ -88,6 +88,9 @@ namespace heist {
       // Get all possible intended matches
       match_vector_type local_match_vector;
       get_match_vector_of_possibly_intended_variables_in_objs(var,local_match_vector,env->objects());
+      if(env->frozen) // skip bindings deleted from a frozen universe snapshot
+        local_match_vector.erase(std::remove_if(local_match_vector.begin(),local_match_vector.end(),
+          [&](const auto& match){return env->snapshot_erased_variable(match.first);}),local_match_vector.end());
       if(local_match_vector.empty()) return;
       sort_match_vector_by_match_hash(local_match_vector.begin(),local_match_vector.end());
       // Cut off miniscule possible matches
@@ -349,7 +349,7 @@ string stringify_MACRO_EXPANSION_TREES(const MACRO_EXPANSION_TREES_t& MACRO_EXPA
 
 // Generate a unique hashed id_name for the expanded symbol
 string hash_macro_expansion_identifier(const string& id_name,const bool& finished_expanding = false)noexcept{
-  static size_type IDX_1 = 0, IDX_2 = 0;
+  static thread_local size_type IDX_1 = 0, IDX_2 = 0;
   if(finished_expanding) {
     IDX_1 = IDX_2 = 0;
     return "";
@@ -954,6 +954,18 @@ bool expand_macro_if_in_env(const string& label,data_vector args,
   env_type env_iterator = env;
   hash_all_ellipsis_in_macro_args(args);
   while(env_iterator != nullptr) {
+    // frozen universe snapshots defer to the running universe's global macros
+    if(env_iterator->frozen) {
+      if(auto overlay = env_iterator->snapshot_overlay();
+         overlay && handle_macro_transformation(label,args,overlay->macros(),expanded_exp,env)) {
+        unhash_all_ellipsis_in_macro_args(expanded_exp);
+        return true;
+      }
+      if(env_iterator->snapshot_erased_macro(label)) {
+        env_iterator = env_iterator->parent;
+        continue;
+      }
+    }
     if(handle_macro_transformation(label,args,env_iterator->macros(),expanded_exp,env)) {
       unhash_all_ellipsis_in_macro_args(expanded_exp);
       return true;
@@ -648,17 +648,21 @@ namespace heist {
     replace_param_temporary_dot_with_internal_dot(vars);
     bool is_cps_procedure = params_end_with_a_continuation(vars);
     auto body_proc = analyze_sequence(data_vector(exp.begin()+2,exp.end()),true,cps_block); // analyze body syntax
-    auto params = generate_lambda_parameter_object(std::move(vars));
+    // closures share the code template (empty "" name by default: anon proc)
+    function_object::code_type code(function_object::code_template{
+      std::vector<function_object::params_type>(1,generate_lambda_parameter_object(std::move(vars))),
+      std::vector<exe_fcn_t>(1,std::move(body_proc))
+    });
     // set CPS value if needed
     if(is_cps_procedure) {
-      return [params=std::move(params),body_proc=std::move(body_proc)](env_type& env){
-        auto proc = fcn_type(params, body_proc, env, ""); // empty "" name by default (anon proc)
+      return [code=std::move(code)](env_type& env){
+        auto proc = fcn_type(code, env, true);
         proc.set_cps_procedure(true);
         return proc;
       };
     }
-    return [params=std::move(params),body_proc=std::move(body_proc)](env_type& env){
-      return fcn_type(params, body_proc, env, ""); // empty "" name by default (anon proc)
+    return [code=std::move(code)](env_type& env){
+      return fcn_type(code, env, true);
     };
   }   
 
@@ -796,17 +800,20 @@ namespace heist {
     }
     for(auto& params : param_insts) replace_param_temporary_dot_with_internal_dot(params);
     bool is_cps_procedure = !param_insts.empty() && params_end_with_a_continuation(param_insts[0]);
-    auto param_objects = generate_fn_parameter_object(std::move(param_insts));
+    // closures share the code template (empty "" name by default: anon proc)
+    function_object::code_type code(function_object::code_template{
+      generate_fn_parameter_object(std::move(param_insts)),std::move(bodies)
+    });
     // set CPS value if needed
     if(is_cps_procedure) {
-      return [param_objects=std::move(param_objects),bodies=std::move(bodies)](env_type& env){
-        auto proc = fcn_type(param_objects, bodies, env, ""); // empty "" name by default (anon proc)
+      return [code=std::move(code)](env_type& env){
+        auto proc = fcn_type(code, env, false);
         proc.set_cps_procedure(true);
         return proc;
       };
     }
-    return [param_objects=std::move(param_objects),bodies=std::move(bodies)](env_type& env){
-      return fcn_type(param_objects, bodies, env, ""); // empty "" name by default (anon proc)
+    return [code=std::move(code)](env_type& env){
+      return fcn_type(code, env, false);
     };
   }
 
@@ -1162,9 +1169,12 @@ namespace heist {
     std::vector<exe_fcn_t> property_exec_procs;
     data_vector ctor_proc;
     parse_defclass_expression(exp,property_names,property_exec_procs,ctor_proc,cps_block);
-    return [proto=std::move(proto),property_names=std::move(property_names),
+    // => the closure is shared by every evaluation, so each builds its own prototype & ctor
+    return [proto_template=std::move(proto),property_names=std::move(property_names),
             property_exec_procs=std::move(property_exec_procs),exp=std::move(exp),
-            ctor_proc=std::move(ctor_proc),cps_block](env_type& env)mutable{
+            ctor_template=std::move(ctor_proc),cps_block](env_type& env)mutable{
+      auto proto = proto_template;
+      auto ctor_proc = ctor_template;
       proto.defn_env = env;
       // confirm inheriting from class objects & add inherited prototype (if present)
       validate_inherited_entity(proto,exp,env);
@@ -1880,8 +1890,56 @@ namespace heist {
   }
 
 
+  // Per-call-site cache of a chain link's property slot
+  // => Hits iff <obj> & the supers searched before the property's owner keep their shapes
+  struct property_inline_cache {
+    std::vector<shp_type> shapes; // shapes of <obj>, then of supers up to the property's owner
+    size_type slot = 0;
+    size_type prototype_property_additions = 0; // guards inherited slots (see "proto-add-property!")
+    bool is_member = false;
+  };
+
+
+  // Returns whether <cache> holds <obj>'s property, assigning its <value> if so
+  bool get_inline_cached_property(const property_inline_cache& cache, object_type* obj, data& value)noexcept{
+    if(cache.shapes.empty()) return false;
+    const size_type owner = cache.shapes.size()-1;
+    if(owner && cache.prototype_property_additions != GLOBALS::PROTOTYPE_PROPERTY_ADDITIONS) return false;
+    for(size_type i = 0; obj && obj->shape == cache.shapes[i]; obj = obj->super.ptr, ++i) {
+      if(i == owner) {
+        value = cache.is_member ? obj->member_values[cache.slot] : obj->method_values[cache.slot];
+        return true;
+      }
+    }
+    return false;
+  }
+
+
+  // Cache the slot of <property> (PRECONDITION: just found via "get_property", so is local to <obj> or a super)
+  void cache_property_slot(property_inline_cache& cache, object_type* obj, const string& property)noexcept{
+    cache.shapes.clear();
+    for(; obj; obj = obj->super.ptr) {
+      cache.shapes.push_back(obj->shape);
+      if(obj->shape->find_property(property,cache.slot,cache.is_member)) {
+        cache.prototype_property_additions = GLOBALS::PROTOTYPE_PROPERTY_ADDITIONS;
+        return;
+      }
+    }
+    cache.shapes.clear();
+  }
+
+
+  // Analyzed property chain access: <call> split into <chain>, w/ a slot cache per chain link
+  struct property_chain_call_site {
+    string call;
+    str_vector chain;
+    std::vector<property_inline_cache> caches;
+  };
+
+
   // Returns the ultimate value of the call-chain
-  data get_object_property_chain_value(string&& call, str_vector&& chain, env_type& env) {
+  data get_object_property_chain_value(const string& call, const str_vector& chain, 
+                                       std::vector<property_inline_cache>& caches, env_type& env) {
     // get the first object instance
     data value = lookup_variable_value(chain[0],env);
     // get the call value
@@ -1889,20 +1947,19 @@ namespace heist {
       if(!value.is_type(types::obj))
         HEIST_THROW_ERR('\''<<call<<" can't access property "<<chain[i]<<" in non-object "
           << HEIST_PROFILE(value) << '!' << HEIST_EXP_ERR(call));
-      bool found = false;
-      // if NOT at the end of a call chain, call MUST refer to an object
-      if(i+1 < n) {
-        value = value.obj->get_property(chain[i], found);
-      // if at the end of a call chain, could be referencing a method, so save "self" for extension
-      } else {
-        obj_type self = value.obj;
-        value = value.obj->get_property(chain[i], found);
-        if(value.is_type(types::fcn)) value.fcn.bind_self(self);
-      }
-      if(!found) {
-        HEIST_THROW_ERR('\''<<call<<' '<<chain[i]<<" isn't a property of object \"" 
-          << generate_invalid_chain_call(chain,i) << "\"!" << HEIST_EXP_ERR(call));
+      obj_type self = value.obj;
+      // seek the property's cached slot, else search the object & cache the slot found
+      if(!get_inline_cached_property(caches[i],self.ptr,value)) {
+        bool found = false;
+        value = self->get_property(chain[i], found);
+        if(!found) {
+          HEIST_THROW_ERR('\''<<call<<' '<<chain[i]<<" isn't a property of object \"" 
+            << generate_invalid_chain_call(chain,i) << "\"!" << HEIST_EXP_ERR(call));
+        }
+        cache_property_slot(caches[i],self.ptr,chain[i]);
       }
+      // if at the end of a call chain, could be referencing a method, so save "self" for extension
+      if(i+1 == n && value.is_type(types::fcn)) value.fcn.bind_self(self);
     }
     return value;
   }
@@ -1914,11 +1971,13 @@ namespace heist {
       return [variable=std::move(variable)](env_type& env){
         return lookup_variable_value(variable,env);
       };
-    // Object accessing members/methods!
-    str_vector chain; // split the call chain into object series
-    get_object_property_chain_sequence(variable,chain);
-    return [variable=std::move(variable),chain=std::move(chain)](env_type& env)mutable{
-      return get_object_property_chain_value(std::move(variable),std::move(chain),env);
+    // Object accessing members/methods! (call site shared by copies of the execution procedure)
+    property_chain_call_site site;
+    get_object_property_chain_sequence(variable,site.chain); // split the call chain into object series
+    site.caches.resize(site.chain.size());
+    site.call = std::move(variable);
+    return [site=tgc_ptr<property_chain_call_site,0>(std::move(site))](env_type& env)mutable{
+      return get_object_property_chain_value(site->call,site->chain,site->caches,env);
     };
   }
 
@@ -1963,8 +2022,8 @@ namespace heist {
     return p.is_type(types::fcn) && 
             (p.fcn.is_primitive() || 
               (p.fcn.is_compound() && 
-                (p.fcn.param_instances[0].first.empty() || 
-                  !data_is_continuation_parameter(*p.fcn.param_instances[0].first.rbegin()))));
+                (p.fcn.param_instances()[0].first.empty() || 
+                  !data_is_continuation_parameter(*p.fcn.param_instances()[0].first.rbegin()))));
   }
 
   bool procedure_requires_continuation(const fcn_type& p)noexcept{
@@ -2020,7 +2079,7 @@ namespace heist {
     for(size_type i = 0, n = arg_exps.size(); i < n; ++i)
       arg_procs[i] = scm_analyze(std::move(arg_exps[i]),false,true);
     return [op_proc=std::move(op_proc),arg_procs=std::move(arg_procs),
-            tail_call=std::move(tail_call)](env_type& env)mutable{
+            tail_call=std::move(tail_call)](env_type& env){
       evaluate_operator(op_proc,env); // generates <data proc>
       // Pass the result of the proc to the current continuation IFF
       //   proc was defined OUTSIDE of a scm->cps block
@@ -2031,8 +2090,8 @@ namespace heist {
         data_vector arg_vals(arg_procs.size() - !passing_continuation);
         // Eval each arg's exec proc to obtain the actual arg values
         if(!passing_continuation) {
-          arg_procs.pop_back();
-          eval_application_arg_procs(arg_procs,arg_vals,env);
+          for(size_type i = 0, n = arg_vals.size(); i < n; ++i)
+            arg_vals[i] = arg_procs[i](env);
           // Pass the result of the proc to the continuation
           return execute_application(continuation,data_vector(1,execute_application(proc,std::move(arg_vals),env,false,true)),env,tail_call,true);
         }
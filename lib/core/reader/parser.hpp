@@ -1,13 +1,19 @@
 // Author: Jordan Randleman -- jordanran199@gmail.com -- parser.hpp
 // => Parses user's input into an AST for the C++ Heist Scheme Interpreter
 //
-// => Parser Function: 
+// => Parser Functions: 
 //    void parse_input_exp(string&& input, data_vector& abstract_syntax_tree)
+//    void parse_next_input_exp(std::string_view input, size_type& i, data_vector& abstract_syntax_tree)
+//    size_type parse_first_input_exp(std::string_view input, data_vector& abstract_syntax_tree)
+//
+// => Reads in a single pass: comments, case-folding, reader macros & aliases, 
+//    & vector/hmap/infix-precedence literals are all handled while tokenizing
 
 #ifndef HEIST_SCHEME_CORE_READER_PARSER_HPP_
 #define HEIST_SCHEME_CORE_READER_PARSER_HPP_
 
-#include "errors.hpp" // reader error handling mechanisms
+#include "errors.hpp"        // reader error handling mechanisms
+#include "source_buffer.hpp" // zero-copy file contents for the reader
 
 /******************************************************************************
 * READER HELPER FUNCTIONS
@@ -71,22 +77,6 @@ namespace heist {
     return (escape_counter & 1) == 0; // odd instance of escapes = escaped '"' char
   }
 
-  // Determine whether at a paren that isn't a character
-  bool is_non_char_open_paren(const size_type& i, const string& input) noexcept {
-    return IS_OPEN_PAREN(input[i]) && (i < 2 || input[i-1] != '\\' || input[i-2] != '#');
-  }
-  bool is_non_char_close_paren(const size_type& i, const string& input) noexcept {
-    return IS_CLOSE_PAREN(input[i]) && (i < 2 || input[i-1] != '\\' || input[i-2] != '#');
-  }
-
-  // Determine whether at a comment's start that isn't a character
-  bool is_single_line_comment(const size_type& i, const string& input) noexcept {
-    return (i<2 || input[i-2]!='#' || input[i-1]!='\\') && input[i]==';';
-  }
-  bool is_multi_line_comment(const size_type& i, const string& input) noexcept {
-    return (i<2 || input[i-2]!='#' || input[i-1]!='\\') && input[i]=='#' && input[i+1]=='|';
-  }
-
   // Skip past string literal
   // PRECONDITION:  input[i] = '"', at the string's start
   // POSTCONDITION: input[i] = '"', at the string's end
@@ -95,284 +85,19 @@ namespace heist {
     while(i < n && !is_non_escaped_double_quote(++i,input));
   }
 
-  // Skip past single-line comment: input[i] ends directly prior '\n'
-  void skip_single_line_comment(size_type& i, const string& input) noexcept {
-    while(input[i+1] && input[i+1] != '\n') ++i;
-  }
-
-  // Skip past multi-line comment: input[i] ends at '#' of "|#"
-  void skip_multi_line_comment(size_type& i, const string& input) noexcept {
-    while(input[i+1] && (input[i]!='|'||input[i+1]!='#')) ++i;
-    if(input[i+1]) ++i;
-  }
-
-  // Remove comments and trim whitespace after open parens
-  void strip_comments_and_redundant_whitespace(string& input) {
-    for(size_type i = 0; i < input.size();) {
-      // Skip past strings & characters
-      if(is_non_escaped_double_quote(i,input)) {
-        skip_string_literal(i,input);
-      } else if(input[i]=='#' && input[i+1]=='\\') {
-        i += 3;
-      // Trim redundant whitespace
-      } else if(i>0 && is_non_char_open_paren(i-1,input) && isspace(input[i])) {
-        size_type space_count = 0, j = i;
-        while(input[j] && isspace(input[j])) ++space_count, ++j;
-        input.erase(i,space_count);
-      // Remove single & multi-line comments
-      } else if(is_single_line_comment(i,input)) {
-        size_type comment_size = 0, j = i;
-        while(input[j] && input[j] != '\n') ++comment_size, ++j;
-        input.erase(i,comment_size);
-      } else if(is_multi_line_comment(i,input)) {
-        size_type comment_size = 0, j = i;
-        while(input[j+1] && (input[j]!='|'||input[j+1]!='#')) ++comment_size,++j;
-        if(!input[j+1]) throw READER_ERROR::incomplete_comment;
-        input.erase(i,comment_size+2); // +2 also erases closing '|#'
-        continue;                      // ++i would miss adjacent mutli-lines
-      }
-      ++i;
-    }
-  }
-
-  // Lowercase-ify all non-char & non-string tokens (case-insensitivity)
-  void render_input_cAsE_iNsEnSiTiVe(string& input) noexcept {
-    for(size_type i = 0, n = input.size(); i < n; ++i) {
-      if(is_non_escaped_double_quote(i,input)) skip_string_literal(i,input);
-      else if(i < n-2 && input[i] == '#' && input[i+1] == '\\') i += 3;
-      else input[i] = scm_numeric::mklower(input[i]);
-    }
-  }
-
   /******************************************************************************
-  * READER DATA VALIDATION
+  * READER MACRO IDENTIFICATION
   ******************************************************************************/
 
-  // Confirms given a valid scheme expression: ie each '(' has a ')'
-  bool confirm_valid_scm_expression(const string& input) {
-    long long paren_count = 0;
-    for(size_type i = 0, n = input.size(); i < n; ++i) {
-      // account for whether at a paren, string literal, or comment
-      if(is_non_char_open_paren(i,input))       ++paren_count;
-      else if(is_non_char_close_paren(i,input)) --paren_count;
-      else if(is_non_escaped_double_quote(i,input)) {
-        skip_string_literal(i,input);
-        if(i == n) throw READER_ERROR::incomplete_string;
-      } else if(is_single_line_comment(i,input)) {
-        skip_single_line_comment(i,input);
-      } else if(is_multi_line_comment (i,input)) {
-        skip_multi_line_comment (i,input);
-        if(i == n) throw READER_ERROR::incomplete_comment;
-      }
-      // check whether detected an invalid expression
-      if(paren_count<0 || (i>=n && input[n-1] != '"')) { 
-        if(paren_count < 0) throw READER_ERROR::early_end_paren;   // ')' Found Prior '('
-        else                throw READER_ERROR::incomplete_string; // Improper String
-      }
-    }
-    if(paren_count != 0)
-      throw READER_ERROR::incomplete_expression; // Mismatched '(' & ')'
-    return (paren_count == 0);
-  }
-
-  /******************************************************************************
-  * READER MACROS & QUOTE EXPANSION
-  ******************************************************************************/
-
-  // Reader macro identification / error-checking helpers
-  bool is_escaped_variadic(const string& input, const size_type i)noexcept{ // do NOT expand \ as a lambda around ...
+  bool is_escaped_variadic(std::string_view input, const size_type i)noexcept{ // do NOT expand \ as a lambda around ...
     if(input[i] != '\\') return false;
     size_type n = input.size(), j = i;
     while(j < n && input[j] == '\\') ++j;
     return input.compare(j,3,"...") == 0;
   }
 
-  bool input_begins_with_prefix(const string& prefix, const string& input, const size_type i)noexcept{
-    return input.size()-i-1 >= prefix.size() && !is_escaped_variadic(input,i) && input.compare(i,prefix.size(),prefix) == 0;
-  }
-
-  size_type is_expandable_reader_macro(const string& input, const size_type i)noexcept{
-    for(size_type j = 0, n = G.SHORTHAND_READER_MACRO_REGISTRY.size(); j < n; ++j)
-      if(input_begins_with_prefix(G.SHORTHAND_READER_MACRO_REGISTRY[j],input,i))
-        return j;
-    return GLOBALS::MAX_SIZE_TYPE;
-  }
-
-  void check_for_improper_reader_macro_use(char c) {
-    if(!c)                throw READER_ERROR::quoted_end_of_buffer;
-    if(IS_CLOSE_PAREN(c)) throw READER_ERROR::quoted_end_of_expression;
-    if(isspace(c))        throw READER_ERROR::quoted_space;
-  }
-
-
-  // Reader macro expansion helpers
-  void expand_reader_macro(string& input, size_type& i, size_type after_macro_idx, const size_type& macro_idx)noexcept{
-    input.insert(after_macro_idx,")"); // insert quote after string literal
-    input.erase(i,G.SHORTHAND_READER_MACRO_REGISTRY[macro_idx].size()); // erase shorthand
-    input.insert(i,'(' + G.LONGHAND_READER_MACRO_REGISTRY[macro_idx] + ' '); // add longhand
-    i += 1 + G.LONGHAND_READER_MACRO_REGISTRY[macro_idx].size(); // mv past longhand
-  }
-
-  void expand_around_string_literal(string& input, size_type& i, const size_type& macro_idx, size_type after_macro_idx)noexcept{
-    skip_string_literal(after_macro_idx,input);
-    expand_reader_macro(input,i,after_macro_idx+1,macro_idx);
-  }
-
-  void expand_around_char_literal(string& input, size_type& i, const size_type& macro_idx, size_type after_macro_idx) {
-    after_macro_idx += 3;
-    const size_type n = input.size();
-    while(after_macro_idx < n && !IS_END_OF_WORD(input[after_macro_idx],input[after_macro_idx+1])) 
-      ++after_macro_idx;
-    if(after_macro_idx > n) throw READER_ERROR::quoted_incomplete_char; // Improper '#\ quotation of incomplete char
-    expand_reader_macro(input,i,after_macro_idx,macro_idx);
-  }
-
-  void expand_around_expression_literal(string& input, size_type& i, const size_type& macro_idx, size_type after_macro_idx)noexcept{
-    after_macro_idx += 1;
-    const size_type n = input.size();
-    size_type paren_count = 1;
-    while(after_macro_idx < n && paren_count) {
-      if(is_non_char_open_paren(after_macro_idx,input))       ++paren_count;
-      else if(is_non_char_close_paren(after_macro_idx,input)) --paren_count;
-      else if(is_non_escaped_double_quote(after_macro_idx,input)) skip_string_literal(after_macro_idx,input);
-      ++after_macro_idx;
-    }
-    expand_reader_macro(input,i,after_macro_idx,macro_idx);
-  }
-
-  void expand_around_symbol_or_number_literal(string& input, size_type& i, const size_type& macro_idx, size_type after_macro_idx)noexcept{
-    ++after_macro_idx;
-    while(!IS_END_OF_WORD(input[after_macro_idx],input[after_macro_idx+1]))
-      ++after_macro_idx;
-    expand_reader_macro(input,i,after_macro_idx,macro_idx);
-  }
-
-
-  // Returns whether expanded around a literal -- READER MACRO EXPANSION MAIN DISPATCH
-  bool expand_around_literal(string& input, size_type& i, const size_type& macro_idx, size_type after_macro_idx) {
-    // expanding around string literal
-    if(input[after_macro_idx] == '"') {
-      expand_around_string_literal(input,i,macro_idx,after_macro_idx);
-      return true;
-    }
-    // expanding around char literal
-    if(input[after_macro_idx] == '#' && input[1+after_macro_idx] == '\\') {
-      expand_around_char_literal(input,i,macro_idx,after_macro_idx);
-      return true;
-    }
-    // expanding around expression literal
-    if(IS_OPEN_PAREN(input[after_macro_idx])) {
-      expand_around_expression_literal(input,i,macro_idx,after_macro_idx);
-      return true;
-    }
-    return false;
-  }
-
-
-  // Expands around a nested reader macro
-  void expand_around_nested_reader_macros(string& input, size_type& i, const size_type& macro_idx, size_type after_macro_idx){
-    // Confirm proper nested reader macro use
-    check_for_improper_reader_macro_use(input[after_macro_idx]);
-    // Try expanding around a literal
-    if(expand_around_literal(input,i,macro_idx,after_macro_idx)) return;
-    // Else, expand around a symbol
-    expand_around_symbol_or_number_literal(input,i,macro_idx,after_macro_idx);
-  }
-
-
-  // Returns length of nested reader macros AFTER the current reader macro (0 if none)
-  size_type is_nested_reader_macro(const string& input, const size_type& i, const size_type& macro_idx)noexcept{
-    size_type after_macro_idx = i + G.SHORTHAND_READER_MACRO_REGISTRY[macro_idx].size();
-    size_type nested_macro_idx = is_expandable_reader_macro(input,after_macro_idx);
-    if(nested_macro_idx == GLOBALS::MAX_SIZE_TYPE) return 0; // reader macro not found
-    size_type nested_macro_length = G.SHORTHAND_READER_MACRO_REGISTRY[nested_macro_idx].size();
-    while((nested_macro_idx = is_expandable_reader_macro(input,after_macro_idx+nested_macro_length)) != GLOBALS::MAX_SIZE_TYPE)
-      nested_macro_length += G.SHORTHAND_READER_MACRO_REGISTRY[nested_macro_idx].size();
-    return nested_macro_length;
-  }
-
-
-  // Expands reader macro shorthands: '<exp>  => (quote <exp>)
-  // => NOTE: Recusively expands sequential quotations from right to left
-  //          - IE: '''a = (quote (quote (quote a)))
-  void expand_reader_macro_shorthands(string& input) {
-    for(size_type i = 0; i < input.size(); ++i) {
-      // Don't expand reader macros in string or char literals
-      if(is_non_escaped_double_quote(i,input)) {
-        skip_string_literal(i,input); 
-        continue; // dont expand quotes/reader-macros w/in strings
-      } else if(i+1 < input.size() && input[i] == '#' && input[i+1] == '\\') {
-        i += 2; continue; // dont expand quotes/reader-macros as part of a char literal
-      }
-      // Determine if at a reader macro/quote
-      size_type macro_idx = is_expandable_reader_macro(input,i);
-      if(macro_idx == GLOBALS::MAX_SIZE_TYPE) continue; // reader macro not found
-      // Confirm proper reader macro use
-      size_type after_macro_idx = i + G.SHORTHAND_READER_MACRO_REGISTRY[macro_idx].size();
-      check_for_improper_reader_macro_use(input[after_macro_idx]);
-      size_type nested_macro_length = 0;
-      // Expand around char/string/expression literal
-      if(expand_around_literal(input,i,macro_idx,after_macro_idx)) continue;
-      // Expand around nested reader macros
-      if((nested_macro_length = is_nested_reader_macro(input,i,macro_idx))) {
-        expand_around_nested_reader_macros(input,i,macro_idx,after_macro_idx+nested_macro_length);
-        continue;
-      }
-      // Expand around symbol or number literal
-      expand_around_symbol_or_number_literal(input,i,macro_idx,after_macro_idx);
-    }
-  }
-
-  /******************************************************************************
-  * READER VECTOR & HMAP LITERAL EXPANSION
-  ******************************************************************************/
-
-  template<char literal_prefix>
-  bool is_vector_or_hmap_literal(const size_type& i, const string& input) noexcept {
-    return (i+2<input.size() && input[i]==literal_prefix && IS_OPEN_PAREN(input[i+1]) && 
-           (i<2 || input[i-1]!='\\' || input[i-2]!='#'));
-  }
-
-  // #(<...>) => (vector-literal <...>)
-  // $(<...>) => (hmap-literal <...>)
-  template<char literal_prefix,size_type prefix_expansion_length>
-  void expand_vector_or_hmap_literals(string& input, const char* prefix_expansion) noexcept {
-    for(size_type i = 0; i < input.size(); ++i) {
-      // dont expand vector literals w/in strings
-      if(is_non_escaped_double_quote(i,input)) {
-        skip_string_literal(i,input); 
-        continue;
-      }
-      // if at <literal_prefix> in a non-char <literal_prefix>( (IE _NOT_ at the <literal_prefix> in #\<literal_prefix>)
-      if(is_vector_or_hmap_literal<literal_prefix>(i,input)) {
-        input.erase(i,1);                    // erase <literal_prefix>
-        input.insert(i+1, prefix_expansion); // splice in <prefix_expansion> after (
-        i += prefix_expansion_length;        // mv past "(<prefix_expansion>"
-      }
-    }
-  }
-
-  void expand_vector_and_hmap_literals(string& input) noexcept {
-    expand_vector_or_hmap_literals<'#',sizeof("vector-literal ")-1>(input,"vector-literal ");
-    expand_vector_or_hmap_literals<'$',sizeof("hmap-literal ")-1>(input,"hmap-literal ");
-  }
-
   /******************************************************************************
-  * INFIX OPERATOR INF PRECEDENCE SCOPING EXPANSION
-  ******************************************************************************/
-
-  // "{" => "(heist:core:inf-precedence "
-  void expand_inf_precedence_scoping(string& input) noexcept {
-    for(size_type i = 0; i < input.size(); ++i) {
-      if(is_non_escaped_double_quote(i,input))
-        skip_string_literal(i,input); 
-      else if(input[i] == '{' && (i <= 1 || input[i-1] != '\\' || input[i-2] != '#'))
-        input = (input.substr(0,i) + '(') + symconst::inf_precedence + (' ' + input.substr(i+1));
-    }
-  }
-
-  /******************************************************************************
-  * READER ALIAS CONVERSION
+  * READER ALIAS IDENTIFICATION
   ******************************************************************************/
 
   bool symbol_is_reader_alias(const string& sym, size_type& idx)noexcept{
@@ -385,17 +110,6 @@ namespace heist {
     return false;
   }
 
-  void expand_reader_aliases(data_vector& ast)noexcept{
-    if(G.SHORTHAND_READER_ALIAS_REGISTRY.empty()) return;
-    size_type idx = 0;
-    for(size_type i = 0, n = ast.size(); i < n; ++i) {
-      if(ast[i].is_type(types::exp))
-        expand_reader_aliases(ast[i].exp);
-      else if(ast[i].is_type(types::sym) && symbol_is_reader_alias(ast[i].sym,idx))
-        ast[i].sym = G.LONGHAND_READER_ALIAS_REGISTRY[idx];
-    }
-  }
-
   /******************************************************************************
   * READER LAMBDA SHORTHAND EXPANSION
   ******************************************************************************/
@@ -439,15 +153,6 @@ namespace heist {
     return !ast.empty() && ast[0].is_type(types::sym) && ast[0].sym == symconst::reader_lambda;
   }
 
-  // \ -> lambda
-  void expand_reader_lambda_shorthands(data_vector& ast)noexcept{
-    if(is_reader_lambda_shorthand(ast))
-      expand_reader_lambda_shorthand(ast);
-    for(auto& datum : ast)
-      if(datum.is_type(types::exp))
-        expand_reader_lambda_shorthands(datum.exp);
-  }
-
   /******************************************************************************
   * READER INFIX->PREFIX CONVERSION
   ******************************************************************************/
@@ -596,112 +301,417 @@ namespace heist {
     return !num.is_nan(); // already accounted for parsing a NaN literal
   }
 
-  // Check whether data is a number. 
-  //   => NOTE: 2.0.0 is a valid Scheme symbol
-  //            -> Hence must confirm is numeric & NOT symbol prior extraction
-  bool data_is_number(size_type& i, const string& input, num_type& exp) noexcept {
-    string num;
-    const size_type n = input.size();
-    size_type j = i;
-    while(j < n && !IS_END_OF_WORD(input[j],input[j+1])) num += input[j++];
-    if(convert_string_to_scm_number(num,exp)) {
-      i = j-1;
-      return true;
+  /******************************************************************************
+  * READER STATE
+  ******************************************************************************/
+
+  // Cursor over the raw buffer being read. Reader syntax is expanded while 
+  //   tokenizing, hence <input> is never rewritten & only ever read once.
+  struct reader_state {
+    std::string_view input;
+    const size_type n;
+    size_type i = 0;
+    size_type depth = 0; // # of expressions being read
+    bool folding_case = !GLOBALS::USING_CASE_SENSITIVE_SYMBOLS;
+    bool expanding_reader_macros = true;
+    // Reader macro misuse is only reported once the buffer is confirmed to be
+    //   a complete expression (lets the REPL keep reading incomplete input)
+    bool has_deferred_error = false;
+    READER_ERROR deferred_error = READER_ERROR::quoted_space;
+
+    reader_state(std::string_view buffer, const size_type start = 0)noexcept : input(buffer), n(buffer.size()), i(start) {}
+
+    char peek(const size_type offset = 0)const noexcept{return i+offset < n ? input[i+offset] : '\0';}
+
+    // Case-folded char at <idx> (PRECONDITION: idx < n)
+    char folded(const size_type idx)const noexcept{return folding_case ? scm_numeric::mklower(input[idx]) : input[idx];}
+
+    void defer_error(const READER_ERROR err)noexcept{
+      if(has_deferred_error) return;
+      has_deferred_error = true, deferred_error = err;
+    }
+  };
+
+  /******************************************************************************
+  * READER WHITESPACE & COMMENT SKIPPING
+  ******************************************************************************/
+
+  bool is_comment_start(const reader_state& rs, const size_type idx)noexcept{
+    return rs.input[idx] == ';' || (rs.input[idx] == '#' && idx+1 < rs.n && rs.input[idx+1] == '|');
+  }
+
+  // Skip past the comment at rs.i: ";" runs thru the line, "#|" thru the next "|#"
+  void skip_comment(reader_state& rs) {
+    if(rs.input[rs.i] == ';') {
+      while(rs.i < rs.n && rs.input[rs.i] != '\n') ++rs.i;
+      return;
+    }
+    const auto comment_end = rs.input.find("|#",rs.i+1);
+    if(comment_end == string::npos) // unclosed expressions take precedence (for the REPL's indentation)
+      throw rs.depth ? READER_ERROR::incomplete_expression : READER_ERROR::incomplete_comment;
+    rs.i = comment_end + 2;
+  }
+
+  void skip_whitespace_and_comments(reader_state& rs) {
+    while(rs.i < rs.n) {
+      if(isspace(rs.input[rs.i]))         ++rs.i;
+      else if(is_comment_start(rs,rs.i)) skip_comment(rs);
+      else return;
     }
-    return false;
   }
 
   /******************************************************************************
-  * READER AST CONSTRUCTION HELPER FUNCTIONS
+  * READER TOKEN IDENTIFICATION
   ******************************************************************************/
 
-  // Check whether data is a string literal
-  bool data_is_string(size_type& i, const string& input, string& exp) noexcept {
-    if(is_non_escaped_double_quote(i,input)) {
-      ++i;
-      const size_type n = input.size();
-      while(i < n && !is_non_escaped_double_quote(i,input)) exp += input[i], ++i;
-      return true;
+  // Returns the index of the reader macro shorthand at <idx> (GLOBALS::MAX_SIZE_TYPE if none)
+  // => NOTE: reader macros are matched w/ case-folding
+  size_type reader_macro_at(const reader_state& rs, const size_type idx)noexcept{
+    if(!rs.expanding_reader_macros || is_escaped_variadic(rs.input,idx)) return GLOBALS::MAX_SIZE_TYPE;
+    for(size_type j = 0, total = G.SHORTHAND_READER_MACRO_REGISTRY.size(); j < total; ++j) {
+      const auto& shorthand = G.SHORTHAND_READER_MACRO_REGISTRY[j];
+      const size_type length = shorthand.size();
+      if(rs.n-idx-1 < length) continue; // reader macros must precede some datum
+      size_type k = 0;
+      while(k < length && rs.folded(idx+k) == shorthand[k]) ++k;
+      if(k == length) return j;
     }
-    return false; 
+    return GLOBALS::MAX_SIZE_TYPE;
   }
 
-  // Check whether data is a char
-  bool data_is_char(size_type& i, const string& input, chr_type& exp) noexcept {
-    if(input[i] == '#' && input[i+1] == '\\') {
-      i += 2;
-      if(auto [ch, name] = data_is_named_char(i,input); !name.empty()) 
-        exp = ch, i += name.size()-(name.size()>2);
-      else exp = input[i];
-      return true;
+
+  // Whether <idx> ends the symbol/number token being read: reader syntax may
+  //   directly follow a token w/o any whitespace (IE "a'b" = "a (quote b)")
+  bool is_token_boundary(const reader_state& rs, const size_type idx)noexcept{
+    return IS_END_OF_WORD(rs.input[idx],idx+1 < rs.n ? rs.input[idx+1] : '\0') || is_comment_start(rs,idx) || 
+           reader_macro_at(rs,idx) != GLOBALS::MAX_SIZE_TYPE;
+  }
+
+
+  // Whether <token> may denote a number (else is definitely a symbol)
+  bool token_may_be_number(const string& token)noexcept{
+    return isdigit(token[0]) || token[0] == '+' || token[0] == '-' || token[0] == '.' || token[0] == '#';
+  }
+
+
+  // Symbol w/ any reader alias expanded
+  data make_reader_symbol(string&& sym)noexcept{
+    if(size_type idx = 0; !G.SHORTHAND_READER_ALIAS_REGISTRY.empty() && symbol_is_reader_alias(sym,idx))
+      return data(G.LONGHAND_READER_ALIAS_REGISTRY[idx]);
+    return data(std::move(sym));
+  }
+
+  /******************************************************************************
+  * READER ATOM PARSING
+  ******************************************************************************/
+
+  // PRECONDITION: rs.input[rs.i] = '"', at the string's start
+  data read_string_literal(reader_state& rs) {
+    const size_type start = ++rs.i;
+    for(; rs.i < rs.n && rs.input[rs.i] != '"'; ++rs.i)
+      if(rs.input[rs.i] == '\\') ++rs.i; // skip escaped char
+    if(rs.i >= rs.n) throw READER_ERROR::incomplete_string;
+    return make_str(unescape_chars(string(rs.input.substr(start,rs.i++ - start))));
+  }
+
+
+  // PRECONDITION: rs.input[rs.i] = '#' && rs.input[rs.i+1] = '\\'
+  data read_char_literal(reader_state& rs) {
+    rs.i += 2;
+    if(rs.i >= rs.n) return chr_type(0);
+    // Only the 1st char of the name retains its case
+    string name(rs.input.substr(rs.i,9)); // "backspace".size() (largest name)
+    if(rs.folding_case) for(size_type j = 1, n = name.size(); j < n; ++j) name[j] = scm_numeric::mklower(name[j]);
+    if(auto [ch, long_name] = data_is_named_char(0,name); !long_name.empty()) {
+      rs.i += long_name.size() + (name[0] == 'x' && isxdigit(name[1])); // hex names exclude their last digit
+      return chr_type(ch);
     }
-    return false;
+    return chr_type(rs.input[rs.i++]);
   }
 
-  // Check whether data is a symbol. Assumes confirmed NOT to be in a string & number already.
-  bool data_is_symbol(size_type& i, const string& input, string& exp) noexcept {
-    const size_type n = input.size();
-    if(i >= n || isspace(input[i]) || IS_OPEN_PAREN(input[i]) || IS_CLOSE_PAREN(input[i])) 
-      return false;
-    while(i < n && (!isspace(input[i]) && !IS_OPEN_PAREN(input[i]) && !IS_CLOSE_PAREN(input[i]))) 
-      exp += input[i++];
-    --i;
-    return true;
+
+  // Reads a number or symbol
+  data read_number_or_symbol(reader_state& rs) {
+    const size_type start = rs.i;
+    do ++rs.i; while(rs.i < rs.n && !is_token_boundary(rs,rs.i));
+    string token(rs.input.substr(start,rs.i-start));
+    if(rs.folding_case) for(auto& ch : token) ch = scm_numeric::mklower(ch);
+    if(num_type num; token_may_be_number(token) && convert_string_to_scm_number(token,num))
+      return num;
+    return make_reader_symbol(std::move(token));
   }
 
   /******************************************************************************
-  * READER MAIN FUNCTIONS -- ABSTRACT SYNTAX TREE CONSTRUCTION
+  * READER EXPRESSION PARSING
   ******************************************************************************/
 
-  // Parses the scheme expression buffer into a data_vector
-  void construct_abstract_syntax_tree(size_type& i, const string& input, data_vector& tree) {
-    const size_type n = input.size();
-    string tmp_str = "", tmp_sym = "";
-    chr_type tmp_chr = 0;
-    num_type tmp_num = 0;
-    for(; i < n; ++i) {
-      if(isspace(input[i])) continue;
-      tmp_str = tmp_sym = "";
-      tmp_num = tmp_chr = 0;
-      if(data_is_string(i,input,tmp_str))      // found string atom
-        tree.push_back(make_str(unescape_chars(tmp_str)));
-      else if(data_is_char(i,input,tmp_chr))   // found char atom
-        tree.push_back(data(tmp_chr));
-      else if(data_is_number(i,input,tmp_num)) // found number atom
-        tree.push_back(data(tmp_num));
-      else if(IS_OPEN_PAREN(input[i])) {       // found new list, recursively parse contents
-        data_vector new_list;
-        construct_abstract_syntax_tree(++i,input,new_list);
-        tree.push_back(data(new_list));
-      } else if(IS_CLOSE_PAREN(input[i]))      // found end of this list, return
-        return;
-      else if(data_is_symbol(i,input,tmp_sym)) // found symbol atom
-        tree.push_back(data(tmp_sym));
-      else throw i;                            // unknown type detected, throw index
+  data read_datum(reader_state& rs);
+
+
+  // Reads the expression at rs.i into <elts> (which may hold a literal tag already)
+  //   => NOTE: "{" denotes infinite infix precedence: {<exp>} = (heist:core:inf-precedence <exp>)
+  // PRECONDITION: IS_OPEN_PAREN(rs.input[rs.i])
+  data read_expression(reader_state& rs, data_vector&& elts) {
+    if(rs.input[rs.i++] == '{') elts.push_back(symconst::inf_precedence);
+    ++rs.depth;
+    for(;;) {
+      skip_whitespace_and_comments(rs);
+      if(rs.i >= rs.n) throw READER_ERROR::incomplete_expression;
+      if(IS_CLOSE_PAREN(rs.input[rs.i])) break;
+      elts.push_back(read_datum(rs));
+    }
+    ++rs.i, --rs.depth;
+    if(is_reader_lambda_shorthand(elts)) expand_reader_lambda_shorthand(elts);
+    return std::move(elts);
+  }
+
+
+  // Returns the data a reader macro's longhand expands into
+  data_vector read_reader_macro_longhand(const string& longhand) {
+    static constexpr const char * const NON_SYMBOL_CHARS = " \t\n\v\f\r()[]{}\";#$";
+    if(isalpha(longhand[0]) && longhand.find_first_of(NON_SYMBOL_CHARS) == string::npos)
+      return data_vector(1,make_reader_symbol(string(longhand)));
+    // Longhands are read verbatim: neither case-folded nor reader-macro-expanded
+    reader_state rs(longhand);
+    rs.folding_case = rs.expanding_reader_macros = false;
+    data_vector expansion;
+    for(skip_whitespace_and_comments(rs); rs.i < rs.n; skip_whitespace_and_comments(rs))
+      expansion.push_back(read_datum(rs));
+    return expansion;
+  }
+
+
+  // Expands reader macro shorthands: '<exp> => (quote <exp>)
+  // => NOTE: Recursively expands sequential quotations, IE: '''a = (quote (quote (quote a)))
+  data read_reader_macro(reader_state& rs, const size_type macro_idx) {
+    rs.i += G.SHORTHAND_READER_MACRO_REGISTRY[macro_idx].size();
+    while(rs.peek() == '#' && rs.peek(1) == '|') skip_comment(rs);
+    // Confirm proper reader macro use
+    const char c = rs.peek();
+    if(!c || IS_CLOSE_PAREN(c) || isspace(c) || c == ';') {
+      rs.defer_error(!c ? READER_ERROR::quoted_end_of_buffer : IS_CLOSE_PAREN(c) ? 
+                          READER_ERROR::quoted_end_of_expression : READER_ERROR::quoted_space);
+      return GLOBALS::VOID_DATA_OBJECT;
     }
+    if(c == '#' && rs.peek(1) == '\\' && rs.i+2 >= rs.n) {
+      rs.defer_error(READER_ERROR::quoted_incomplete_char);
+      rs.i = rs.n;
+      return GLOBALS::VOID_DATA_OBJECT;
+    }
+    // Wrap the datum w/ the longhand
+    auto expansion = read_reader_macro_longhand(G.LONGHAND_READER_MACRO_REGISTRY[macro_idx]);
+    expansion.push_back(read_datum(rs));
+    if(is_reader_lambda_shorthand(expansion)) expand_reader_lambda_shorthand(expansion);
+    return expansion;
+  }
+
+
+  // Reads the datum at rs.i
+  // PRECONDITION: rs.i < rs.n && rs.input[rs.i] isn't whitespace or a comment
+  data read_datum(reader_state& rs) {
+    const char c = rs.input[rs.i], c2 = rs.peek(1);
+    if(c == '"') 
+      return read_string_literal(rs);
+    if(c == '#' && c2 == '\\') 
+      return read_char_literal(rs);
+    if(IS_OPEN_PAREN(c)) 
+      return read_expression(rs,data_vector());
+    if(IS_CLOSE_PAREN(c)) 
+      throw READER_ERROR::early_end_paren; // ')' Found Prior '('
+    // #(<exp>) => (vector-literal <exp>), $(<exp>) => (hmap-literal <exp>)
+    if((c == '#' || c == '$') && IS_OPEN_PAREN(c2) && rs.i+2 < rs.n) {
+      ++rs.i;
+      return read_expression(rs,data_vector(1,c == '#' ? symconst::vec_literal : symconst::map_literal));
+    }
+    if(auto macro_idx = reader_macro_at(rs,rs.i); macro_idx != GLOBALS::MAX_SIZE_TYPE)
+      return read_reader_macro(rs,macro_idx);
+    return read_number_or_symbol(rs);
   }
 
-  // Mutates <input> prior AST parsing: rming comments, expanding quotes, etc.
-  //   => NOTE: returns whether <input> is a candidate for AST parsing
-  bool prepare_string_for_AST_generation(string& input) {
-    if(input.empty() || !confirm_valid_scm_expression(input)) return false;
-    strip_comments_and_redundant_whitespace(input);
-    if(!GLOBALS::USING_CASE_SENSITIVE_SYMBOLS) render_input_cAsE_iNsEnSiTiVe(input);
-    expand_inf_precedence_scoping(input);   //  "{" => "(heist:core:inf-precedence "
-    expand_vector_and_hmap_literals(input); // #(<exp>) => (vector-literal <exp>), $(<exp>) => (hmap-literal <exp>)
-    expand_reader_macro_shorthands(input);  // '<exp>   => (quote <exp>)
-    return true;
+  /******************************************************************************
+  * READER INFIX OPERATOR IDENTIFICATION
+  ******************************************************************************/
+
+  bool data_is_infix_operator(const data& d)noexcept{
+    if(!d.is_type(types::sym)) return false;
+    for(const auto& level : G.INFIX_TABLE)
+      for(const auto& op : level.second)
+        if(op.second == d.sym) return true;
+    return false;
   }
 
+  /******************************************************************************
+  * READER INCREMENTAL INPUT BUFFERING
+  ******************************************************************************/
+
+  // Resumable scanner buffering input fed a line at a time (IE by the REPL).
+  //   Each char is scanned exactly once to track whether the buffer's prefix
+  //   holds complete datums, hence the reader only parses input once it closes.
+  struct incremental_input_buffer {
+    // Append <line> to the buffer, scanning only the new chars
+    void feed(const string& line) {
+      if(!buffer.empty()) buffer += '\n';
+      buffer += line;
+      awaiting_input = false;
+      for(const size_type n = buffer.size(); scanned < n; ++scanned) scan(n);
+      // The end of a line also ends its comment, & any top-level datum
+      if(state == scan_state::line_comment) state = scan_state::code;
+      if(!depth && (state == scan_state::code || state == scan_state::char_literal))
+        state = scan_state::code, complete_length = buffer.size();
+    }
+
+    bool empty()const noexcept{return buffer.empty();}
+    bool has_complete_datums()const noexcept{return complete_length && !awaiting_input;}
+
+    // Whether the buffer ends w/in an unclosed expression (rather than a string/comment)
+    bool in_incomplete_expression()const noexcept{
+      return depth && state != scan_state::string && state != scan_state::string_escape;
+    }
+
+    // Extract the buffer's prefix of complete datums
+    string take_complete_datums() {
+      string datums = buffer.substr(0,complete_length);
+      buffer.erase(0,complete_length);
+      scanned -= complete_length, complete_length = 0;
+      return datums;
+    }
+
+    // Return <datums> to the front of the buffer, & await more input before
+    //   considering them complete (the reader found them to be incomplete)
+    void restore_incomplete_datums(string&& datums) {
+      complete_length = datums.size();
+      scanned += datums.size();
+      buffer.insert(0,datums);
+      awaiting_input = true;
+    }
+
+    void clear()noexcept{
+      buffer.clear();
+      scanned = complete_length = depth = 0;
+      state = scan_state::code;
+      awaiting_input = false;
+    }
+
+  private:
+    enum class scan_state {code, string, string_escape, char_literal, line_comment, block_comment};
+
+    string buffer;
+    size_type scanned = 0;         // # of chars in <buffer> already scanned
+    size_type complete_length = 0; // length of <buffer>'s prefix holding complete datums
+    size_type depth = 0;           // # of open expressions at <scanned>
+    scan_state state = scan_state::code;
+    bool awaiting_input = false;
+
+
+    // Datums end at top-level whitespace. Infix operators may join the datums
+    //   of a line though, so only split lines once operators are defined.
+    void mark_complete()noexcept{
+      if(!depth && G.INFIX_TABLE.empty()) complete_length = scanned+1;
+    }
+
+
+    void scan(const size_type n)noexcept{
+      const char c = buffer[scanned];
+      switch(state) {
+        case scan_state::string:
+          if(c == '\\')     state = scan_state::string_escape;
+          else if(c == '"') state = scan_state::code;
+          return;
+        case scan_state::string_escape:
+          state = scan_state::string;
+          return;
+        case scan_state::char_literal:
+          state = scan_state::code;
+          return;
+        case scan_state::line_comment:
+          if(c == '\n') state = scan_state::code, mark_complete();
+          return;
+        case scan_state::block_comment: // "#|#" closes a block comment, as per the reader
+          if(c == '#' && buffer[scanned-1] == '|') state = scan_state::code;
+          return;
+        default:
+          if(c == '"') {
+            state = scan_state::string;
+          } else if(c == ';') {
+            state = scan_state::line_comment;
+          } else if(c == '#' && scanned+1 < n && buffer[scanned+1] == '|') {
+            state = scan_state::block_comment, ++scanned;
+          } else if(c == '#' && scanned+1 < n && buffer[scanned+1] == '\\') {
+            state = scan_state::char_literal, ++scanned;
+          } else if(IS_OPEN_PAREN(c)) {
+            ++depth;
+          } else if(IS_CLOSE_PAREN(c)) {
+            // Let the reader report unmatched ')'s
+            if(!depth) complete_length = scanned+1;
+            else       --depth;
+          } else if(isspace(c)) {
+            mark_complete();
+          }
+      }
+    }
+  };
+
+  /******************************************************************************
+  * READER MAIN FUNCTIONS -- ABSTRACT SYNTAX TREE CONSTRUCTION
+  ******************************************************************************/
+
   // Parses <input> into an Abstract Syntax Tree, populated in <abstract_syntax_tree>
   // => GIVEN THE RAW USER INPUT
   void parse_input_exp(string&& input, data_vector& abstract_syntax_tree) {
-    if(!prepare_string_for_AST_generation(input)) return;
-    size_type start_index = 0;
-    construct_abstract_syntax_tree(start_index,input,abstract_syntax_tree);
-    expand_reader_aliases(abstract_syntax_tree);
-    expand_reader_lambda_shorthands(abstract_syntax_tree);
-    convert_infix_to_prefix(abstract_syntax_tree);
+    reader_state rs(input);
+    data_vector ast; // only populate <abstract_syntax_tree> once <input> is entirely parsed
+    for(skip_whitespace_and_comments(rs); rs.i < rs.n; skip_whitespace_and_comments(rs))
+      ast.push_back(read_datum(rs));
+    if(rs.has_deferred_error) throw rs.deferred_error;
+    convert_infix_to_prefix(ast);
+    std::move(ast.begin(),ast.end(),std::back_inserter(abstract_syntax_tree));
+  }
+
+
+  // Parses the expression of <input> at <i> (w/ any trailing infix operations) into <abstract_syntax_tree>
+  // => Advances <i> past the parsed expression (to <input>.size() if none found)
+  // => <i> is left where the reader stopped upon throwing a reader error
+  void parse_next_input_exp(std::string_view input, size_type& i, data_vector& abstract_syntax_tree) {
+    reader_state rs(input,i);
+    data_vector ast;
+    try {
+      skip_whitespace_and_comments(rs);
+      if(rs.i < rs.n) {
+        ast.push_back(read_datum(rs));
+        // Read "<operator> <operand>" pairs following the expression
+        while(!G.INFIX_TABLE.empty() && !rs.has_deferred_error) {
+          const size_type expression_end = rs.i;
+          skip_whitespace_and_comments(rs);
+          if(rs.i < rs.n) {
+            auto op = read_datum(rs);
+            skip_whitespace_and_comments(rs);
+            if(data_is_infix_operator(op) && rs.i < rs.n) {
+              ast.push_back(std::move(op));
+              ast.push_back(read_datum(rs));
+              continue;
+            }
+          }
+          rs.i = expression_end;
+          break;
+        }
+      }
+      if(rs.has_deferred_error) throw rs.deferred_error;
+    } catch(...) {
+      i = rs.i;
+      throw;
+    }
+    i = rs.i;
+    convert_infix_to_prefix(ast);
+    std::move(ast.begin(),ast.end(),std::back_inserter(abstract_syntax_tree));
+  }
+
+
+  // Parses the 1st expression of <input> (w/ any trailing infix operations) into <abstract_syntax_tree>
+  // => Returns the index in <input> after the parsed expression (<input>.size() if none found)
+  size_type parse_first_input_exp(std::string_view input, data_vector& abstract_syntax_tree) {
+    size_type i = 0;
+    parse_next_input_exp(input,i,abstract_syntax_tree);
+    return i;
   }
 } // End of namespace heist
-#endif
\ No newline at end of file
+#endif
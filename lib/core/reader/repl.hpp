@@ -26,58 +26,64 @@ namespace heist {
 
 
   // Read & parse user expressions
+  // => Input is buffered across calls, thus datums are returned as soon as 
+  //    they close & any input following them on the line is kept for later
   data_vector read_user_input(FILE* outs, FILE* ins, const bool& in_repl=true){
-    string input, tmp_buffer;
+    static thread_local incremental_input_buffer input; // per-thread, as is all interpreter state
+    string tmp_buffer;
     data_vector abstract_syntax_tree;
-    int ch;
     for(;;) {
+      // Try parsing the complete datums read thus far
+      if(input.has_complete_datums()) {
+        auto datums = input.take_complete_datums();
+        try {
+          // Return AST if successfully parsed the datums
+          parse_input_exp(string(datums),abstract_syntax_tree);
+          return abstract_syntax_tree;
+        } catch(const READER_ERROR& read_error) {
+          // Continue parsing the current expression/string if incomplete
+          if(is_non_repl_reader_error(read_error)) {
+            input.restore_incomplete_datums(std::move(datums));
+          // Alert user if read an invalid expression, then reprompt for input
+          } else {
+            alert_reader_error(outs,read_error,datums);
+            fputc('\n', outs);
+            if(in_repl) announce_input(outs);
+            abstract_syntax_tree.clear(), input.clear();
+          }
+        // Alert user if detected unparsable input (-:- ANOMALY -:-)
+        } catch(const size_type& read_error_index) {
+          alert_reader_error(outs,read_error_index,datums);
+          fputc('\n', outs);
+          if(in_repl) announce_input(outs);
+          abstract_syntax_tree.clear(), input.clear();
+        }
+        continue;
+      }
       // Read input
       fflush(outs);
       tmp_buffer.clear();
-      while((ch = fgetc(ins)) != '\n' && ch != EOF) tmp_buffer += ch;
       // Handle EOF Signal
-      if(ch == EOF && ins == stdin) {
+      if(!read_line_from_file(ins,tmp_buffer) && ins == stdin) {
         clearerr(stdin);
+        const bool reading_expression = !input.empty();
+        input.clear();
         // Called by <read>
         if(!in_repl) {
-          if(!input.empty()) fputs("\n",outs);
+          if(reading_expression) fputs("\n",outs);
           return data_vector();
         }
         // Called by REPL: if entire expression is EOF, exit immediately
-        if(input.empty()) return data_vector(1,chr_type(EOF));
+        if(!reading_expression) return data_vector(1,chr_type(EOF));
         // Called by REPL: if found EOF 1/2 way thru an expression, cancel the current expression
-        input.clear(), tmp_buffer.clear();
         fputs("\n",outs);
         announce_input(outs);
         continue;
       }
-      // Try parsing the expression, & read more input if unsuccessful 
-      try {
-        // Return AST if successfully parsed an expression
-        parse_input_exp(input+'\n'+tmp_buffer,abstract_syntax_tree);
-        return abstract_syntax_tree;
-      } catch(const READER_ERROR& read_error) {
-        // Continue parsing the current expression/string if incomplete
-        if(is_non_repl_reader_error(read_error)) {
-          input += '\n'+tmp_buffer;
-          if(read_error == READER_ERROR::incomplete_expression) 
-            indent_input(outs);
-        // Alert user if read an invalid expression, then reprompt for input
-        } else {
-          if(!input.empty()) alert_reader_error(outs,read_error,input+'\n'+tmp_buffer);
-          else               alert_reader_error(outs,read_error,tmp_buffer);
-          fputc('\n', outs);
-          if(in_repl) announce_input(outs);
-          abstract_syntax_tree.clear(), input.clear();
-        }
-      // Alert user if detected unparsable input (-:- ANOMALY -:-)
-      } catch(const size_type& read_error_index) {
-        if(!input.empty()) alert_reader_error(outs,read_error_index,input+'\n'+tmp_buffer);
-        else               alert_reader_error(outs,read_error_index,tmp_buffer);
-        fputc('\n', outs);
-        if(in_repl) announce_input(outs);
-        abstract_syntax_tree.clear(), input.clear();
-      }
+      // Scan the new line, & read more input if it didn't close any datums
+      input.feed(tmp_buffer);
+      if(!input.has_complete_datums() && input.in_incomplete_expression())
+        indent_input(outs);
     }
     return abstract_syntax_tree;
   }
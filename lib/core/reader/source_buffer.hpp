@@ -0,0 +1,124 @@
+// Author: Jordan Randleman -- jordanran199@gmail.com -- source_buffer.hpp
+// => Contains the "source_buffer" file view read by the C++ Heist Scheme Interpreter
+// => Regular files are memory-mapped where supported (else read in large
+//    blocks), letting the reader parse file contents w/o copying them
+
+#ifndef HEIST_SCHEME_CORE_READER_SOURCE_BUFFER_HPP_
+#define HEIST_SCHEME_CORE_READER_SOURCE_BUFFER_HPP_
+
+#include <cstring>
+#include <string_view>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #define HEIST_MMAP_SOURCE_FILES
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+namespace heist {
+
+  /******************************************************************************
+  * SOURCE BUFFER
+  ******************************************************************************/
+
+  // Read-only view of a file's contents, from the file's position upon construction
+  struct source_buffer {
+    explicit source_buffer(FILE* fp)noexcept{
+      const long pos = ftell(fp);
+      start = pos < 0 ? 0 : size_type(pos);
+      if(!map_file(fp)) read_file(fp);
+    }
+
+    source_buffer(const source_buffer&) = delete;
+    source_buffer& operator=(const source_buffer&) = delete;
+
+    ~source_buffer()noexcept{
+#ifdef HEIST_MMAP_SOURCE_FILES
+      if(mapping) munmap(mapping,mapping_length);
+#endif
+    }
+
+    // Contents of the file (from its initial position)
+    std::string_view text()const noexcept{return contents;}
+
+    // File position of <text()>'s 1st char
+    size_type offset()const noexcept{return start;}
+
+  private:
+    std::string_view contents;
+    string block_buffer; // file contents if unmapped
+    size_type start = 0;
+    void* mapping = nullptr;
+    size_type mapping_length = 0;
+
+    static constexpr size_type BLOCK_SIZE = 65536;
+
+
+    // Memory-map regular files (pipes, devices, etc. are read in blocks)
+    bool map_file(FILE* fp)noexcept{
+#ifdef HEIST_MMAP_SOURCE_FILES
+      struct stat file_stats;
+      if(fstat(fileno(fp),&file_stats) || !S_ISREG(file_stats.st_mode)) return false;
+      mapping_length = size_type(file_stats.st_size);
+      if(start >= mapping_length) return true; // nothing left to read
+      void* map = mmap(nullptr,mapping_length,PROT_READ,MAP_PRIVATE,fileno(fp),0);
+      if(map == MAP_FAILED) return false;
+      madvise(map,mapping_length,MADV_SEQUENTIAL);
+      mapping = map;
+      contents = std::string_view((const char*)mapping+start,mapping_length-start);
+      return true;
+#else
+      return false;
+#endif
+    }
+
+
+    void read_file(FILE* fp)noexcept{
+      size_type total = 0;
+      for(;;) {
+        block_buffer.resize(total+BLOCK_SIZE);
+        const size_type read_length = fread(block_buffer.data()+total,1,BLOCK_SIZE,fp);
+        total += read_length;
+        if(read_length < BLOCK_SIZE) break;
+      }
+      block_buffer.resize(total);
+      contents = block_buffer;
+    }
+  };
+
+  /******************************************************************************
+  * SEEKABLE FILE IDENTIFICATION
+  ******************************************************************************/
+
+  // Whether <fp> may be viewed via a <source_buffer> then repositioned past
+  //   the text consumed (pipes, sockets, ttys, etc. must be read incrementally)
+  bool is_seekable_file(FILE* fp)noexcept{
+#ifdef HEIST_MMAP_SOURCE_FILES
+    struct stat file_stats;
+    return !fstat(fileno(fp),&file_stats) && S_ISREG(file_stats.st_mode);
+#else
+    return ftell(fp) >= 0;
+#endif
+  }
+
+  /******************************************************************************
+  * BUFFERED LINE READING
+  ******************************************************************************/
+
+  // Reads the rest of <fp>'s current line into <line> (w/o its newline)
+  // => Returns whether found a newline (else reached EOF)
+  bool read_line_from_file(FILE* fp, string& line)noexcept{
+    char block[4096];
+    while(fgets(block,sizeof(block),fp)) {
+      size_type length = strlen(block);
+      if(length && block[length-1] == '\n') {
+        line.append(block,length-1);
+        return true;
+      }
+      line.append(block,length);
+    }
+    return false;
+  }
+}
+
+#endif
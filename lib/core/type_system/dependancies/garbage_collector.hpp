@@ -22,54 +22,67 @@
 // APPROACH: Regular reference counting, w/ any ptr refs > 0 also
 //           having an entry in the GC. Once ref = 0, the entry is 
 //           rm'd from the GC. GC is freed upon exit via a global dtor.
+// NOTE: The ref count & value share a single allocation (a <tgc_block>),
+//       halving the allocations per object (as with <std::make_shared>).
+// NOTE: Blocks track their GC index, thus rm'ing an entry is constant time.
+// NOTE: Each thread has its own GCs (freed upon the thread's exit), & ref 
+//       counts aren't atomic: pointers must NEVER be shared across threads!
 namespace heist {
   namespace GLOBALS {
-    // Avoid <atexit> (may limit capacity to 32 fcns) via a global object dtor
+    // Avoid <atexit> (may limit capacity to 32 fcns) via a thread-local object dtor
     struct tgc_atexit_t {
       std::vector<void(*)(void)> ATEXIT_FUNCTIONS;
       void operator()(void(*f)(void)) noexcept { ATEXIT_FUNCTIONS.push_back(f); }
       ~tgc_atexit_t() noexcept { for(auto f : ATEXIT_FUNCTIONS) f(); }
     };
-    tgc_atexit_t tgc_atexit;
+    thread_local tgc_atexit_t tgc_atexit;
   }
 
   // TGC Pointer Struct
   template<typename VAL_T,std::size_t INIT_TGC_CAPACITY=32,std::size_t TGC_CAPACITY_SCALAR=2>
   struct tgc_ptr {
-    // STATIC TYPED GC INVARIANTS & atexit-FREEING FUNCTION
-    using TGC_ENTRY = std::pair<std::size_t*,VAL_T*>; // ref_count/ptr pairs
-    static std::size_t TGC_CAP, TGC_LEN;
-    static TGC_ENTRY* TYPED_GARBAGE_COLLECTOR;
+    // REF COUNT & VALUE ALLOCATED TOGETHER
+    struct tgc_block {
+      std::size_t ref_count = 1;
+      std::size_t tgc_idx = 0; // index in TYPED_GARBAGE_COLLECTOR
+      VAL_T value;
+      template<typename T>
+      tgc_block(T&& obj)noexcept:value(std::forward<T>(obj)){}
+    };
+
+    // STATIC (PER-THREAD) TYPED GC INVARIANTS & atexit-FREEING FUNCTION
+    using TGC_ENTRY = tgc_block*;
+    static thread_local std::size_t TGC_CAP, TGC_LEN;
+    static thread_local TGC_ENTRY* TYPED_GARBAGE_COLLECTOR;
     static void FREE_TYPED_GARBAGE_COLLECTOR()noexcept{
       TGC_CAP = 0; // SIGNALS GC FREED & DISABLES ALL INDEPENDENT DTORS
       for(std::size_t i = TGC_LEN; i-- > 0;) {
-        delete TYPED_GARBAGE_COLLECTOR[i].first;
-        delete TYPED_GARBAGE_COLLECTOR[i].second;
-        TYPED_GARBAGE_COLLECTOR[i].first = nullptr;
-        TYPED_GARBAGE_COLLECTOR[i].second = nullptr;
+        delete TYPED_GARBAGE_COLLECTOR[i];
+        TYPED_GARBAGE_COLLECTOR[i] = nullptr;
       }
       delete [] TYPED_GARBAGE_COLLECTOR;
       TYPED_GARBAGE_COLLECTOR = nullptr, TGC_LEN = 0;
     }
 
     // INVARIANTS
-    std::size_t* ref_count = nullptr;
-    VAL_T* ptr = nullptr;
+    tgc_block* block = nullptr;
+    VAL_T* ptr = nullptr; // &block->value
 
     // REGISTER & REMOVE PTR FROM TGC
     void register_in_TGC()noexcept{
       // Verify either NOT storing in GC, OR have a proper scalar
       static_assert(INIT_TGC_CAPACITY == 0 || TGC_CAPACITY_SCALAR > 1, 
                     "Cycle-safe pointers reguire a 'TGC_CAPACITY_SCALAR' > 1!");
+      block->tgc_idx = TGC_LEN;
       // Place in GC (most common)
       if(TGC_LEN < TGC_CAP) {
-        TYPED_GARBAGE_COLLECTOR[TGC_LEN++] = TGC_ENTRY(ref_count,ptr);
+        TYPED_GARBAGE_COLLECTOR[TGC_LEN++] = block;
       // Init GC & register the its freeing of members
       } else if(!TGC_CAP) {
         TGC_CAP = INIT_TGC_CAPACITY;
         TYPED_GARBAGE_COLLECTOR = new TGC_ENTRY [TGC_CAP];
         GLOBALS::tgc_atexit(FREE_TYPED_GARBAGE_COLLECTOR);
-        TYPED_GARBAGE_COLLECTOR[TGC_LEN++] = TGC_ENTRY(ref_count,ptr);
+        TYPED_GARBAGE_COLLECTOR[TGC_LEN++] = block;
       // Expand GC size if TGC_LEN == TGC_CAP
       } else {
         TGC_CAP *= TGC_CAPACITY_SCALAR;
@@ -78,53 +91,51 @@ namespace heist {
         for(std::size_t i = 0; i < TGC_LEN; ++i)
           TYPED_GARBAGE_COLLECTOR[i] = std::move(tmp[i]);
         delete [] tmp;
-        TYPED_GARBAGE_COLLECTOR[TGC_LEN++] = TGC_ENTRY(ref_count,ptr);
+        TYPED_GARBAGE_COLLECTOR[TGC_LEN++] = block;
       }
     }
     void deregister_in_TGC()const noexcept{
-      for(std::size_t i = TGC_LEN; i-- > 0;) // optimize search for short ptr lifetimes
-        if(TYPED_GARBAGE_COLLECTOR[i].first == ref_count) {
-          TYPED_GARBAGE_COLLECTOR[i] = std::move(TYPED_GARBAGE_COLLECTOR[--TGC_LEN]);
-          return;
-        }
+      if(!TGC_LEN) return; // GC already freed
+      TGC_ENTRY last = TYPED_GARBAGE_COLLECTOR[--TGC_LEN];
+      TYPED_GARBAGE_COLLECTOR[block->tgc_idx] = last;
+      last->tgc_idx = block->tgc_idx;
     }
 
     // CTORS
     tgc_ptr()noexcept{}
     tgc_ptr(std::nullptr_t)noexcept{}
     tgc_ptr(const VAL_T& obj)noexcept{
-      ptr = new VAL_T(obj);
-      ref_count = new std::size_t(1);
+      block = new tgc_block(obj);
+      ptr = &block->value;
       if constexpr (INIT_TGC_CAPACITY > 0) register_in_TGC();
     }
     tgc_ptr(VAL_T&& obj)noexcept{
-      ptr = new VAL_T(std::move(obj));
-      ref_count = new std::size_t(1);
+      block = new tgc_block(std::move(obj));
+      ptr = &block->value;
       if constexpr (INIT_TGC_CAPACITY > 0) register_in_TGC();
     }
     tgc_ptr(const tgc_ptr& tgc_p)noexcept{
       if(!tgc_p.use_count()) return;
-      ptr = tgc_p.ptr, ref_count = tgc_p.ref_count;
-      ++(*ref_count);
+      ptr = tgc_p.ptr, block = tgc_p.block;
+      ++block->ref_count;
     }
     tgc_ptr(tgc_ptr&& tgc_p)noexcept{ // moves don't increase ref_count
       if(!tgc_p.use_count()) return;
-      ptr = tgc_p.ptr, ref_count = tgc_p.ref_count;
-      tgc_p.ptr = nullptr, tgc_p.ref_count = nullptr;
+      ptr = tgc_p.ptr, block = tgc_p.block;
+      tgc_p.ptr = nullptr, tgc_p.block = nullptr;
     }
 
     // DELETE INNER POINTER (USING REFERENCE COUNTING)
     // NOTE: Never double frees, always safe to call!
     void delete_tgc_ptr()noexcept{
       if(!use_count()) return;
-      if(*ref_count > 1) {
-        --(*ref_count);
+      if(block->ref_count > 1) {
+        --block->ref_count;
       } else { // last obj
         if constexpr (INIT_TGC_CAPACITY > 0) deregister_in_TGC();
-        delete ref_count;
-        delete ptr;
+        delete block;
       }
-      ref_count = nullptr, ptr = nullptr;
+      block = nullptr, ptr = nullptr;
     }
 
     // ASSIGNMENT
@@ -132,18 +143,18 @@ namespace heist {
       if(this == &tgc_p) return;
       delete_tgc_ptr();
       if(!tgc_p.use_count()) return;
-      ptr = tgc_p.ptr, ref_count = tgc_p.ref_count;
-      ++(*ref_count);
+      ptr = tgc_p.ptr, block = tgc_p.block;
+      ++block->ref_count;
     }
     void operator=(tgc_ptr&& tgc_p)noexcept{ // moves don't increase ref_count
       if(this == &tgc_p) return;
       delete_tgc_ptr();
       if(!tgc_p.use_count()) return;
-      ptr = tgc_p.ptr, ref_count = tgc_p.ref_count;
-      tgc_p.ptr = nullptr, tgc_p.ref_count = nullptr;
+      ptr = tgc_p.ptr, block = tgc_p.block;
+      tgc_p.ptr = nullptr, tgc_p.block = nullptr;
     }
 
-    // UNDERLYING POINTER ACCESSORS (PRECONDITION: ref_count && *ref_count > 0)
+    // UNDERLYING POINTER ACCESSORS (PRECONDITION: block && block->ref_count > 0)
     VAL_T& operator*()noexcept{return *ptr;}
     VAL_T* operator->()noexcept{return ptr;}
     const VAL_T& operator*()const noexcept{return *ptr;}
@@ -162,8 +173,8 @@ namespace heist {
 
     // REFCOUNT ACCESSOR
     std::size_t use_count()const noexcept{
-      if(!ref_count) return 0;
-      return *ref_count;
+      if(!block) return 0;
+      return block->ref_count;
     }
 
     // DTOR
@@ -178,10 +189,10 @@ namespace heist {
 
   // Initialize static members of <tgc_ptr>
   template <typename VAL_T,std::size_t INIT_CAP,std::size_t CAP_SCALAR>
-  std::size_t tgc_ptr<VAL_T,INIT_CAP,CAP_SCALAR>::TGC_CAP = 0;
+  thread_local std::size_t tgc_ptr<VAL_T,INIT_CAP,CAP_SCALAR>::TGC_CAP = 0;
   template <typename VAL_T,std::size_t INIT_CAP,std::size_t CAP_SCALAR>
-  std::size_t tgc_ptr<VAL_T,INIT_CAP,CAP_SCALAR>::TGC_LEN = 0;
+  thread_local std::size_t tgc_ptr<VAL_T,INIT_CAP,CAP_SCALAR>::TGC_LEN = 0;
   template <typename VAL_T,std::size_t INIT_CAP,std::size_t CAP_SCALAR>
-  typename tgc_ptr<VAL_T,INIT_CAP,CAP_SCALAR>::TGC_ENTRY* tgc_ptr<VAL_T,INIT_CAP,CAP_SCALAR>::TYPED_GARBAGE_COLLECTOR = nullptr;
+  thread_local typename tgc_ptr<VAL_T,INIT_CAP,CAP_SCALAR>::TGC_ENTRY* tgc_ptr<VAL_T,INIT_CAP,CAP_SCALAR>::TYPED_GARBAGE_COLLECTOR = nullptr;
 } // End of namespace heist
 #endif
\ No newline at end of file
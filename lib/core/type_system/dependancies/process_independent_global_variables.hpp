@@ -4,22 +4,41 @@
 #ifndef HEIST_SCHEME_CORE_PROCESS_INDEPENDENT_GLOBAL_VARIABLES_HPP_
 #define HEIST_SCHEME_CORE_PROCESS_INDEPENDENT_GLOBAL_VARIABLES_HPP_
 
+// => Mutable variables are thread-local, as each thread runs its own universe
+//    (see "spawn-universe")
+
+namespace heist {
+
+  // Frame of an active "catch-jump"/"call/ec" application, linked to the next
+  //   innermost frame on the same stack (see GLOBALS::ESCAPE_FRAMES)
+  struct escape_frame {
+    size_type id;                // 0 for "catch-jump", else its "call/ec" escape procedure's id
+    size_type application_depth; // GLOBALS::APPLICATION_DEPTH upon entering the frame
+    escape_frame* parent;
+  };
+
+}
+
 namespace heist::GLOBALS {
 
   /* EXIT SUCCESS CODE TO RETURN */
-  int HEIST_EXIT_CODE = 0;
+  thread_local int HEIST_EXIT_CODE = 0;
 
 
   /* WHETHER SYMBOLS ARE CASE-SENSITIVE */
-  bool USING_CASE_SENSITIVE_SYMBOLS = true; // see (ci?) primitive
+  thread_local bool USING_CASE_SENSITIVE_SYMBOLS = true; // see (ci?) primitive
 
 
   /* ARGV REGISTRY OF STRINGS */
-  std::vector<str_type> ARGV;
+  thread_local std::vector<str_type> ARGV;
 
 
   /* STACK TRACE */
-  str_vector STACK_TRACE;
+  thread_local str_vector STACK_TRACE;
+
+
+  /* # OF "proto-add-property!" CALLS (INVALIDATES INHERITED PROPERTY INLINE CACHES) */
+  thread_local size_type PROTOTYPE_PROPERTY_ADDITIONS = 0;
 
 
   /* MAX VALUE FOR SIZE_TYPE */
@@ -33,12 +52,19 @@ namespace heist::GLOBALS {
 
 
   /* GLOBAL "JUMP!" PRIMITIVE ARGUMENT STORAGE */
-  data JUMP_GLOBAL_PRIMITIVE_ARGUMENT; // see catch-jump & jump!
+  thread_local data JUMP_GLOBAL_PRIMITIVE_ARGUMENT; // see catch-jump & jump!
+  thread_local size_type JUMP_TARGET = 0; // id of the escape frame being jumped to (0 = innermost catch-jump)
+
+
+  /* STACK-LOCAL ESCAPE STATE (SWAPPED BY EACH COROUTINE'S FIBER, SEE "coroutine_fiber") */
+  thread_local escape_frame* ESCAPE_FRAMES = nullptr; // innermost active escape frame
+  thread_local size_type APPLICATION_DEPTH = 0;       // # of active non-tail compound applications
+  thread_local std::vector<size_type*> RECURSIVE_DEPTHS; // code templates' depths raised by those applications
 
 
   /* REGISTRY OF PRIMITIVES ALSO REQUIRING AN ENVIRONMENT (TO APPLY A PROCEDURE) */
   #ifdef HEIST_SCHEME_CORE_CPP_INTEROP_HPP_ // @EMBEDDED-IN-C++
-    std::vector<prm_ptr_t> USER_DEFINED_PRIMITIVES_REQUIRING_ENV;
+    thread_local std::vector<prm_ptr_t> USER_DEFINED_PRIMITIVES_REQUIRING_ENV; // per-thread, as are interpreters
   #endif
 
 }
@@ -12,10 +12,21 @@ namespace heist {
     string class_name;
     str_vector member_names, method_names;
     data_vector member_values, method_values; // default member values of the proto
+    shp_type instance_shape = nullptr;        // shape shared by new instances (reset by "proto-add-property!")
     void bind_user_ctor(const fcn_type& c)noexcept{
       user_ctor = c;
       user_ctor.name = class_name;
     }
+    const shp_type& get_instance_shape()noexcept{
+      if(!instance_shape) {
+        object_shape shape;
+        shape.member_names = member_names, shape.method_names = method_names;
+        shape.member_names.push_back("prototype");
+        shape.member_names.push_back("super");
+        instance_shape = shp_type(std::move(shape));
+      }
+      return instance_shape;
+    }
   };
 }
 
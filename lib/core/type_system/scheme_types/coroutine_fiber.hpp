@@ -0,0 +1,263 @@
+// Author: Jordan Randleman -- jordanran199@gmail.com -- coroutine_fiber.hpp
+// => Contains "coroutine_fiber" data structure for the C++ Heist Scheme Interpreter
+// => Coroutine fibers run a thunk on their own native stack, hence "yield" simply
+//    switches contexts (rather than CPS-converting coroutine bodies & throwing)
+
+#ifndef HEIST_SCHEME_CORE_COROUTINE_FIBER_HPP_
+#define HEIST_SCHEME_CORE_COROUTINE_FIBER_HPP_
+
+#include <exception>
+
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__) || defined(_WIN64)
+  #define HEIST_WINDOWS_FIBERS
+  #include <windows.h>
+#else
+  #if defined(__APPLE__) && !defined(_XOPEN_SOURCE)
+    #define _XOPEN_SOURCE 600 // exposes the (deprecated) ucontext routines
+  #endif
+  #include <sys/mman.h>
+  #include <ucontext.h>
+  #include <unistd.h>
+#endif
+
+namespace heist {
+
+  // From "lib/core/type_system/dependancies/process_independent_global_variables.hpp"
+  struct escape_frame;
+
+  /******************************************************************************
+  * COROUTINE FIBER STACKS
+  ******************************************************************************/
+
+  // Stacks default to the main thread's usual size, keeping recursion limits the 
+  //   same inside & outside of coroutines. They're mapped w/o reserving swap, hence 
+  //   only touched pages are committed (see the "set-coroutine-stack-size!" primitive).
+  constexpr std::size_t COROUTINE_FIBER_STACK_SIZE = 8 * 1024 * 1024;
+  constexpr std::size_t COROUTINE_FIBER_MIN_STACK_SIZE = 64 * 1024;
+
+#ifndef HEIST_WINDOWS_FIBERS
+  #ifdef MAP_NORESERVE
+    constexpr int COROUTINE_FIBER_MAP_NORESERVE = MAP_NORESERVE;
+  #else
+    constexpr int COROUTINE_FIBER_MAP_NORESERVE = 0;
+  #endif
+  #ifdef MAP_STACK
+    constexpr int COROUTINE_FIBER_MAP_STACK = MAP_STACK;
+  #else
+    constexpr int COROUTINE_FIBER_MAP_STACK = 0;
+  #endif
+#endif
+
+  // Thrown by "yield" in order to unwind the stack of a discarded suspended fiber
+  struct coroutine_fiber_cancellation {};
+
+  // Thrown by a fiber's 1st resumption if the OS refused to allocate its stack
+  struct coroutine_fiber_allocation_failure {};
+
+
+  // Per-thread fiber bookkeeping, w/ a pool of recycled stacks
+  struct coroutine_fiber_runtime {
+    static constexpr std::size_t MAX_POOLED_STACKS = 16;
+    std::size_t stack_size = COROUTINE_FIBER_STACK_SIZE; // of fibers yet to be launched
+#ifdef HEIST_WINDOWS_FIBERS
+    LPVOID thread_fiber = nullptr; // the thread's own fiber (converted upon 1st resume)
+#else
+    std::vector<void*> stacks;     // each of <stack_size> bytes
+#endif
+    void set_stack_size(std::size_t size)noexcept;
+    ~coroutine_fiber_runtime()noexcept;
+  };
+
+  // Once a thread's runtime is destroyed, its fibers are freed w/o being unwound
+  thread_local bool COROUTINE_FIBER_RUNTIME_DESTROYED = false;
+  thread_local coroutine_fiber_runtime COROUTINE_FIBER_RUNTIME;
+
+  // Rounds <size> up to whole pages. Pooled stacks of the old size are freed 
+  //   (launched fibers keep their own)
+  void coroutine_fiber_runtime::set_stack_size(std::size_t size)noexcept{
+#ifndef HEIST_WINDOWS_FIBERS
+    const std::size_t page_size = sysconf(_SC_PAGESIZE);
+    size = (size + page_size - 1) / page_size * page_size;
+    if(size == stack_size) return;
+    for(auto stack : stacks) munmap(stack,stack_size);
+    stacks.clear();
+#endif
+    stack_size = size;
+  }
+
+  coroutine_fiber_runtime::~coroutine_fiber_runtime()noexcept{
+    COROUTINE_FIBER_RUNTIME_DESTROYED = true;
+#ifndef HEIST_WINDOWS_FIBERS
+    for(auto stack : stacks) munmap(stack,stack_size);
+#endif
+  }
+
+  /******************************************************************************
+  * COROUTINE FIBER
+  ******************************************************************************/
+
+  struct coroutine_fiber {
+    enum class status {created, running, suspended, finished};
+
+    using thunk_applicator_t = data(*)(data&);
+
+    data thunk;                         // procedure run by the fiber
+    data transfer;                      // last yielded value, or the thunk's result once finished
+    status state = status::created;
+    bool cancelling = false;            // unwinding a discarded suspended fiber
+    thunk_applicator_t apply_thunk = nullptr;
+    std::exception_ptr exception;       // escaped the thunk (rethrown by the resumer)
+    coroutine_fiber* resumer = nullptr; // running fiber upon resumption (nullptr if none)
+
+    // Stack-local interpreter state: swapped w/ the resumer's by the fiber itself
+    //   whenever it starts/stops running (hence holds the resumer's while running)
+    str_vector stack_trace;
+    escape_frame* escape_frames = nullptr;
+    size_type application_depth = 0;
+    std::vector<size_type*> recursive_depths;
+
+
+    // Construction (the fiber's stack is only allocated upon its 1st resumption)
+    coroutine_fiber(const data& procedure, thunk_applicator_t applicator)noexcept
+      : thunk(procedure), apply_thunk(applicator) {}
+    coroutine_fiber(coroutine_fiber&& f)noexcept
+      : thunk(std::move(f.thunk)), apply_thunk(f.apply_thunk) {} // PRECONDITION: f.state == status::created
+    coroutine_fiber(const coroutine_fiber&) = delete;
+    coroutine_fiber& operator=(const coroutine_fiber&) = delete;
+
+
+    // Discarded suspended fibers are unwound (releasing their stacks' references)
+    ~coroutine_fiber()noexcept{
+      if(state == status::suspended && !COROUTINE_FIBER_RUNTIME_DESTROYED) {
+        cancelling = true;
+        try { resume(); } catch(...) {}
+      }
+      release_stack();
+    }
+
+
+    // The fiber currently running on this thread (nullptr if none)
+    static coroutine_fiber*& running()noexcept{
+      static thread_local coroutine_fiber* running_fiber = nullptr;
+      return running_fiber;
+    }
+
+
+    // Runs the fiber until it yields or finishes, rethrowing any exception it raised
+    //   (throws <coroutine_fiber_allocation_failure> if its stack can't be allocated)
+    // PRECONDITION: state == status::created || state == status::suspended
+    void resume() {
+      if(state == status::created) initialize_context();
+      resumer = running();
+      running() = this;
+      state = status::running;
+      switch_into();
+      running() = resumer;
+      if(state == status::finished) {
+        release_stack();
+        if(exception) std::rethrow_exception(std::exchange(exception,nullptr));
+      }
+    }
+
+
+    // Switches back to the fiber's resumer, until resumed once again
+    // PRECONDITION: running() == this
+    void suspend() {
+      if(cancelling) throw coroutine_fiber_cancellation();
+      state = status::suspended;
+      switch_out();
+      if(cancelling) throw coroutine_fiber_cancellation();
+    }
+
+  private:
+    // Fiber entry point: runs the thunk, then switches out for the last time
+    static void execute()noexcept{
+      auto fiber = running();
+      try {
+        fiber->transfer = fiber->apply_thunk(fiber->thunk);
+      } catch(const coroutine_fiber_cancellation&) {
+      } catch(...) {
+        fiber->exception = std::current_exception();
+      }
+      fiber->thunk = data();
+      fiber->state = status::finished;
+      fiber->switch_out(); // never resumed
+    }
+
+
+#ifdef HEIST_WINDOWS_FIBERS
+    LPVOID handle = nullptr, resumer_handle = nullptr;
+
+    static VOID WINAPI execute_windows_fiber(LPVOID)noexcept{execute();}
+
+    void initialize_context() {
+      auto& runtime = COROUTINE_FIBER_RUNTIME;
+      if(!runtime.thread_fiber)
+        runtime.thread_fiber = IsThreadAFiber() ? GetCurrentFiber() : ConvertThreadToFiber(nullptr);
+      if(!runtime.thread_fiber) throw coroutine_fiber_allocation_failure();
+      handle = CreateFiber(runtime.stack_size,execute_windows_fiber,nullptr);
+      if(!handle) throw coroutine_fiber_allocation_failure();
+    }
+
+    void switch_into()noexcept{
+      resumer_handle = GetCurrentFiber();
+      SwitchToFiber(handle);
+    }
+
+    void switch_out()noexcept{SwitchToFiber(resumer_handle);}
+
+    void release_stack()noexcept{
+      if(handle) DeleteFiber(handle);
+      handle = nullptr;
+    }
+#else
+    ucontext_t context, resumer_context;
+    void* stack = nullptr;
+    std::size_t stack_size = 0;
+
+    // Reuses a pooled stack, else maps a new one w/ a guard page at its end
+    void initialize_context() {
+      auto& runtime = COROUTINE_FIBER_RUNTIME;
+      if(!runtime.stacks.empty()) {
+        stack = runtime.stacks.back();
+        runtime.stacks.pop_back();
+      } else {
+        stack = mmap(nullptr,runtime.stack_size,PROT_READ|PROT_WRITE,
+                     MAP_PRIVATE|MAP_ANON|COROUTINE_FIBER_MAP_NORESERVE|COROUTINE_FIBER_MAP_STACK,-1,0);
+        if(stack == MAP_FAILED) {
+          stack = nullptr;
+          throw coroutine_fiber_allocation_failure();
+        }
+        if(mprotect(stack,size_type(sysconf(_SC_PAGESIZE)),PROT_NONE)) {
+          munmap(stack,runtime.stack_size);
+          stack = nullptr;
+          throw coroutine_fiber_allocation_failure();
+        }
+      }
+      stack_size = runtime.stack_size;
+      getcontext(&context);
+      context.uc_stack.ss_sp = stack;
+      context.uc_stack.ss_size = stack_size;
+      context.uc_link = nullptr;
+      makecontext(&context,execute,0);
+    }
+
+    void switch_into()noexcept{swapcontext(&resumer_context,&context);}
+
+    void switch_out()noexcept{swapcontext(&context,&resumer_context);}
+
+    void release_stack()noexcept{
+      if(!stack) return;
+      auto& runtime = COROUTINE_FIBER_RUNTIME;
+      if(COROUTINE_FIBER_RUNTIME_DESTROYED || stack_size != runtime.stack_size || 
+         runtime.stacks.size() >= coroutine_fiber_runtime::MAX_POOLED_STACKS)
+        munmap(stack,stack_size);
+      else
+        runtime.stacks.push_back(stack);
+      stack = nullptr;
+    }
+#endif
+  };
+}
+
+#endif
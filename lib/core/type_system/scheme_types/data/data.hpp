@@ -12,8 +12,9 @@ namespace heist {
 
   // enum of "struct data"'s union types
   // => expression, pair, number, string, character, symbol, vector, boolean, environment, delay, procedure (compound & primitive),
-  //    input port, output port, does-not-exist, syntax-rules, hash-map, class-prototype, object, process, undefined value
-  enum class types {exp=1, par, num, str, chr, sym, vec, bol, env, del, fcn, fip, fop, dne, syn, map, cls, obj, prc, undefined};
+  //    input port, output port, does-not-exist, syntax-rules, hash-map, class-prototype, object, process, homogeneous vector, 
+  //    coroutine fiber, undefined value
+  enum class types {exp=1, par, num, str, chr, sym, vec, bol, env, del, fcn, fip, fop, dne, syn, map, cls, obj, prc, hvc, fib, undefined};
 
   /******************************************************************************
   * CORE SCHEME OBJECT DATA TYPE STRUCT
@@ -37,8 +38,8 @@ namespace heist {
   //
   // data_obj.is_self_evaluating()  => core evaluator should reflect datum
   //
-  // data_obj.copy()                => deep-cpy vector|string|pair|hmap|object
-  // data_obj.shallow_copy()        => shallow-cpy vector|string|pair|hmap|object
+  // data_obj.copy()                => deep-cpy vector|string|pair|hmap|object|homogeneous-vector
+  // data_obj.shallow_copy()        => shallow-cpy vector|string|pair|hmap|object|homogeneous-vector
   //
   // data_obj.is_falsey()           => <data_obj> is a falsey value
   // data_obj.is_truthy()           => <data_obj> is NOT a falsey value
@@ -68,12 +69,14 @@ namespace heist {
       cls_type cls; // class-prototype smrt ptr
       obj_type obj; // object smrt ptr
       prc_type prc; // process smrt ptr
+      hvc_type hvc; // homogeneous vector smrt ptr
+      fib_type fib; // coroutine fiber smrt ptr
     };
 
-    // returns a deep copy of *this ::= vector | string | pair | hmap | object
+    // returns a deep copy of *this ::= vector | string | pair | hmap | object | homogeneous-vector
     data copy() const;
 
-    // returns a shallow copy of *this ::= vector | string | pair | hmap | object
+    // returns a shallow copy of *this ::= vector | string | pair | hmap | object | homogeneous-vector
     data shallow_copy() const;
 
     // assignment operator
@@ -131,6 +134,8 @@ namespace heist {
     data(const cls_type& new_value) noexcept : type(types::cls), cls(new_value) {}
     data(const obj_type& new_value) noexcept : type(types::obj), obj(new_value) {}
     data(const prc_type& new_value) noexcept : type(types::prc), prc(new_value) {}
+    data(const hvc_type& new_value) noexcept : type(types::hvc), hvc(new_value) {}
+    data(const fib_type& new_value) noexcept : type(types::fib), fib(new_value) {}
 
     data(par_type&& new_value) noexcept : type(types::par), par(std::move(new_value)) {}
     data(str_type&& new_value) noexcept : type(types::str), str(std::move(new_value)) {}
@@ -150,6 +155,8 @@ namespace heist {
     data(cls_type&& new_value) noexcept : type(types::cls), cls(std::move(new_value)) {}
     data(obj_type&& new_value) noexcept : type(types::obj), obj(std::move(new_value)) {}
     data(prc_type&& new_value) noexcept : type(types::prc), prc(std::move(new_value)) {}
+    data(hvc_type&& new_value) noexcept : type(types::hvc), hvc(std::move(new_value)) {}
+    data(fib_type&& new_value) noexcept : type(types::fib), fib(std::move(new_value)) {}
 
     data(const types& t) noexcept : type(t) {} // to set 'dne
     data(types&& t)      noexcept : type(t) {} // to set 'dne
@@ -40,6 +40,8 @@ namespace heist {
       case types::cls: new (this) data(d.cls); return;
       case types::obj: new (this) data(d.obj); return;
       case types::prc: new (this) data(d.prc); return;
+      case types::hvc: new (this) data(d.hvc); return;
+      case types::fib: new (this) data(d.fib); return;
       case types::dne: new (this) data(d.type);return;
       default:         new (this) data();      return; // types::undefined
     }
@@ -67,6 +69,8 @@ namespace heist {
       case types::cls: new (this) data(std::move(d.cls)); return;
       case types::obj: new (this) data(std::move(d.obj)); return;
       case types::prc: new (this) data(std::move(d.prc)); return;
+      case types::hvc: new (this) data(std::move(d.hvc)); return;
+      case types::fib: new (this) data(std::move(d.fib)); return;
       case types::dne: new (this) data(d.type);           return;
       default:         new (this) data();                 return; // types::undefined
     }
@@ -96,6 +100,8 @@ namespace heist {
       case types::cls: cls.~cls_type(); return;
       case types::obj: obj.~obj_type(); return;
       case types::prc: prc.~prc_type(); return;
+      case types::hvc: hvc.~hvc_type(); return;
+      case types::fib: fib.~fib_type(); return;
       default: return; // types::undefined, types::dne 
     }
   }
@@ -126,6 +132,8 @@ namespace heist {
         case types::cls: cls = std::move(d.cls); return;
         case types::obj: obj = std::move(d.obj); return;
         case types::prc: prc = std::move(d.prc); return;
+        case types::hvc: hvc = std::move(d.hvc); return;
+        case types::fib: fib = std::move(d.fib); return;
         default:                                 return;
       }
     } else {
@@ -149,6 +157,8 @@ namespace heist {
         case types::cls: new (this) data(std::move(d.cls)); return;
         case types::obj: new (this) data(std::move(d.obj)); return;
         case types::prc: new (this) data(std::move(d.prc)); return;
+        case types::hvc: new (this) data(std::move(d.hvc)); return;
+        case types::fib: new (this) data(std::move(d.fib)); return;
         case types::dne: new (this) data(d.type);           return;
         default:         new (this) data();                 return; // types::undefined
       }
@@ -212,11 +222,13 @@ namespace heist {
       case types::obj: return "#<object[0x"+pointer_to_hexstring(obj.ptr)+"]>";
       case types::env: return "#<environment[0x"+pointer_to_hexstring(env.ptr)+"]>";
       case types::prc: return "#<process-invariants[0x"+pointer_to_hexstring(prc.ptr)+"]>";
+      case types::fib: return "#<coroutine-fiber[0x"+pointer_to_hexstring(fib.ptr)+"]>";
       case types::del: return "#<delay[0x"+pointer_to_hexstring(del.ptr)+"]>";
       case types::fip: return fip.str();
       case types::fop: return fop.str();
       case types::dne: return "";
       case types::syn: return syn.str();
+      case types::hvc: return hvc->str();
       case types::par: return stringify_list<&data::noexcept_write>(*this);
       case types::vec: return stringify_vect<&data::noexcept_write>(vec);
       case types::exp: return stringify_expr<&data::noexcept_write>(exp);
@@ -279,6 +291,8 @@ namespace heist {
       case types::cls: return "0x" + pointer_to_hexstring(cls.ptr);
       case types::obj: return "0x" + pointer_to_hexstring(obj.ptr);
       case types::prc: return "0x" + pointer_to_hexstring(prc.ptr);
+      case types::hvc: return "0x" + pointer_to_hexstring(hvc.ptr);
+      case types::fib: return "0x" + pointer_to_hexstring(fib.ptr);
       case types::fip: return "0x" + pointer_to_hexstring(fip.fp.ptr);
       case types::fop: return "0x" + pointer_to_hexstring(fop.fp.ptr);
       default: return "";
@@ -293,7 +307,8 @@ namespace heist {
     static const char * const type_names[] = {
       "null", "expression", "pair", "number", "string", "character", "symbol", "vector",
       "boolean", "environment", "delay", "procedure", "input-port", "output-port", "void", 
-      "syntax-rules", "hash-map", "class-prototype", "object", "process-invariants", "undefined"
+      "syntax-rules", "hash-map", "class-prototype", "object", "process-invariants", 
+      "homogeneous-vector", "coroutine-fiber", "undefined"
     };
     return type_names[int(type) * (type!=types::sym || sym[0])]; // idx 0 for '() typename
   }
@@ -312,6 +327,7 @@ namespace heist {
       case types::map: return prm_compare_HMAPs<&data::noexcept_equal>(map,d.map);
       case types::obj: return prm_compare_OBJs<&data::noexcept_equal>(obj,d.obj);
       case types::str: return *d.str == *str;
+      case types::hvc: return *d.hvc == *hvc;
       default:         return eq(d);
     }
   }
@@ -329,6 +345,7 @@ namespace heist {
       case types::map: return prm_compare_HMAPs<&data::equal>(map,d.map);
       case types::obj: return prm_compare_OBJs <&data::equal>(obj,d.obj);
       case types::str: return *d.str == *str;
+      case types::hvc: return *d.hvc == *hvc;
       default: return eq(d);
     }
   }
@@ -346,6 +363,7 @@ namespace heist {
       case types::map: return prm_compare_HMAPs<&data::eq>(map,d.map);
       case types::obj: return prm_compare_OBJs <&data::eq>(obj,d.obj);
       case types::str: return *d.str == *str;
+      case types::hvc: return *d.hvc == *hvc;
       default: return eq(d);
     }
   }
@@ -375,6 +393,8 @@ namespace heist {
       case types::syn: return d.syn == syn;
       case types::cls: return d.cls == cls;
       case types::prc: return d.prc == prc;
+      case types::hvc: return d.hvc == hvc;
+      case types::fib: return d.fib == fib;
       default:         return true; // types::undefined, types::dne
     }
   }
@@ -384,7 +404,7 @@ namespace heist {
   ******************************************************************************/
 
   // struct data METHODS
-  // returns a deep copy of *this ::= vector | string | pair | hmap | object
+  // returns a deep copy of *this ::= vector | string | pair | hmap | object | homogeneous-vector
   data data::copy() const {
     map_object m;
     data_vector new_vec;
@@ -400,12 +420,13 @@ namespace heist {
         for(const auto& keyval : map->val)
           m.val[keyval.first] = keyval.second.copy();
         return map_type(std::move(m));
+      case types::hvc: return hvc_type(*hvc);
       default: return *this;
     }
   }
 
 
-  // returns a shallow copy of *this ::= vector | string | pair | hmap | object
+  // returns a shallow copy of *this ::= vector | string | pair | hmap | object | homogeneous-vector
   data data::shallow_copy() const {
     map_object m;
     data_vector new_vec;
@@ -415,6 +436,7 @@ namespace heist {
       case types::obj: return shallow_copy_obj(*this);
       case types::vec: return vec_type(*vec);
       case types::map: return map_type(*map);
+      case types::hvc: return hvc_type(*hvc);
       default: return *this;
     }
   }
@@ -104,15 +104,15 @@ data deep_copy_pair(const data& d) {
 // Search methods for the "self->copy" copying method
 bool dynamic_object_copy(obj_type obj, data& result) {
   // search object's local members
-  for(size_type i = 0, n = obj->method_names.size(); i < n; ++i)
-    if(obj->method_names[i] == "self->copy") {
+  for(size_type i = 0, n = obj->method_names().size(); i < n; ++i)
+    if(obj->method_names()[i] == "self->copy") {
       result = apply_dynamic_method(obj,data_vector(),obj->method_values[i].fcn);
       return true;
     }
   // search object's prototype
   for(size_type i = 0, n = obj->proto->method_names.size(); i < n; ++i) {
     if(obj->proto->method_names[i] == "self->copy") {
-      obj->method_names.push_back(obj->proto->method_names[i]), obj->method_values.push_back(obj->proto->method_values[i]);
+      obj->add_method(obj->proto->method_names[i],obj->proto->method_values[i]);
       result = apply_dynamic_method(obj,data_vector(),obj->method_values[i].fcn);
       return true;
     }
@@ -130,8 +130,7 @@ data deep_copy_obj(const data& d) {
   data result;
   if(dynamic_object_copy(d.obj,result)) return result;
   // apply the default object copying mechanism
-  o.member_names = d.obj->member_names;
-  o.method_names = d.obj->method_names;
+  o.shape = d.obj->shape;
   for(const auto& member_val : d.obj->member_values)
     o.member_values.push_back(member_val.copy());
   for(const auto& method_val : d.obj->method_values)
@@ -162,8 +161,7 @@ data shallow_copy_obj(const data& d) {
   o.proto = d.obj->proto; // shallow copy the prototype (these are never deep copied!)
   if(o.super) o.super = shallow_copy_obj(make_obj(*o.super)).obj;
   // apply the default object copying mechanism
-  o.member_names = d.obj->member_names;
-  o.method_names = d.obj->method_names;
+  o.shape = d.obj->shape;
   for(const auto& member_val : d.obj->member_values)
     o.member_values.push_back(member_val);
   for(const auto& method_val : d.obj->method_values)
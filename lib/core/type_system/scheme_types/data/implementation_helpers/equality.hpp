@@ -121,14 +121,13 @@ bool prm_compare_HMAPs(const map_type& m1, const map_type& m2) {
 template<DATA_COMPARER same_as>
 bool prm_compare_OBJs(const obj_type& o1, const obj_type& o2) {
   if(o1->proto != o2->proto                               ||
-     o1->member_names.size()  != o2->member_names.size()  || 
      o1->member_values.size() != o2->member_values.size() || 
-     o1->method_names.size()  != o2->method_names.size()  || 
      o1->method_values.size() != o2->method_values.size()) return false;
-  for(size_type i = 0, n = o1->member_names.size(); i < n; ++i)
-    if(o1->member_names[i] != o2->member_names[i]) return false;
-  for(size_type i = 0, n = o1->method_names.size(); i < n; ++i) // methods ONLY compared by name
-    if(o1->method_names[i] != o2->method_names[i]) return false;
+  // objects sharing a shape have the same property names
+  if(o1->shape != o2->shape) {
+    if(o1->member_names() != o2->member_names()) return false;
+    if(o1->method_names() != o2->method_names()) return false; // methods ONLY compared by name
+  }
   for(size_type i = 0, n = o1->member_values.size(); i < n; ++i)
     if(!(o1->member_values[i].*same_as)(o2->member_values[i])) return false;
   return true;
@@ -144,8 +143,8 @@ bool prm_DYNAMIC_OBJeq(const obj_type& object,const data& rhs,const char* eq_nam
   obj_type obj = object;
   while(obj) {
     // search object's local members
-    for(size_type i = 0, n = obj->method_names.size(); i < n; ++i) {
-      if(obj->method_names[i] == "self=" || obj->method_names[i] == eq_name) {
+    for(size_type i = 0, n = obj->method_names().size(); i < n; ++i) {
+      if(obj->method_names()[i] == "self=" || obj->method_names()[i] == eq_name) {
         data eq_result = apply_dynamic_method(obj,data_vector(1,rhs),obj->method_values[i].fcn);
         result = eq_result.is_truthy();
         return true;
@@ -154,7 +153,7 @@ bool prm_DYNAMIC_OBJeq(const obj_type& object,const data& rhs,const char* eq_nam
     // search object's prototype
     for(size_type i = 0, n = obj->proto->method_names.size(); i < n; ++i) {
       if(obj->proto->method_names[i] == "self=" || obj->proto->method_names[i] == eq_name) {
-        obj->method_names.push_back(obj->proto->method_names[i]), obj->method_values.push_back(obj->proto->method_values[i]);
+        obj->add_method(obj->proto->method_names[i],obj->proto->method_values[i]);
         data eq_result = apply_dynamic_method(obj,data_vector(1,rhs),obj->method_values[i].fcn);
         result = eq_result.is_truthy();
         return true;
@@ -145,6 +145,47 @@ string pointer_to_hexstring(const T raw_ptr)noexcept{
   return str;
 }
 
+/******************************************************************************
+* IN-PLACE CONTAINER STRINGIFICATION DISPATCH
+******************************************************************************/
+
+// Container stringifiers append to a single buffer (rather than returning
+// strings to be re-copied at each level of nesting) to remain linear-time
+
+template<DATA_STRINGIFIER to_str>
+void stringify_list_into(string& buffer, const data& pair_object);
+template<DATA_STRINGIFIER to_str>
+void stringify_vect_into(string& buffer, const vec_type& vector_object);
+template<DATA_STRINGIFIER to_str>
+void stringify_expr_rec(const exp_type& exp_object, string& exp_str);
+template<DATA_STRINGIFIER to_str>
+void stringify_hmap_into(string& buffer, const map_type& map_object);
+
+
+// Appends the stringification of <d> to <buffer>
+template<DATA_STRINGIFIER to_str>
+void stringify_into(string& buffer, const data& d) {
+  switch(d.type) {
+    case types::par:
+      if constexpr (to_str == &data::pprint) break; // pairs are pretty-printed as a whole
+      stringify_list_into<to_str>(buffer,d);
+      return;
+    case types::vec:
+      stringify_vect_into<to_str>(buffer,d.vec);
+      return;
+    case types::exp:
+      buffer += '(';
+      stringify_expr_rec<to_str>(d.exp,buffer);
+      buffer += ')';
+      return;
+    case types::map:
+      stringify_hmap_into<to_str>(buffer,d.map);
+      return;
+    default: break;
+  }
+  buffer += (d.*to_str)();
+}
+
 /******************************************************************************
 * LIST STRINGIFICATION HELPER FUNCTIONS
 ******************************************************************************/
@@ -172,7 +213,7 @@ void cio_acyclic_list_str_recur(string& list_str, const data& pair_object) {
       list_str += ')';
     }
   } else {
-    list_str += (pair_object.par->first.*to_str)();
+    stringify_into<to_str>(list_str, pair_object.par->first);
   }
   // store space if not last item in list
   if(is_not_THE_EMPTY_LIST(pair_object.par->second)) list_str += ' ';
@@ -182,7 +223,9 @@ void cio_acyclic_list_str_recur(string& list_str, const data& pair_object) {
     cio_acyclic_list_str_recur<to_str>(list_str, pair_object.par->second);
   } else if(is_not_THE_EMPTY_LIST(pair_object.par->second)){// don't store last '()
     // store ' . ' since not a null-terminated list
-    list_str += G.dot + ' ' + (pair_object.par->second.*to_str)();
+    list_str += G.dot;
+    list_str += ' ';
+    stringify_into<to_str>(list_str, pair_object.par->second);
   }
 }
 
@@ -209,7 +252,7 @@ void stringify_list_recur(string& list_str, const data& slow, const data& fast,
       list_str += ')';
     }
   } else {
-    list_str += (slow.par->first.*to_str)();
+    stringify_into<to_str>(list_str, slow.par->first);
   }
   // store space if not last item in list
   if(is_not_THE_EMPTY_LIST(slow.par->second)) list_str += ' ';
@@ -224,18 +267,30 @@ void stringify_list_recur(string& list_str, const data& slow, const data& fast,
       cio_acyclic_list_str_recur<to_str>(list_str, slow.par->second);
   } else if(is_not_THE_EMPTY_LIST(slow.par->second)){// don't store last '()
     // store ' . ' since not a null-terminated list
-    list_str += G.dot + ' ' + (slow.par->second.*to_str)();
+    list_str += G.dot;
+    list_str += ' ';
+    stringify_into<to_str>(list_str, slow.par->second);
   }
 }
 
 
 // Stringify list
+template<DATA_STRINGIFIER to_str>
+void stringify_list_into(string& buffer, const data& pair_object) {
+  if(stdlib_streams::data_is_stream_pair(pair_object)) {
+    buffer += "#<stream>";
+    return;
+  }
+  buffer += '(';
+  stringify_list_recur<to_str>(buffer, pair_object.par, pair_object.par, nullptr);
+  buffer += ')';
+}
+
 template<DATA_STRINGIFIER to_str>
 string stringify_list(const data& pair_object) {
-  if(stdlib_streams::data_is_stream_pair(pair_object)) return "#<stream>";
   string list_str;
-  stringify_list_recur<to_str>(list_str, pair_object.par, pair_object.par, nullptr);
-  return '(' + list_str + ')';
+  stringify_list_into<to_str>(list_str, pair_object);
+  return list_str;
 }
 
 /******************************************************************************
@@ -244,16 +299,20 @@ string stringify_list(const data& pair_object) {
 
 // Stringify vector
 template<DATA_STRINGIFIER to_str>
-string stringify_vect(const vec_type& vector_object) {
-  string vect_str("#(");
+void stringify_vect_into(string& buffer, const vec_type& vector_object) {
+  buffer += "#(";
   for(size_type i = 0, n = vector_object->size(); i < n; ++i) {
-    if(vector_object->operator[](i).is_type(types::vec))
-      vect_str += stringify_vect<to_str>(vector_object->operator[](i).vec);
-    else
-      vect_str += (vector_object->operator[](i).*to_str)();
-    if(i < n-1) vect_str +=  ' ';
+    stringify_into<to_str>(buffer, vector_object->operator[](i));
+    if(i < n-1) buffer +=  ' ';
   }
-  return vect_str + ')';
+  buffer += ')';
+}
+
+template<DATA_STRINGIFIER to_str>
+string stringify_vect(const vec_type& vector_object) {
+  string vect_str;
+  stringify_vect_into<to_str>(vect_str, vector_object);
+  return vect_str;
 }
 
 /******************************************************************************
@@ -272,7 +331,7 @@ void stringify_expr_rec(const exp_type& exp_object, string& exp_str) {
       exp_str += ')';
     // Append atomic data
     } else {
-      exp_str += ((*d).*to_str)();
+      stringify_into<to_str>(exp_str, *d);
     }
     // Add a space if not at the end of the current expression
     if(d+1 != end) exp_str += ' ';
@@ -283,9 +342,10 @@ void stringify_expr_rec(const exp_type& exp_object, string& exp_str) {
 // Stringify expression
 template<DATA_STRINGIFIER to_str>
 string stringify_expr(const exp_type& exp_object) {
-  string exp_str;
+  string exp_str(1,'(');
   stringify_expr_rec<to_str>(exp_object, exp_str);
-  return '(' + exp_str + ')';
+  exp_str += ')';
+  return exp_str;
 }
 
 /******************************************************************************
@@ -294,14 +354,25 @@ string stringify_expr(const exp_type& exp_object) {
 
 // Stringify hash-map
 template<DATA_STRINGIFIER to_str>
-string stringify_hmap(const map_type& map_object) {
-  string map_str("$(");
-  for(const auto& keyval : map_object->val)
-    map_str += (map_object::unhash_key(keyval.first).*to_str)() + ' ' + (keyval.second.*to_str)() + ' ';
-  if(map_str.size() > 2)
-    *map_str.rbegin() = ')';
+void stringify_hmap_into(string& buffer, const map_type& map_object) {
+  buffer += "$(";
+  const auto start = buffer.size();
+  for(const auto& keyval : map_object->val) {
+    stringify_into<to_str>(buffer, map_object::unhash_key(keyval.first));
+    buffer += ' ';
+    stringify_into<to_str>(buffer, keyval.second);
+    buffer += ' ';
+  }
+  if(buffer.size() > start)
+    *buffer.rbegin() = ')';
   else
-    map_str.push_back(')');
+    buffer.push_back(')');
+}
+
+template<DATA_STRINGIFIER to_str>
+string stringify_hmap(const map_type& map_object) {
+  string map_str;
+  stringify_hmap_into<to_str>(map_str, map_object);
   return map_str;
 }
 
@@ -482,8 +553,8 @@ string stringify_obj(const obj_type& object,const char* printer_name) {
   obj_type obj = object;
   while(obj) {
     // search object's local members
-    for(size_type i = 0, n = obj->method_names.size(); i < n; ++i) {
-      if(obj->method_names[i] == "self->string" || obj->method_names[i] == printer_name) {
+    for(size_type i = 0, n = obj->method_names().size(); i < n; ++i) {
+      if(obj->method_names()[i] == "self->string" || obj->method_names()[i] == printer_name) {
         data result = apply_dynamic_method(obj,data_vector(),obj->method_values[i].fcn);
         if(result.is_type(types::str)) return *result.str;
         return (result.*to_str)();
@@ -492,7 +563,7 @@ string stringify_obj(const obj_type& object,const char* printer_name) {
     // search object's prototype
     for(size_type i = 0, n = obj->proto->method_names.size(); i < n; ++i) {
       if(obj->proto->method_names[i] == "self->string" || obj->proto->method_names[i] == printer_name) {
-        obj->method_names.push_back(obj->proto->method_names[i]), obj->method_values.push_back(obj->proto->method_values[i]);
+        obj->add_method(obj->proto->method_names[i],obj->proto->method_values[i]);
         data result = apply_dynamic_method(obj,data_vector(),obj->method_values[i].fcn);
         if(result.is_type(types::str)) return *result.str;
         return (result.*to_str)();
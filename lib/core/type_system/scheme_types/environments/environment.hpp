@@ -27,6 +27,8 @@ namespace heist {
     // Invariants
     tgc_ptr<environment> parent = nullptr; // enclosing environment pointer
     frame_type frame;                      // environment's bindings
+    obj_type self = nullptr;               // "self" binding of method application frames
+    bool frozen = false;                   // shared universe snapshot (see "snapshot_overlay")
 
     // Getters
     frame_objs& objects()noexcept{return frame.first;}
@@ -48,6 +50,19 @@ namespace heist {
     // Extract & Verify Macro Label
     static string macro_label(const frame_mac& mac)noexcept;
     static bool macro_has_label(const frame_mac& mac, const string& label)noexcept;
+    static bool frame_has_macro(const frame_macs& macs, const string& label)noexcept;
+    static bool erase_frame_macro(frame_macs& macs, const string& label)noexcept;
+
+    // Frozen Universe Snapshot Layering
+    environment* snapshot_overlay()const noexcept;
+    bool snapshot_erased_variable(const frame_var& var)const noexcept;
+    bool snapshot_erased_macro(const string& label)const noexcept;
+
+  private:
+    bool binds_self_slot(const frame_var& var)const noexcept{return self && var == "self";}
+    void move_self_slot_into_frame(const frame_var& var)noexcept;
+    environment* snapshot_write_target()noexcept;
+    frame_val lookup_snapshot_variable_value(const frame_var& var, bool& found)const noexcept;
   };
 
   /******************************************************************************
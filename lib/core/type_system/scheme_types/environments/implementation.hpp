@@ -13,6 +13,11 @@ namespace heist {
   ******************************************************************************/
 
   frame_val environment::lookup_variable_value(const frame_var& var, bool& found)const noexcept{
+    if(frozen) return lookup_snapshot_variable_value(var,found);
+    if(binds_self_slot(var)) {
+      found = true;
+      return self;
+    }
     const auto& objs = objects();
     if(const auto pos = objs.find(var); pos != objs.end()) {
       found = true;
@@ -28,6 +33,15 @@ namespace heist {
   ******************************************************************************/
 
   bool environment::set_variable_value(const frame_var& var, frame_val&& val)noexcept{
+    if(frozen) {
+      if(auto overlay = snapshot_overlay(); overlay && overlay->objects().count(var))
+        return overlay->set_variable_value(var,std::move(val));
+      if(!objects().count(var) || snapshot_erased_variable(var))
+        return parent && parent->set_variable_value(var,std::move(val));
+      snapshot_write_target()->define_variable(var,std::move(val)); // copy-on-write
+      return true;
+    }
+    move_self_slot_into_frame(var);
     auto& objs = objects();
     if(auto pos = objs.find(var); pos != objs.end()) {
       if(val.is_type(types::fcn) && val.fcn.name.empty()) val.fcn.name = var;
@@ -42,13 +56,18 @@ namespace heist {
   ******************************************************************************/
 
   void environment::define_variable(const frame_var& var, frame_val val)noexcept{
+    if(frozen) if(auto target = snapshot_write_target(); target != this)
+      return target->define_variable(var,std::move(val));
     // binding anonymous procedures -> named procedure
     if(val.is_type(types::fcn) && val.fcn.name.empty()) val.fcn.name = var;
+    move_self_slot_into_frame(var);
     objects()[var] = std::move(val);
   }
 
 
   void environment::define_macro(const frame_mac& mac_val)noexcept{
+    if(frozen) if(auto target = snapshot_write_target(); target != this)
+      return target->define_macro(mac_val);
     // extract macro name (either a syntax-rules-object or a syntax-transformer-procedure)
     const auto& mac_name = mac_val.is_type(types::syn) ? mac_val.syn.label : mac_val.fcn.name;
     auto& macs = macros();
@@ -66,6 +85,14 @@ namespace heist {
   ******************************************************************************/
 
   string environment::getenv(const frame_var& var, bool& found)const{
+    if(frozen) {
+      const auto val = lookup_snapshot_variable_value(var,found);
+      return found ? val.write() : "";
+    }
+    if(binds_self_slot(var)) {
+      found = true;
+      return data(self).write();
+    }
     const auto& objs = objects();
     if(const auto pos = objs.find(var); pos != objs.end()) {
       found = true;
@@ -81,14 +108,21 @@ namespace heist {
   ******************************************************************************/
 
   bool environment::has_macro(const string& label)const noexcept{
-    for(const auto& mac : macros())
-      if(macro_has_label(mac,label)) return true;
-    return parent && parent->has_macro(label);
+    if(frozen) {
+      if(auto overlay = snapshot_overlay(); overlay && frame_has_macro(overlay->macros(),label)) return true;
+      if(snapshot_erased_macro(label)) return parent && parent->has_macro(label);
+    }
+    return frame_has_macro(macros(),label) || (parent && parent->has_macro(label));
   }
 
 
   bool environment::has_variable(const frame_var& var)const noexcept{
-    return objects().count(var) || (parent && parent->has_variable(var));
+    if(frozen) {
+      bool found = false;
+      lookup_snapshot_variable_value(var,found);
+      return found;
+    }
+    return binds_self_slot(var) || objects().count(var) || (parent && parent->has_variable(var));
   }
 
   /******************************************************************************
@@ -97,20 +131,128 @@ namespace heist {
 
   // Returns whether found
   bool environment::erase_variable(const frame_var& var)noexcept{
-    return objects().erase(var) || (parent && parent->erase_variable(var));
+    if(frozen) {
+      auto overlay = snapshot_overlay();
+      const bool erased_from_overlay = overlay && overlay->objects().erase(var);
+      if(!objects().count(var) || snapshot_erased_variable(var))
+        return erased_from_overlay || (parent && parent->erase_variable(var));
+      G.ERASED_SNAPSHOT_VARIABLES.push_back(var);
+      return true;
+    }
+    move_self_slot_into_frame(var);
+    if(objects().erase(var)) {
+      // deleting a snapshot binding the universe redefined deletes it entirely
+      if(parent && parent->frozen && parent->snapshot_overlay() == this) parent->erase_variable(var);
+      return true;
+    }
+    return parent && parent->erase_variable(var);
   }
 
 
   // Returns whether found
   bool environment::erase_macro(const string& label)noexcept{
-    auto& macs = macros();
+    if(frozen) {
+      auto overlay = snapshot_overlay();
+      const bool erased_from_overlay = overlay && erase_frame_macro(overlay->macros(),label);
+      if(snapshot_erased_macro(label) || !frame_has_macro(macros(),label))
+        return erased_from_overlay || (parent && parent->erase_macro(label));
+      G.ERASED_SNAPSHOT_MACROS.push_back(label);
+      return true;
+    }
+    if(erase_frame_macro(macros(),label)) {
+      // deleting a snapshot macro the universe redefined deletes it entirely
+      if(parent && parent->frozen && parent->snapshot_overlay() == this) parent->erase_macro(label);
+      return true;
+    }
+    return parent && parent->erase_macro(label);
+  }
+
+
+  bool environment::frame_has_macro(const frame_macs& macs, const string& label)noexcept{
+    for(const auto& mac : macs)
+      if(macro_has_label(mac,label)) return true;
+    return false;
+  }
+
+
+  bool environment::erase_frame_macro(frame_macs& macs, const string& label)noexcept{
     for(size_type i = 0, n = macs.size(); i < n; ++i) {
       if(macro_has_label(macs[i],label)) {
         macs.erase(macs.begin()+i);
         return true;
       }
     }
-    return parent && parent->erase_macro(label);
+    return false;
+  }
+
+  /******************************************************************************
+  * ENVIRONMENT FROZEN UNIVERSE SNAPSHOT
+  ******************************************************************************/
+
+  // Fresh universes share a frozen snapshot of the booted global environment: 
+  //   each layers its own (initially empty) global frame atop the snapshot's.
+  //   Frozen frames are never mutated, hence their stdlib procedures resolve 
+  //   globals against the running universe's frame 1st, writes to (& definitions 
+  //   in) them land in said frame, & deletions are recorded by its invariants.
+
+  // Returns the running universe's global environment if layered atop <this>
+  environment* environment::snapshot_overlay()const noexcept{
+    const auto& global = G.GLOBAL_ENVIRONMENT_POINTER;
+    return global && global->parent.ptr == this ? global.ptr : nullptr;
+  }
+
+
+  // Returns the environment that writes to <this> frame's bindings land in
+  environment* environment::snapshot_write_target()noexcept{
+    if(!frozen) return this;
+    if(auto overlay = snapshot_overlay()) return overlay;
+    const auto& global = G.GLOBAL_ENVIRONMENT_POINTER;
+    return global && !global->frozen ? global.ptr : this;
+  }
+
+
+  bool environment::snapshot_erased_variable(const frame_var& var)const noexcept{
+    const auto& erased = G.ERASED_SNAPSHOT_VARIABLES;
+    return frozen && !erased.empty() && std::find(erased.begin(),erased.end(),var) != erased.end();
+  }
+
+
+  bool environment::snapshot_erased_macro(const string& label)const noexcept{
+    const auto& erased = G.ERASED_SNAPSHOT_MACROS;
+    return frozen && !erased.empty() && std::find(erased.begin(),erased.end(),label) != erased.end();
+  }
+
+
+  frame_val environment::lookup_snapshot_variable_value(const frame_var& var, bool& found)const noexcept{
+    if(auto overlay = snapshot_overlay()) {
+      const auto& objs = overlay->objects();
+      if(const auto pos = objs.find(var); pos != objs.end()) {
+        found = true;
+        return pos->second;
+      }
+    }
+    if(!snapshot_erased_variable(var)) {
+      const auto& objs = objects();
+      if(const auto pos = objs.find(var); pos != objs.end()) {
+        found = true;
+        return pos->second;
+      }
+    }
+    if(parent) return parent->lookup_variable_value(var,found);
+    found = false;
+    return frame_val();
+  }
+
+  /******************************************************************************
+  * ENVIRONMENT "self" SLOT
+  ******************************************************************************/
+
+  // Methods bind "self" in a slot (rather than hashing it into the frame), 
+  //   which is moved into the frame's bindings once <var> mutates it
+  void environment::move_self_slot_into_frame(const frame_var& var)noexcept{
+    if(!binds_self_slot(var)) return;
+    objects()[var] = std::move(self);
+    self = nullptr;
   }
 
   /******************************************************************************
@@ -58,28 +58,32 @@ namespace heist {
 
   struct function_object {
 
-    // Type alias for the current recursive depth
-    using depth_type = tgc_ptr<size_type,0>;
-
-    
     // Type alias for params/stats pair
     using params_type = std::pair<data_vector,param_stats>;
 
 
+    // Immutable code of a lambda/fn expression, shared by every closure it creates (& their copies)
+    struct code_template {
+      std::vector<params_type> param_instances;
+      std::vector<exe_fcn_t> bodies;
+      size_type recursive_depth = 0; // # of active non-tail applications (only mutable member)
+    };
+    using code_type = tgc_ptr<code_template,0>;
+
+
     // General invariants (applies to both primitives & compound procedures)
     string name; // name == "" denotes an anonymous procedure
-    std::vector<params_type> param_instances;
+    code_type code = nullptr; // partial primitives' bound args are its "param_instances"
 
 
     // Primitive function pointer invariant
     prm_ptr_t prm = nullptr;
 
 
-    // Compound function invariants
-    std::vector<exe_fcn_t> bodies;
+    // Compound function invariants (per-closure)
     env_type env = nullptr ;
     obj_type self = nullptr;
-    depth_type rec_depth = nullptr;
+    const exe_fcn_t* tail_call_body = nullptr; // body of a tail call wrapper (owned by <code>)
     unsigned char flags = 1; // is_lambda (as opposed to 'fn) | using_dynamic_scope | is_cps_procedure [only lambda by default]
 
 
@@ -87,21 +91,25 @@ namespace heist {
     function_object() = default;
     // primitive ctors
     function_object(const data_vector& a, const prm_ptr_t& p)noexcept:prm(p) { // partial primitive
-      param_instances.push_back(std::make_pair(a,param_stats()));
+      code = code_type(code_template{std::vector<params_type>(1,std::make_pair(a,param_stats())),std::vector<exe_fcn_t>()});
     }
     function_object(const string& n, const prm_ptr_t& p)noexcept:name(n),prm(p) {} // primitive
     // tail call wrapper ctor (gets returned up)
-    function_object(env_type& e,const exe_fcn_t& b)noexcept:env(e){bodies.push_back(b);}
-    // lambda ctor
-    function_object(const params_type& p,const exe_fcn_t& b,env_type& e,const string& n)noexcept:
-      name(n),param_instances(1,p),bodies(1,b),env(e),rec_depth(depth_type(size_type(0))){}
-    // fn ctor
-    function_object(const std::vector<params_type>& ps,const std::vector<exe_fcn_t>& bs,env_type& e,const string& n)noexcept:
-      name(n),param_instances(ps),bodies(bs),env(e),rec_depth(depth_type(size_type(0))),flags(0){}
+    function_object(env_type& e,const code_type& c,const exe_fcn_t* b)noexcept:code(c),env(e),tail_call_body(b){}
+    // closure ctor (lambda or fn)
+    function_object(const code_type& c,env_type& e,const bool is_lambda)noexcept:code(c),env(e),flags(is_lambda){}
     function_object(const function_object& f)noexcept{*this = f;}
     function_object(const function_object&& f)noexcept{*this = std::move(f);}
 
 
+    // Shared code accessors
+    const std::vector<params_type>& param_instances()const noexcept{
+      static const std::vector<params_type> no_param_instances;
+      return code ? code->param_instances : no_param_instances;
+    }
+    const std::vector<exe_fcn_t>& bodies()const noexcept{return code->bodies;} // PRECONDITION: is_compound()
+
+
     // Assignment
     void operator=(const function_object& f)noexcept;
     void operator=(function_object&& f)noexcept;
@@ -132,13 +140,13 @@ namespace heist {
     void set_using_dynamic_scope(const bool status)noexcept{if(status) flags |= 2; else flags &= ~2;}
     bool is_cps_procedure()const noexcept{return flags & 4;}
     void set_cps_procedure(const bool status)noexcept{if(status) flags |= 4; else flags &= ~4;}
-    size_type& recursive_depth()noexcept{return *rec_depth;} // PRECONDITION: rec_depth
-    size_type recursive_depth()const noexcept{return *rec_depth;} // PRECONDITION: rec_depth
+    size_type& recursive_depth()noexcept{return code->recursive_depth;} // PRECONDITION: is_compound()
+    size_type recursive_depth()const noexcept{return code->recursive_depth;} // PRECONDITION: is_compound()
 
 
     // Environmental extension for compound procedures
     str_vector lambda_parameters()const;
-    env_type get_extended_environment(data_vector& arguments,exe_fcn_t& body,const bool applying_in_cps);
+    env_type get_extended_environment(data_vector& arguments,const exe_fcn_t*& body,const bool applying_in_cps);
   };
 }
 
@@ -12,16 +12,9 @@ namespace heist {
 
   bool function_object::operator==(const function_object& f)const noexcept{
     if(is_primitive() || f.is_primitive())
-      return prm == f.prm && param_instances.empty() && f.param_instances.empty();
-    if(env != f.env || self != f.self || rec_depth != f.rec_depth || name != f.name || 
-       flags != f.flags || param_instances.size() != f.param_instances.size())
-       return false;
-    for(size_type i = 0, n = param_instances.size(); i < n; ++i) {
-      if(param_instances[i].first.size() != f.param_instances[i].first.size()) return false;
-      for(size_type j = 0, m = param_instances[i].first.size(); j < m; ++j)
-        if(!param_instances[i].first[j].noexcept_equal(f.param_instances[i].first[j])) return false;
-    }
-    return true;
+      return prm == f.prm && param_instances().empty() && f.param_instances().empty();
+    // closures are only equal to copies of themselves
+    return code == f.code && env == f.env && self == f.self && name == f.name && flags == f.flags;
   }
 
   /******************************************************************************
@@ -29,6 +22,7 @@ namespace heist {
   ******************************************************************************/
 
   str_vector function_object::lambda_parameters()const{
+    const auto& param_instances = this->param_instances();
     const auto n = param_instances[0].first.size();
     str_vector var_names(n);
     for(size_type i = 0; i < n; ++i) {
@@ -52,24 +46,24 @@ namespace heist {
 
   void function_object::operator=(const function_object& f)noexcept{
     if(this == &f) return;
-    name = f.name, param_instances = f.param_instances;
+    name = f.name, code = f.code;
     if(f.is_primitive()) {
       prm = f.prm;
     } else {
-      bodies = f.bodies, self = f.self, prm = nullptr;
-      env = f.env, rec_depth = f.rec_depth, flags = f.flags;
+      self = f.self, prm = nullptr;
+      env = f.env, tail_call_body = f.tail_call_body, flags = f.flags;
     }
   }
 
 
   void function_object::operator=(function_object&& f)noexcept{
     if(this == &f) return;
-    name = std::move(f.name), param_instances = std::move(f.param_instances);
+    name = std::move(f.name), code = std::move(f.code);
     if(f.is_primitive()) {
       prm = std::move(f.prm);
     } else {
-      bodies = std::move(f.bodies), self = std::move(f.self), prm = nullptr;
-      env = std::move(f.env), rec_depth = std::move(f.rec_depth), flags = std::move(f.flags);
+      self = std::move(f.self), prm = nullptr;
+      env = std::move(f.env), tail_call_body = f.tail_call_body, flags = std::move(f.flags);
     }
   }
 
@@ -383,21 +377,21 @@ namespace heist {
 
 
   // Get the extended environment for the compound procedure given <arguments>
-  env_type function_object::get_extended_environment(data_vector& arguments, exe_fcn_t& body, const bool applying_in_cps){
+  env_type function_object::get_extended_environment(data_vector& arguments, const exe_fcn_t*& body, const bool applying_in_cps){
     // add <id> as the topmost continuation if applying a procedure accepting a continuation in a non-cps environment
     if(is_cps_procedure() && !applying_in_cps)
       arguments.push_back(function_object("id",DEFAULT_TOPMOST_CONTINUATION::id));
     // extend the lambda environment
     if(is_lambda()) {
-      body = bodies[0];
-      return extend_environment(lambda_parameters(), param_instances[0].second, arguments, env, name);
+      body = &code->bodies[0];
+      return extend_environment(lambda_parameters(), code->param_instances[0].second, arguments, env, name);
     }
     // extend the fn environment
     str_vector unpacked_params;
     data_vector values;
-    auto param_idx = fn_param_matching::match_fn_call_signature(param_instances,printable_procedure_name(),arguments,values,unpacked_params);
-    body = bodies[param_idx];
-    return extend_environment(std::move(unpacked_params), param_instances[param_idx].second, values, env, name);
+    auto param_idx = fn_param_matching::match_fn_call_signature(code->param_instances,printable_procedure_name(),arguments,values,unpacked_params);
+    body = &code->bodies[param_idx];
+    return extend_environment(std::move(unpacked_params), code->param_instances[param_idx].second, values, env, name);
   }
 }
 
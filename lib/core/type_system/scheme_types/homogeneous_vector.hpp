@@ -0,0 +1,168 @@
+// Author: Jordan Randleman -- jordanran199@gmail.com -- homogeneous_vector.hpp
+// => Contains "homogeneous_vector" data structure for the C++ Heist Scheme Interpreter
+// => Homogeneous vectors are SRFI-4 numeric vectors backed by contiguous machine arrays
+
+#ifndef HEIST_SCHEME_CORE_HOMOGENEOUS_VECTOR_HPP_
+#define HEIST_SCHEME_CORE_HOMOGENEOUS_VECTOR_HPP_
+
+namespace heist {
+
+  /******************************************************************************
+  * HOMOGENEOUS VECTOR ELEMENT TYPES
+  ******************************************************************************/
+
+  // NOTE: <hvector_tag> order matches <homogeneous_vector::storage_type> alternative order!
+  enum class hvector_tag : unsigned char {s8, u8, s16, u16, s32, u32, s64, u64, f32, f64};
+
+  constexpr const char * const HVECTOR_TAG_NAMES[] = {"s8","u8","s16","u16","s32","u32","s64","u64","f32","f64"};
+
+  constexpr size_type HVECTOR_TOTAL_TAGS = sizeof(HVECTOR_TAG_NAMES)/sizeof(HVECTOR_TAG_NAMES[0]);
+
+  /******************************************************************************
+  * HOMOGENEOUS VECTOR
+  ******************************************************************************/
+
+  struct homogeneous_vector {
+    using storage_type = std::variant<std::vector<int8_t>,  std::vector<uint8_t>,
+                                      std::vector<int16_t>, std::vector<uint16_t>,
+                                      std::vector<int32_t>, std::vector<uint32_t>,
+                                      std::vector<int64_t>, std::vector<uint64_t>,
+                                      std::vector<float>,   std::vector<double>>;
+
+    storage_type val;
+
+
+    // Constructors
+    homogeneous_vector() = default;
+    homogeneous_vector(const hvector_tag tag, const size_type n = 0) {
+      switch(tag) {
+        case hvector_tag::s8:  val.emplace<std::vector<int8_t>>(n);   return;
+        case hvector_tag::u8:  val.emplace<std::vector<uint8_t>>(n);  return;
+        case hvector_tag::s16: val.emplace<std::vector<int16_t>>(n);  return;
+        case hvector_tag::u16: val.emplace<std::vector<uint16_t>>(n); return;
+        case hvector_tag::s32: val.emplace<std::vector<int32_t>>(n);  return;
+        case hvector_tag::u32: val.emplace<std::vector<uint32_t>>(n); return;
+        case hvector_tag::s64: val.emplace<std::vector<int64_t>>(n);  return;
+        case hvector_tag::u64: val.emplace<std::vector<uint64_t>>(n); return;
+        case hvector_tag::f32: val.emplace<std::vector<float>>(n);    return;
+        default:               val.emplace<std::vector<double>>(n);   return;
+      }
+    }
+
+
+    // Element type
+    hvector_tag tag()const noexcept{return hvector_tag(val.index());}
+    const char* tag_name()const noexcept{return HVECTOR_TAG_NAMES[val.index()];}
+    static bool tag_from_name(const string& name, hvector_tag& tag)noexcept{
+      for(size_type i = 0; i < HVECTOR_TOTAL_TAGS; ++i) {
+        if(name == HVECTOR_TAG_NAMES[i]) {
+          tag = hvector_tag(i);
+          return true;
+        }
+      }
+      return false;
+    }
+
+
+    // Length
+    size_type size()const noexcept{return std::visit([](const auto& v){return v.size();},val);}
+    bool empty()const noexcept{return !size();}
+
+
+    // Element validation: integer tags only hold exact integers w/in their range
+    bool is_valid_element(const num_type& n)const noexcept{
+      return std::visit([&](const auto& v){return is_valid_element_of<typename std::decay_t<decltype(v)>::value_type>(n);},val);
+    }
+
+
+    // Element access (PRECONDITION: i < size())
+    num_type ref(const size_type i)const noexcept{
+      return std::visit([=](const auto& v){return box_element(v[i]);},val);
+    }
+
+    // Element assignment (PRECONDITION: i < size() && is_valid_element(n))
+    void set(const size_type i, const num_type& n)noexcept{
+      std::visit([&](auto& v){v[i] = unbox_element<typename std::decay_t<decltype(v)>::value_type>(n);},val);
+    }
+
+    // Fill every element (PRECONDITION: is_valid_element(n))
+    void fill(const num_type& n)noexcept{
+      std::visit([&](auto& v){std::fill(v.begin(),v.end(),unbox_element<typename std::decay_t<decltype(v)>::value_type>(n));},val);
+    }
+
+    // Append an element (PRECONDITION: is_valid_element(n))
+    void push_back(const num_type& n)noexcept{
+      std::visit([&](auto& v){v.push_back(unbox_element<typename std::decay_t<decltype(v)>::value_type>(n));},val);
+    }
+
+
+    // Element-wise equality (vectors w/ different element types are never equal)
+    bool operator==(const homogeneous_vector& h)const noexcept{return val == h.val;}
+    bool operator!=(const homogeneous_vector& h)const noexcept{return val != h.val;}
+
+
+    // Stringification: #<tag>(<elt1> <elt2> ...)
+    string str()const noexcept{
+      string buffer(1,'#');
+      buffer += tag_name();
+      buffer += '(';
+      std::visit([&](const auto& v){
+        for(size_type i = 0, n = v.size(); i < n; ++i) {
+          if(i) buffer += ' ';
+          if constexpr (std::is_floating_point_v<typename std::decay_t<decltype(v)>::value_type>) {
+            buffer += box_element(v[i]).str();
+          } else {
+            buffer += std::to_string(v[i]);
+          }
+        }
+      },val);
+      return buffer + ')';
+    }
+
+    // Box a stored element as a number
+    template<typename T>
+    static num_type box_element(const T elt)noexcept{
+      if constexpr (std::is_floating_point_v<T>) {
+        return num_type(num_type::inexact_t(elt));
+      } else if constexpr (std::is_signed_v<T>) {
+        return num_type((long long)elt);
+      } else {
+        return num_type((unsigned long long)elt);
+      }
+    }
+
+  private:
+    // Largest exact integer magnitude whose flonum conversion is guaranteed to be exact
+    static constexpr num_type::inexact_t MAX_EXACT_FLONUM_INTEGER = 1e15L;
+
+
+    template<typename T>
+    static bool is_valid_element_of(const num_type& n)noexcept{
+      if constexpr (std::is_floating_point_v<T>) {
+        return n.is_real();
+      } else {
+        static const num_type min_value = box_element(std::numeric_limits<T>::min());
+        static const num_type max_value = box_element(std::numeric_limits<T>::max());
+        return n.is_exact() && n.is_integer() && n >= min_value && n <= max_value;
+      }
+    }
+
+
+    template<typename T>
+    static T unbox_element(const num_type& n)noexcept{
+      const auto flonum = n.extract_inexact();
+      if constexpr (std::is_floating_point_v<T>) {
+        return T(flonum);
+      } else {
+        if(flonum > -MAX_EXACT_FLONUM_INTEGER && flonum < MAX_EXACT_FLONUM_INTEGER) return T(flonum);
+        if constexpr (std::is_signed_v<T>) {
+          return T(std::stoll(n.str()));
+        } else {
+          return T(std::stoull(n.str()));
+        }
+      }
+    }
+  };
+}
+
+#endif
@@ -1383,16 +1383,16 @@ namespace scm_numeric {
     if(is_float && s.is_float)
       return (float_num * (1 - 2 * is_neg())) < (s.float_num * (1 - 2 * s.is_neg()));
     else if(!is_float && !s.is_float && dlen == 1 && denominator[0] == 1 && s.dlen == 1 && s.denominator[0] == 1)
-      return big_int_lt(numerator,nlen,s.numerator,s.nlen) ^ is_neg();
+      return is_neg() ? big_int_gt(numerator,nlen,s.numerator,s.nlen) : big_int_lt(numerator,nlen,s.numerator,s.nlen);
     else if(!is_float && !s.is_float) {
       size_type lhs_len = 0, rhs_len = 0;
       exact_t lhs = new exact_val_t [nlen + s.dlen];
       big_int_abs_val_mul(lhs,lhs_len,numerator,nlen,s.denominator,s.dlen);
       exact_t rhs = new exact_val_t [s.nlen + dlen];
       big_int_abs_val_mul(rhs,rhs_len,s.numerator,s.nlen,denominator,dlen);
-      bool result = big_int_lt(lhs,lhs_len,rhs,rhs_len);
+      bool result = is_neg() ? big_int_gt(lhs,lhs_len,rhs,rhs_len) : big_int_lt(lhs,lhs_len,rhs,rhs_len);
       delete [] lhs; delete [] rhs;
-      return result ^ is_neg();
+      return result;
     } else {
       return (*this - s).is_neg();
     }
@@ -1408,16 +1408,16 @@ namespace scm_numeric {
     if(is_float && s.is_float)
       return (float_num * (1 - 2 * is_neg())) > (s.float_num * (1 - 2 * s.is_neg()));
     else if(!is_float && !s.is_float && dlen == 1 && denominator[0] == 1 && s.dlen == 1 && s.denominator[0] == 1)
-      return big_int_gt(numerator,nlen,s.numerator,s.nlen) ^ is_neg();
+      return is_neg() ? big_int_lt(numerator,nlen,s.numerator,s.nlen) : big_int_gt(numerator,nlen,s.numerator,s.nlen);
     else if(!is_float && !s.is_float) {
       size_type lhs_len = 0, rhs_len = 0;
       exact_t lhs = new exact_val_t [nlen + s.dlen];
       big_int_abs_val_mul(lhs,lhs_len,numerator,nlen,s.denominator,s.dlen);
       exact_t rhs = new exact_val_t [s.nlen + dlen];
       big_int_abs_val_mul(rhs,rhs_len,s.numerator,s.nlen,denominator,dlen);
-      bool result = big_int_gt(lhs,lhs_len,rhs,rhs_len);
+      bool result = is_neg() ? big_int_lt(lhs,lhs_len,rhs,rhs_len) : big_int_gt(lhs,lhs_len,rhs,rhs_len);
       delete [] lhs; delete [] rhs;
-      return result ^ is_neg();
+      return result;
     } else {
       return (*this - s).is_pos();
     }
@@ -7,6 +7,32 @@
 #include "implementation_helpers/object_property_manipulation_logic.hpp"
 
 namespace heist {
+  void object_type::add_member(const string& name, data value) noexcept {
+    get_unshared_object_shape(*this).member_names.push_back(name);
+    member_values.push_back(std::move(value));
+  }
+
+
+  void object_type::add_method(const string& name, data value) noexcept {
+    get_unshared_object_shape(*this).method_names.push_back(name);
+    method_values.push_back(std::move(value));
+  }
+
+
+  void object_type::erase_member(const size_type slot) noexcept {
+    auto& names = get_unshared_object_shape(*this).member_names;
+    names.erase(names.begin()+slot);
+    member_values.erase(member_values.begin()+slot);
+  }
+
+
+  void object_type::erase_method(const size_type slot) noexcept {
+    auto& names = get_unshared_object_shape(*this).method_names;
+    names.erase(names.begin()+slot);
+    method_values.erase(method_values.begin()+slot);
+  }
+
+
   void object_type::define_property(const string& name, data value) noexcept {
     if(value.is_type(types::fcn)) {
       define_object_method_property(*this, name, value);
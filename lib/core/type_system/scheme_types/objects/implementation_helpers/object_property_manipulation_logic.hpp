@@ -6,52 +6,53 @@
 
 namespace heist {
 
+  /******************************************************************************
+  * OBJECT SHAPE LAYOUT MUTATION
+  ******************************************************************************/
+
+  // Get <obj>'s shape for in-place mutation ("dictionary mode")
+  // => Copies the shape if shared w/ other objects, classes, or inline caches
+  object_shape& get_unshared_object_shape(object_type& obj)noexcept{
+    if(obj.shape.use_count() > 1) obj.shape = shp_type(*obj.shape);
+    return *obj.shape;
+  }
+
   /******************************************************************************
   * OBJECTS PROPERTY DEFINITION
   ******************************************************************************/
 
   void define_object_member_property(object_type& obj, const string& property_name, data& value)noexcept{
-    // Set local member if already exists
-    for(size_type i = 0, n = obj.member_names.size(); i < n; ++i) {
-      if(obj.member_names[i] == property_name) {
-        obj.member_values[i] = value;
+    size_type slot = 0;
+    bool is_member = false;
+    if(obj.shape->find_property(property_name,slot,is_member)) {
+      // Set local member if already exists
+      if(is_member) {
+        obj.member_values[slot] = value;
         return;
       }
-    }
-    // Rm if member already exists as a local method
-    for(size_type i = 0, n = obj.method_names.size(); i < n; ++i) {
-      if(obj.method_names[i] == property_name) {
-        obj.method_names.erase(obj.method_names.begin()+i);
-        obj.method_values.erase(obj.method_values.begin()+i);
-        break;
-      }
+      // Rm if member already exists as a local method
+      obj.erase_method(slot);
     }
     // add the new member name & assign it the given value
-    obj.member_names.push_back(property_name);
-    obj.member_values.push_back(value);
+    obj.add_member(property_name,value);
   }
 
 
   void define_object_method_property(object_type& obj, const string& property_name, data& value)noexcept{
     if(value.fcn.name.empty()) value.fcn.name = object_type::hash_method_name(property_name);
-    // Set local method if already exists
-    for(size_type i = 0, n = obj.method_names.size(); i < n; ++i) {
-      if(obj.method_names[i] == property_name) {
-        obj.method_values[i] = value;
+    size_type slot = 0;
+    bool is_member = false;
+    if(obj.shape->find_property(property_name,slot,is_member)) {
+      // Set local method if already exists
+      if(!is_member) {
+        obj.method_values[slot] = value;
         return;
       }
-    }
-    // Rm if method already exists as a local member
-    for(size_type i = 0, n = obj.member_names.size(); i < n; ++i) {
-      if(obj.member_names[i] == property_name) {
-        obj.member_names.erase(obj.member_names.begin()+i);
-        obj.member_values.erase(obj.member_values.begin()+i);
-        break;
-      }
+      // Rm if method already exists as a local member
+      obj.erase_member(slot);
     }
     // add the new method name & assign it the given value
-    obj.method_names.push_back(property_name);
-    obj.method_values.push_back(value);
+    obj.add_method(property_name,value);
   }
 
   /******************************************************************************
@@ -64,13 +65,11 @@ namespace heist {
       if(property_names[i] == property_name) {
         // setting property to be a member
         if(!value.is_type(types::fcn)) {
-          obj.member_names.push_back(property_name);
-          obj.member_values.push_back(value);
+          obj.add_member(property_name,value);
         // setting property to be a method
         } else {
-          obj.method_names.push_back(property_name);
           if(value.fcn.name.empty()) value.fcn.name = object_type::hash_method_name(property_name);
-          obj.method_values.push_back(value);
+          obj.add_method(property_name,value);
         }
         return true;
       }
@@ -79,37 +78,31 @@ namespace heist {
   }
 
 
-  bool set_new_property_value_SEEK_IN_OBJ(str_vector& seeking_names, data_vector& seeking_values, 
-                                          str_vector& alt_names, data_vector& alt_values, const bool value_in_SEEKING_set, 
-                                          const string& property_name, data& value)noexcept{
-    for(size_type i = 0, n = seeking_names.size(); i < n; ++i) {
-      if(seeking_names[i] == property_name) {
-        if(value.is_type(types::fcn) && value.fcn.name.empty()) 
-          value.fcn.name = object_type::hash_method_name(property_name);
-        if(value_in_SEEKING_set) {
-          seeking_values[i] = value;
-        } else {
-          seeking_names.erase(seeking_names.begin()+i);
-          seeking_values.erase(seeking_values.begin()+i);
-          alt_names.push_back(property_name);
-          alt_values.push_back(value);
-        }
-        return true;
-      }
+  bool set_new_property_value_SEEK_IN_OBJ(object_type& obj, const string& property_name, data& value)noexcept{
+    size_type slot = 0;
+    bool is_member = false;
+    if(!obj.shape->find_property(property_name,slot,is_member)) return false;
+    if(value.is_type(types::fcn) && value.fcn.name.empty()) 
+      value.fcn.name = object_type::hash_method_name(property_name);
+    // assign the slot if keeping the property's kind, else re-kind the property
+    if(is_member != value.is_type(types::fcn)) {
+      (is_member ? obj.member_values : obj.method_values)[slot] = value;
+    } else if(is_member) {
+      obj.erase_member(slot);
+      obj.add_method(property_name,value);
+    } else {
+      obj.erase_method(slot);
+      obj.add_member(property_name,value);
     }
-    return false;
+    return true;
   }
 
 
   // Returns whether found <property_name> in <obj>, <proto>, or its inheritance chain
   bool set_new_object_property_value(object_type& obj, const string& property_name, data& value)noexcept{
     return 
-      // Search local members
-      set_new_property_value_SEEK_IN_OBJ(obj.member_names,obj.member_values,obj.method_names,obj.method_values,
-                                         !value.is_type(types::fcn),property_name,value) || 
-      // Search local methods
-      set_new_property_value_SEEK_IN_OBJ(obj.method_names,obj.method_values,obj.member_names,obj.member_values,
-                                         value.is_type(types::fcn),property_name,value)  ||
+      // Search local members & methods
+      set_new_property_value_SEEK_IN_OBJ(obj,property_name,value) || 
       // Search the prototype & cache the new member/method if found
       set_new_property_value_SEEK_IN_PROTO(obj.proto->member_names, obj, property_name, value) ||
       set_new_property_value_SEEK_IN_PROTO(obj.proto->method_names, obj, property_name, value) ||
@@ -129,14 +122,14 @@ namespace heist {
     for(size_type i = 0, n = obj.proto->member_names.size(); i < n; ++i)
       if(obj.proto->member_names[i] == property_name) {
         // cache accessed prototype member
-        obj.member_names.push_back(property_name), obj.member_values.push_back(obj.proto->member_values[i].copy());
+        obj.add_member(property_name,obj.proto->member_values[i].copy());
         is_member = true;
         return true;
       }
     for(size_type i = 0, n = obj.proto->method_names.size(); i < n; ++i)
       if(obj.proto->method_names[i] == property_name) {
         // cache accessed prototype method
-        obj.method_names.push_back(property_name), obj.method_values.push_back(obj.proto->method_values[i]);
+        obj.add_method(property_name,obj.proto->method_values[i]);
         is_member = false;
         return true;
       }
@@ -148,18 +141,9 @@ namespace heist {
   // Returns whether found <property_name> as a member/method in <obj> 
   // If returns true, <property_name> value is in <obj> & <is_member> denotes whether a member or method
   bool object_has_property_name(object_type& obj, const string& property_name, bool& is_member) {
-    // Seek members
-    for(size_type i = 0, n = obj.member_names.size(); i < n; ++i)
-      if(obj.member_names[i] == property_name) {
-        is_member = true;
-        return true;
-      }
-    // Seek methods
-    for(size_type i = 0, n = obj.method_names.size(); i < n; ++i)
-      if(obj.method_names[i] == property_name) {
-        is_member = false;
-        return true;
-      }
+    // Seek members & methods
+    size_type slot = 0;
+    if(obj.shape->find_property(property_name,slot,is_member)) return true;
     // Seek proto & its inherited prototype
     // => IF FOUND, ADD IT TO THE LOCAL OBJECT INSTANCE
     return prototype_or_super_has_property_name(obj,property_name,is_member);
@@ -177,14 +161,14 @@ namespace heist {
     for(size_type i = 0, n = obj.proto->member_names.size(); i < n; ++i)
       if(obj.proto->member_names[i] == property_name) {
         // cache accessed prototype member
-        obj.member_names.push_back(property_name), obj.member_values.push_back(obj.proto->member_values[i].copy());
+        obj.add_member(property_name,obj.proto->member_values[i].copy());
         found = true;
         return *obj.member_values.rbegin();
       }
     for(size_type i = 0, n = obj.proto->method_names.size(); i < n; ++i)
       if(obj.proto->method_names[i] == property_name) {
         // cache accessed prototype method
-        obj.method_names.push_back(property_name), obj.method_values.push_back(obj.proto->method_values[i]);
+        obj.add_method(property_name,obj.proto->method_values[i]);
         found = true;
         return *obj.method_values.rbegin();
       }
@@ -199,18 +183,13 @@ namespace heist {
 
   // Returns <property_name>'s associated  value if found as a member/method in <obj> 
   data get_object_property(object_type& obj, const string& property_name, bool& found) {
-    // Seek members
-    for(size_type i = 0, n = obj.member_names.size(); i < n; ++i)
-      if(obj.member_names[i] == property_name) {
-        found = true;
-        return obj.member_values[i];
-      }
-    // Seek methods
-    for(size_type i = 0, n = obj.method_names.size(); i < n; ++i)
-      if(obj.method_names[i] == property_name) {
-        found = true;
-        return obj.method_values[i];
-      }
+    // Seek members & methods
+    size_type slot = 0;
+    bool is_member = false;
+    if(obj.shape->find_property(property_name,slot,is_member)) {
+      found = true;
+      return is_member ? obj.member_values[slot] : obj.method_values[slot];
+    }
     // Seek proto & its inherited prototype
     // => IF FOUND, ADD IT TO THE LOCAL OBJECT INSTANCE
     return get_prototype_or_super_property(obj,property_name,found);
@@ -222,23 +201,17 @@ namespace heist {
 
   // Delete's <property_name> name-value association in <obj> | <obj.super> if present 
   bool delete_object_property(object_type& obj, const string& property_name)noexcept{
-    // Seek members
-    for(size_type i = 0, n = obj.member_names.size(); i < n; ++i)
-      if(obj.member_names[i] == property_name) {
-        obj.member_names.erase(obj.member_names.begin()+i);
-        obj.member_values.erase(obj.member_values.begin()+i);
-        return true;
-      }
-    // Seek methods
-    for(size_type i = 0, n = obj.method_names.size(); i < n; ++i)
-      if(obj.method_names[i] == property_name) {
-        obj.method_names.erase(obj.method_names.begin()+i);
-        obj.method_values.erase(obj.method_values.begin()+i);
-        return true;
-      }
+    // Seek members & methods
+    size_type slot = 0;
+    bool is_member = false;
+    if(obj.shape->find_property(property_name,slot,is_member)) {
+      if(is_member) obj.erase_member(slot);
+      else          obj.erase_method(slot);
+      return true;
+    }
     // Seek super
     return obj.super && delete_object_property(*obj.super,property_name);
   }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,32 @@
+// Author: Jordan Randleman -- jordanran199@gmail.com -- object_shape.hpp
+// => Contains "object_shape" data structure for the C++ Heist Scheme Interpreter
+
+#ifndef HEIST_SCHEME_CORE_OBJECT_SHAPE_HPP_
+#define HEIST_SCHEME_CORE_OBJECT_SHAPE_HPP_
+
+namespace heist {
+  // Property names of an object, indexing the object's member & method value slots
+  // => Objects of the same class share their class's shape until their layout changes
+  // => Layout changes (adding/deleting/re-kinding properties) move an object into 
+  //    "dictionary mode": it gets its own copy of the shape, mutated in place while unshared
+  struct object_shape {
+    str_vector member_names, method_names;
+
+    // Returns whether found <name>, assigning <slot> & <is_member> if so
+    bool find_property(const string& name, size_type& slot, bool& is_member)const noexcept{
+      for(size_type i = 0, n = member_names.size(); i < n; ++i)
+        if(member_names[i] == name) {
+          slot = i, is_member = true;
+          return true;
+        }
+      for(size_type i = 0, n = method_names.size(); i < n; ++i)
+        if(method_names[i] == name) {
+          slot = i, is_member = false;
+          return true;
+        }
+      return false;
+    }
+  };
+}
+
+#endif
@@ -8,8 +8,14 @@ namespace heist {
   struct object_type {
     obj_type super = nullptr; // inherited proto subobject instance
     cls_type proto;           // ptr to the prototype object
-    str_vector member_names, method_names;
-    data_vector member_values, method_values;
+    shp_type shape;           // property names (shared by objects w/ the same layout)
+    data_vector member_values, method_values; // value slots indexed by <shape>
+    const str_vector& member_names()const noexcept{return shape->member_names;}
+    const str_vector& method_names()const noexcept{return shape->method_names;}
+    void add_member(const string& name, data value) noexcept;
+    void add_method(const string& name, data value) noexcept;
+    void erase_member(const size_type slot) noexcept;
+    void erase_method(const size_type slot) noexcept;
     void define_property(const string& name, data value) noexcept;
     bool delete_property(const string& name) noexcept; // returns if found
     bool set_property(const string& name, data value) noexcept; // returns if found
@@ -6,6 +6,8 @@
 
 // NOTE: <pointer_to_hexstring> comes from "scheme_types/data/implementation_helpers/stringification.hpp"
 
+#include <atomic>
+
 namespace heist {
 
   /******************************************************************************
@@ -25,6 +27,21 @@ namespace heist {
     return stdin;
   }
 
+  /******************************************************************************
+  * OUTPUT PORT BUFFERING
+  ******************************************************************************/
+
+  // Stdout's buffering mode (set via "set-port-buffering!")
+  // => Process-wide rather than per-universe, as is stdout itself
+  std::atomic<port_buffering> STDOUT_BUFFERING = port_buffering::none;
+
+
+  // Other ports are left to flush per their stdio buffer (see "set-port-buffering!")
+  void flush_unbuffered_console_port(FILE* outs)noexcept{
+    if(outs == stderr || (outs == stdout && STDOUT_BUFFERING == port_buffering::none)) 
+      fflush(outs);
+  }
+
   /******************************************************************************
   * IPORT IMPLEMENTATION
   ******************************************************************************/
@@ -1,5 +1,6 @@
 // Author: Jordan Randleman -- jordanran199@gmail.com -- port.hpp
 // => Contains "iport" & "oport" data structures for the C++ Heist Scheme Interpreter
+// => Also contains the "port_buffering" output port buffering modes
 
 #ifndef HEIST_SCHEME_CORE_PORT_HPP_
 #define HEIST_SCHEME_CORE_PORT_HPP_
@@ -10,6 +11,15 @@ namespace heist {
   FILE* noexcept_get_current_output_port()noexcept;
   FILE* noexcept_get_current_input_port()noexcept;
 
+  // Flush <outs> after a write iff it's an unbuffered console port (implementation in "implementation.hpp")
+  void flush_unbuffered_console_port(FILE* outs)noexcept;
+
+
+  // Output port buffering modes
+  //   => File ports default to <block> buffering, & stdout to <none> 
+  //      (flushed after every write, to interleave w/ the REPL & errors)
+  enum class port_buffering {none, line, block};
+
 
   // Input port struct (differentiates from 'oport')
   struct iport {
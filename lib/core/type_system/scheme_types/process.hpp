@@ -76,12 +76,21 @@ namespace heist {
     bool TRACE_ARGS = false;
     size_type TRACE_LIMIT = 16;
 
+    /* # OF WORKER UNIVERSES USED BY "pmap", "pfor-each", & "preduce" */
+    size_type PARALLEL_WORKERS = std::max(1u,std::thread::hardware_concurrency()); // see set-parallel-workers!
+
+    /* REGEX ENGINE SELECTION */
+    bool USING_LINEAR_REGEX_ENGINE = false; // see set-linear-regex! primitive
+
     /* INFIX SYMBOL READER TABLE */
     std::map<long long,infix_level_t> INFIX_TABLE; // {precedence, {left-assoc?, symbol}}
 
     /* GLOBAL ENVIRONMENT POINTER */
     env_type GLOBAL_ENVIRONMENT_POINTER = nullptr;
 
+    /* BINDINGS THIS UNIVERSE DELETED FROM ITS FROZEN SNAPSHOT (SEE "environment::frozen") */
+    str_vector ERASED_SNAPSHOT_VARIABLES, ERASED_SNAPSHOT_MACROS;
+
     /* DOT CHARACTER FOR VARIADIC & PAIR-LITERAL DENOTATION */
     string dot = "."; // see the "set-dot!" primitive
 
@@ -91,10 +100,10 @@ namespace heist {
   }; // End of struct process_invariants_t
 
   /******************************************************************************
-  * CURRENT GLOBAL PROCESS INVARIANT SET
+  * CURRENT GLOBAL PROCESS INVARIANT SET (EACH THREAD RUNS ITS OWN UNIVERSE)
   ******************************************************************************/
 
-  process_invariants_t G;
+  thread_local process_invariants_t G;
 
   /******************************************************************************
   * DOT ANALYSIS HELPER FUNCTIONS
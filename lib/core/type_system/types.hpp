@@ -16,8 +16,10 @@
 #include <map>
 #include <ratio>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
+#include <variant>
 #include <vector>
 
 /******************************************************************************
@@ -61,7 +63,10 @@ namespace heist {
   using map_type = tgc_ptr<struct map_object>;                  // hash-map
   using cls_type = tgc_ptr<struct class_prototype>;             // class-prototype
   using obj_type = tgc_ptr<struct object_type>;                 // object
+  using shp_type = tgc_ptr<struct object_shape,0>;              // object property layout
   using prc_type = tgc_ptr<struct process_invariants_t>;        // process invariants
+  using hvc_type = tgc_ptr<struct homogeneous_vector>;          // homogeneous (numeric) vector
+  using fib_type = tgc_ptr<struct coroutine_fiber,0>;           // coroutine fiber (native stack)
 }
 
 /******************************************************************************
@@ -85,6 +90,9 @@ namespace heist {
 #include "scheme_types/environments/environment.hpp"                 // fcn create_frame, struct environment
 #include "scheme_types/delay_object.hpp"                             // struct delay_object
 #include "scheme_types/map_object.hpp"                               // struct map_object
+#include "scheme_types/homogeneous_vector.hpp"                       // enum class hvector_tag, struct homogeneous_vector
+#include "scheme_types/coroutine_fiber.hpp"                          // struct coroutine_fiber
+#include "scheme_types/objects/object_shape.hpp"                     // struct object_shape
 #include "scheme_types/class_prototype.hpp"                          // struct class_prototype
 #include "scheme_types/objects/object_type.hpp"                      // struct object_type
 #include "scheme_types/process.hpp"                                  // var G, struct process_invariants_t, fcn symbol_is_dot_operator, fcn data_is_dot_operator
@@ -106,6 +114,8 @@ namespace heist {
   cls_type make_cls(const class_prototype& c)                    noexcept{return cls_type(c);}
   obj_type make_obj(const object_type& o)                        noexcept{return obj_type(o);}
   obj_type make_obj(object_type&& o)                             noexcept{return obj_type(std::move(o));}
+  hvc_type make_hvc(const homogeneous_vector& h)                 noexcept{return hvc_type(h);}
+  hvc_type make_hvc(homogeneous_vector&& h)                      noexcept{return hvc_type(std::move(h));}
 }
 
 /******************************************************************************
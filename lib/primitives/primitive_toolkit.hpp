@@ -102,8 +102,8 @@ namespace heist::primitive_toolkit {
     obj_type obj = d.obj;
     while(obj) {
       // search object's local members
-      for(size_type i = 0, n = obj->method_names.size(); i < n; ++i)
-        if(obj->method_names[i] == "self->procedure") return true;
+      for(size_type i = 0, n = obj->method_names().size(); i < n; ++i)
+        if(obj->method_names()[i] == "self->procedure") return true;
       // search object's prototype
       for(size_type i = 0, n = obj->proto->method_names.size(); i < n; ++i)
         if(obj->proto->method_names[i] == "self->procedure") return true;
@@ -137,14 +137,14 @@ namespace heist::primitive_toolkit {
     obj_type obj = d.obj;
     while(obj) {
       // search object's local members
-      for(size_type i = 0, n = obj->method_names.size(); i < n; ++i)
-        if(obj->method_names[i] == "self->procedure")
+      for(size_type i = 0, n = obj->method_names().size(); i < n; ++i)
+        if(obj->method_names()[i] == "self->procedure")
           return obj->method_values[i].fcn.bind_self(obj);
       // search object's prototype
       for(size_type i = 0, n = obj->proto->method_names.size(); i < n; ++i)
         if(obj->proto->method_names[i] == "self->procedure") {
           // Cache the method dynamically added to the object's prototype IN the object
-          obj->method_names.push_back("self->procedure"), obj->method_values.push_back(obj->proto->method_values[i]);
+          obj->add_method("self->procedure",obj->proto->method_values[i]);
           return obj->method_values.rbegin()->fcn.bind_self(obj);
         }
       // search inherited object prototype
@@ -1,6 +1,7 @@
 // Author: Jordan Randleman -- jordanran199@gmail.com -- coroutines.hpp
-// => Defines the primitive "cycle-coroutines!" function written in 
-//    C++ for the Heist Scheme Interpreter
+// => Defines the primitive "cycle-coroutines!" function, & the internally-used
+//    fiber-switching "next"/"yield" primitives, written in C++ for the Heist 
+//    Scheme Interpreter
 
 #ifndef HEIST_SCHEME_CORE_STDLIB_COROUTINES_HPP_
 #define HEIST_SCHEME_CORE_STDLIB_COROUTINES_HPP_
@@ -9,13 +10,18 @@
 
 /***
  * NOTE:
- *   Similar to "universe"s, coroutines as constructs are actually entirely defined 
- *   directly in Heist Scheme, and as such, the interpreter only ever sees them as just 
- *   being "any other object".
+ *   Similar to "universe"s, coroutines as constructs are actually defined directly 
+ *   in Heist Scheme, and as such, the interpreter only ever sees them as just being 
+ *   "any other object".
  *
- *   The only reason we define "cycle-coroutines!" in C++ is due to Heist Scheme's design
- *   philosophy, namely that as many primitives as possible should be implemented in C++ 
- *   in order to reduce run-time overhead.
+ *   Each coroutine object, however, runs its body on its own native stack (see
+ *   "lib/core/type_system/scheme_types/coroutine_fiber.hpp"): "yield" & ".next" 
+ *   thus simply switch between fibers, w/o CPS-converting the coroutine's body nor 
+ *   throwing "jump!"s. Yielding also updates the object's ".value" in-place.
+ *
+ *   We define "cycle-coroutines!" in C++ due to Heist Scheme's design philosophy, 
+ *   namely that as many primitives as possible should be implemented in C++ in 
+ *   order to reduce run-time overhead.
  *
  *   Indeed, implementing "cycle-coroutines!" in Heist Scheme directly is trivial:
  *
@@ -29,22 +35,77 @@
 
 namespace heist {
 
+  data primitive_HEIST_CORE_COROUTINE_NEXT(data_vector&& args) {
+    static constexpr const char * const format = 
+      "\n     (heist:core:coroutine:next <coroutine-object>)";
+    if(args.size() != 1)
+      HEIST_THROW_ERR("'heist:core:coroutine:next didn't receive 1 arg!"
+        << format << HEIST_FCN_ERR("heist:core:coroutine:next",args));
+    auto coro_proto = stdlib_coroutines::get_coroutine_class_prototype(args,"heist:core:coroutine:next",format);
+    if(!stdlib_coroutines::datum_is_a_coroutine(args[0],coro_proto))
+      HEIST_THROW_ERR("'heist:core:coroutine:next arg " << HEIST_PROFILE(args[0]) << " isn't a coroutine!"
+        << format << HEIST_FCN_ERR("heist:core:coroutine:next",args));
+    return stdlib_coroutines::resume_coroutine(args[0],"heist:core:coroutine:next",format);
+  }
+
+
+  data primitive_HEIST_CORE_COROUTINE_YIELD(data_vector&& args) {
+    static constexpr const char * const format = "\n     (yield <optional-value>)";
+    if(args.size() > 1)
+      HEIST_THROW_ERR("'yield received more than 1 arg!" << format << HEIST_FCN_ERR("yield",args));
+    auto fiber = coroutine_fiber::running();
+    if(!fiber)
+      HEIST_THROW_ERR("'yield isn't running in a coroutine!" << format << HEIST_FCN_ERR("yield",args));
+    fiber->transfer = args.empty() ? GLOBALS::FALSE_DATA_BOOLEAN : std::move(args[0]);
+    stdlib_coroutines::suspend_coroutine(*fiber);
+    return GLOBALS::VOID_DATA_OBJECT;
+  }
+
+
   // WARNING: If none of the cycled coroutines terminate, neither will this procedure!
 
   data primitive_CYCLE_COROUTINES_BANG(data_vector&& args) {
     static constexpr const char * const format = 
       "\n     (cycle-coroutines! <coroutine-1> <coroutine-2> ...)";
-    auto coro_proto = stdlib_coroutines::get_coroutine_class_prototype(args,format);
+    auto coro_proto = stdlib_coroutines::get_coroutine_class_prototype(args,"cycle-coroutines!",format);
     size_type i = 0, n = args.size();
     for(;;) {
       for(i = 0; i < n; ++i) {
         if(!stdlib_coroutines::datum_is_a_coroutine(args[i],coro_proto)) return args[i];
-        args[i] = stdlib_coroutines::invoke_coroutine_NEXT_method(args[i],format);
+        args[i] = stdlib_coroutines::resume_coroutine(args[i],"cycle-coroutines!",format);
       }
     }
     return data(); // never triggered
   }
 
+
+  // Only affects coroutines launched afterwards by the current thread
+
+  data primitive_SET_COROUTINE_STACK_SIZE_BANG(data_vector&& args) {
+    static constexpr const char * const format = 
+      "\n     (set-coroutine-stack-size! <positive-integer>)"
+      "\n     <positive-integer>: # of bytes, no less than 65536";
+    if(args.size() != 1 || !args[0].is_type(types::num) || !args[0].num.is_integer() || !args[0].num.is_pos())
+      HEIST_THROW_ERR("'set-coroutine-stack-size! didn't receive a positive integer arg!"
+        << format << HEIST_FCN_ERR("set-coroutine-stack-size!",args));
+    auto float_num = args[0].num.to_inexact();
+    if(float_num < COROUTINE_FIBER_MIN_STACK_SIZE || float_num > GLOBALS::MAX_SIZE_TYPE)
+      HEIST_THROW_ERR("'set-coroutine-stack-size! integer arg is out of bounds!"
+        << format << HEIST_FCN_ERR("set-coroutine-stack-size!",args));
+    // Set the new stack size, & return the original
+    auto original = COROUTINE_FIBER_RUNTIME.stack_size;
+    COROUTINE_FIBER_RUNTIME.set_stack_size((std::size_t)float_num.extract_inexact());
+    return num_type(original);
+  }
+
+
+  data primitive_COROUTINE_STACK_SIZE(data_vector&& args) {
+    if(!args.empty())
+      HEIST_THROW_ERR("'coroutine-stack-size doesn't accept any args!"
+        "\n     (coroutine-stack-size)" << HEIST_FCN_ERR("coroutine-stack-size",args));
+    return num_type(COROUTINE_FIBER_RUNTIME.stack_size);
+  }
+
 } // End of namespace heist
 
 #endif
\ No newline at end of file
@@ -5,13 +5,13 @@
 #define HEIST_SCHEME_CORE_STDLIB_COROUTINES_IMPLEMENTATION_HPP_
 
 namespace heist::stdlib_coroutines {
-  
-  cls_type get_coroutine_class_prototype(data_vector& args, const char* format) {
+
+  cls_type get_coroutine_class_prototype(data_vector& args, const char* name, const char* format) {
     bool found = false;
     auto val = G.GLOBAL_ENVIRONMENT_POINTER->lookup_variable_value("coroutine", found);
-    if(!found || !val.is_type(types::cls)) 
-      HEIST_THROW_ERR("'cycle-coroutines! 'coroutine symbol isn't bound to a class prototype!"
-        << format << HEIST_FCN_ERR("cycle-coroutines!",args));
+    if(!found || !val.is_type(types::cls))
+      HEIST_THROW_ERR('\''<<name<<" 'coroutine symbol isn't bound to a class prototype!"
+        << format << HEIST_FCN_ERR(name,args));
     return val.cls;
   }
 
@@ -20,21 +20,105 @@ namespace heist::stdlib_coroutines {
     return d.is_type(types::obj) && d.obj->proto == coro_proto;
   }
 
+  /******************************************************************************
+  * COROUTINE OBJECT MEMBERS
+  ******************************************************************************/
+
+  data& get_coroutine_member(data& coroutine, const char* member, const char* name, const char* format) {
+    auto& members = coroutine.obj->member_names();
+    for(size_type i = 0, n = members.size(); i < n; ++i)
+      if(members[i] == member) return coroutine.obj->member_values[i];
+    HEIST_THROW_ERR('\''<<name<<" 'coroutine object " << coroutine
+      << " is missing the \"" << member << "\" member!" << format);
+    return coroutine; // never triggered
+  }
+
+  /******************************************************************************
+  * COROUTINE EXECUTION
+  ******************************************************************************/
+
+  // Swaps the stack-local interpreter state of the running fiber & its resumer
+  void swap_coroutine_stack_state(coroutine_fiber& fiber)noexcept{
+    GLOBALS::STACK_TRACE.swap(fiber.stack_trace);
+    std::swap(GLOBALS::ESCAPE_FRAMES,fiber.escape_frames);
+    std::swap(GLOBALS::APPLICATION_DEPTH,fiber.application_depth);
+    GLOBALS::RECURSIVE_DEPTHS.swap(fiber.recursive_depths);
+  }
+
+
+  // Withdraw/reinstate the recursive depths raised by the running fiber's applications
+  //   while it's suspended (else suspended coroutines count against their procedures)
+  void withdraw_coroutine_recursive_depths()noexcept{
+    for(auto depth : GLOBALS::RECURSIVE_DEPTHS) --*depth;
+  }
+
+  void reinstate_coroutine_recursive_depths()noexcept{
+    for(auto depth : GLOBALS::RECURSIVE_DEPTHS) ++*depth;
+  }
+
+
+  // Runs on the fiber's stack (hence swaps in its state, even when unwinding a cancellation)
+  data apply_coroutine_thunk(data& thunk) {
+    auto& fiber = *coroutine_fiber::running();
+    swap_coroutine_stack_state(fiber);
+    try {
+      auto result = execute_application(thunk,data_vector(),G.GLOBAL_ENVIRONMENT_POINTER,false,false);
+      swap_coroutine_stack_state(fiber);
+      return result;
+    } catch(...) {
+      swap_coroutine_stack_state(fiber);
+      throw;
+    }
+  }
+
+
+  // Suspends the running fiber (swapping its state out until resumed)
+  void suspend_coroutine(coroutine_fiber& fiber) {
+    withdraw_coroutine_recursive_depths();
+    swap_coroutine_stack_state(fiber);
+    try {
+      fiber.suspend();
+    } catch(...) { // cancelled
+      swap_coroutine_stack_state(fiber);
+      reinstate_coroutine_recursive_depths();
+      throw;
+    }
+    swap_coroutine_stack_state(fiber);
+    reinstate_coroutine_recursive_depths();
+  }
+
 
-  data invoke_coroutine_NEXT_method(data& d, const char* format) {
-    auto& methods = d.obj->method_names;
-    for(size_type i = 0, n = methods.size(); i < n; ++i) {
-      if(methods[i] == "next") {
-        auto& env = d.obj->proto->defn_env;
-        d = d.obj->method_values[i].fcn.bind_self(d.obj);
-        return execute_application(d,data_vector(),env);
-      }
+  // Runs <coroutine> until it yields (returning <coroutine> w/ its new "value")
+  //   or finishes (returning its result). Coroutines launch their fiber upon
+  //   their 1st resumption.
+  data resume_coroutine(data& coroutine, const char* name, const char* format) {
+    auto& fiber_member = get_coroutine_member(coroutine,"coroutine:private:fiber",name,format);
+    if(fiber_member.is_type(types::fcn))
+      fiber_member = fib_type(coroutine_fiber(fiber_member,apply_coroutine_thunk));
+    if(!fiber_member.is_type(types::fib))
+      HEIST_THROW_ERR('\''<<name<<" 'coroutine object " << coroutine
+        << " doesn't have a fiber!" << format);
+    auto fiber = fiber_member.fib; // keep alive while running
+    if(fiber->state == coroutine_fiber::status::running)
+      HEIST_THROW_ERR('\''<<name<<" 'coroutine object " << coroutine
+        << " is already running!" << format);
+    if(fiber->state == coroutine_fiber::status::finished)
+      HEIST_THROW_ERR('\''<<name<<" 'coroutine object " << coroutine
+        << " already finished!" << format);
+    try {
+      fiber->resume();
+    } catch(const coroutine_fiber_allocation_failure&) {
+      HEIST_THROW_ERR('\''<<name<<" couldn't allocate a native stack for coroutine object " << coroutine 
+        << "!\n     => Too many coroutines are live at once: each unfinished coroutine holds its own"
+           "\n        stack, & the OS caps how many may be mapped (see \"vm.max_map_count\" on Linux)."
+           "\n     => Let unused coroutines finish or be discarded (or raise the OS' limit)." << format);
     }
-    HEIST_THROW_ERR("'cycle-coroutines! 'coroutine object " << d
-      << " is missing the \"next\" method!" << format); 
-    return data(); // never triggered
+    if(fiber->state == coroutine_fiber::status::finished)
+      return std::move(fiber->transfer);
+    get_coroutine_member(coroutine,"value",name,format) = std::move(fiber->transfer);
+    return coroutine;
   }
 
 } // End of namespace heist::stdlib_coroutines
 
-#endif
\ No newline at end of file
+#endif
@@ -158,6 +158,29 @@ namespace heist::stdlib_ports {
     return confirm_valid_io_file(filename, name, format, "a", args);
   }
 
+  /******************************************************************************
+  * PORT OPENING FROM STRINGS
+  ******************************************************************************/
+
+  // Returns a file pointer to an in-memory copy of <contents>, positioned at its start
+  // => Uses <fmemopen> where supported, else an anonymous temporary file
+  FILE* open_input_string_stream(const data& contents, const char* name, 
+                                 const char* format,   const data_vector& args) {
+#if defined(__unix__) || defined(__APPLE__)
+    FILE* fp = fmemopen(nullptr, contents.str->size()+1, "w+"); // +1 for fmemopen's null-terminator
+#else
+    FILE* fp = tmpfile();
+#endif
+    if(fp == nullptr)
+      HEIST_THROW_ERR('\'' << name << " couldn't open an in-memory port!" << format << HEIST_FCN_ERR(name,args));
+    if(fwrite(contents.str->data(), 1, contents.str->size(), fp) != contents.str->size()) {
+      fclose(fp);
+      HEIST_THROW_ERR('\'' << name << " couldn't copy its string into an in-memory port!" << format << HEIST_FCN_ERR(name,args));
+    }
+    rewind(fp);
+    return fp;
+  }
+
   /******************************************************************************
   * PORT-SEEK! & PORT-SEEK-FRONT!
   ******************************************************************************/
@@ -199,6 +222,53 @@ namespace heist::stdlib_ports {
     return boolean(!result);
   }
 
+  /******************************************************************************
+  * FLUSH-OUTPUT-PORT & SET-PORT-BUFFERING!
+  ******************************************************************************/
+
+  // Get the open output port of <args> (defaults to the current output port)
+  FILE* get_open_output_port(data_vector& args, const char* name, const char* format) {
+    if(args.empty()) return primitive_toolkit::get_current_output_port(args,name,format);
+    if(args.size() != 1)
+      HEIST_THROW_ERR('\''<<name<<" received incorrect # of args!"<<format<<HEIST_FCN_ERR(name,args));
+    if(!args[0].is_type(types::fop) || !args[0].fop.is_open())
+      HEIST_THROW_ERR('\''<<name<<" arg "<<HEIST_PROFILE(args[0])<<" isn't an open output port!"
+        <<format<<HEIST_FCN_ERR(name,args));
+    return *args[0].fop.fp;
+  }
+
+
+  // Convert <mode> into a buffering mode
+  port_buffering convert_symbol_to_port_buffering(data_vector& args, const char* format) {
+    if(args[1].is_type(types::sym)) {
+      if(args[1].sym == "none")  return port_buffering::none;
+      if(args[1].sym == "line")  return port_buffering::line;
+      if(args[1].sym == "block") return port_buffering::block;
+    }
+    HEIST_THROW_ERR("'set-port-buffering! 2nd arg "<<HEIST_PROFILE(args[1])<<" isn't a buffering mode!"
+      <<format<<HEIST_FCN_ERR("set-port-buffering!",args));
+    return port_buffering::none;
+  }
+
+
+  // Set <outs>'s stdio buffer to <mode>
+  // => "setvbuf" is only defined before a stream's 1st operation, hence file
+  //    ports must have their buffering set before being written to
+  // => Stdout is never "setvbuf"'d, since the interpreter writes to it before
+  //    any code runs: its mode only toggles flushing stdout after each write
+  void set_port_buffering(FILE* outs, const port_buffering mode)noexcept{
+    fflush(outs);
+    if(outs == stdout) {
+      STDOUT_BUFFERING = mode;
+      return;
+    }
+    switch(mode) {
+      case port_buffering::none: setvbuf(outs,nullptr,_IONBF,0); break;
+      case port_buffering::line: setvbuf(outs,nullptr,_IOLBF,BUFSIZ); break;
+      default:                   setvbuf(outs,nullptr,_IOFBF,BUFSIZ);
+    }
+  }
+
 } // End of namespace heist::stdlib_ports
 
 #endif
\ No newline at end of file
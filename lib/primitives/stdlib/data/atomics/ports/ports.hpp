@@ -82,6 +82,12 @@ namespace heist {
     return iport(stdlib_ports::confirm_valid_input_file(args[0],"open-input-file","\n     (open-input-file <filename-string>)",args));
   }
 
+  data primitive_OPEN_INPUT_STRING(data_vector&& args){ // reads from a copy of the string
+    static constexpr const char * const format = "\n     (open-input-string <string>)";
+    stdlib_ports::confirm_given_one_string_arg(args,"open-input-string",format);
+    return iport(stdlib_ports::open_input_string_stream(args[0],"open-input-string",format,args));
+  }
+
   data primitive_OPEN_OUTPUT_FILE(data_vector&& args){ // open iff filename dne
     // confirm given a filename string
     stdlib_ports::confirm_given_one_arg(args,"open-output-file");
@@ -131,6 +137,26 @@ namespace heist {
     return GLOBALS::VOID_DATA_OBJECT;
   }
 
+  // flush pending buffered output
+  data primitive_FLUSH_OUTPUT_PORT(data_vector&& args){
+    static constexpr const char * const format = "\n     (flush-output-port <optional-open-output-port>)";
+    fflush(stdlib_ports::get_open_output_port(args,"flush-output-port",format));
+    return GLOBALS::VOID_DATA_OBJECT;
+  }
+
+  // set an output port's buffering mode
+  data primitive_SET_PORT_BUFFERING_BANG(data_vector&& args){
+    static constexpr const char * const format = 
+      "\n     (set-port-buffering! <open-output-port> <mode-symbol>)"
+      "\n     <mode-symbol> ::= none | line | block";
+    if(args.size() != 2)
+      HEIST_THROW_ERR("'set-port-buffering! didn't receive 2 args!"<<format<<HEIST_FCN_ERR("set-port-buffering!",args));
+    data_vector port_arg(1,args[0]);
+    FILE* outs = stdlib_ports::get_open_output_port(port_arg,"set-port-buffering!",format);
+    stdlib_ports::set_port_buffering(outs,stdlib_ports::convert_symbol_to_port_buffering(args,format));
+    return GLOBALS::VOID_DATA_OBJECT;
+  }
+
 } // End of namespace heist
 
 #endif
\ No newline at end of file
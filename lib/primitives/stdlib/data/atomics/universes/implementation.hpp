@@ -4,17 +4,611 @@
 #ifndef HEIST_SCHEME_CORE_STDLIB_UNIVERSES_IMPLEMENTATION_HPP_
 #define HEIST_SCHEME_CORE_STDLIB_UNIVERSES_IMPLEMENTATION_HPP_
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
 namespace heist::stdlib_universes {
 
   cls_type get_universe_class_prototype(data_vector& args, const char* format) {
     bool found = false;
     auto val = G.GLOBAL_ENVIRONMENT_POINTER->lookup_variable_value("universe", found);
-    if(!found || !val.is_type(types::cls)) 
+    if(!found || !val.is_type(types::cls))
       HEIST_THROW_ERR("'heist:core:universe:eval 'universe symbol isn't bound to a class prototype!"
-        << format << HEIST_FCN_ERR("heist:core:universe:eval",args)); 
+        << format << HEIST_FCN_ERR("heist:core:universe:eval",args));
     return val.cls;
   }
 
+  /******************************************************************************
+  * CHANNEL REGISTRY
+  ******************************************************************************/
+
+  // Channels are shared by every thread's universe, & hence hold their messages
+  //   as serialized fasl strings (universes never share reference-counted data)
+  struct universe_channel {
+    std::mutex mutex;
+    std::condition_variable message_ready;
+    std::deque<string> messages;
+    bool closed = false;
+  };
+
+
+  // Process-wide registry of channels (closed channels are erased once emptied)
+  struct channel_registry_t {
+    std::mutex mutex;
+    std::unordered_map<size_type,std::shared_ptr<universe_channel>> channels;
+    size_type total_channels = 0;
+  };
+
+  channel_registry_t CHANNEL_REGISTRY;
+
+
+  size_type open_channel()noexcept{
+    std::lock_guard<std::mutex> lock(CHANNEL_REGISTRY.mutex);
+    const size_type id = CHANNEL_REGISTRY.total_channels++;
+    CHANNEL_REGISTRY.channels.emplace(id,std::make_shared<universe_channel>());
+    return id;
+  }
+
+
+  // Returns nullptr if channel <id> was closed & emptied
+  std::shared_ptr<universe_channel> find_channel(const size_type id)noexcept{
+    std::lock_guard<std::mutex> lock(CHANNEL_REGISTRY.mutex);
+    auto entry = CHANNEL_REGISTRY.channels.find(id);
+    if(entry == CHANNEL_REGISTRY.channels.end()) return nullptr;
+    return entry->second;
+  }
+
+
+  void erase_channel(const size_type id)noexcept{
+    std::lock_guard<std::mutex> lock(CHANNEL_REGISTRY.mutex);
+    CHANNEL_REGISTRY.channels.erase(id);
+  }
+
+  /******************************************************************************
+  * CHANNEL MESSAGES
+  ******************************************************************************/
+
+  // Returns whether <message> was sent (fails if channel <id> is closed)
+  bool put_channel_message(const size_type id, string&& message)noexcept{
+    auto channel = find_channel(id);
+    if(!channel) return false;
+    {
+      std::lock_guard<std::mutex> lock(channel->mutex);
+      if(channel->closed) return false;
+      channel->messages.push_back(std::move(message));
+    }
+    channel->message_ready.notify_one();
+    return true;
+  }
+
+
+  // Blocks until a message is ready, returning false if channel <id> is closed & empty
+  bool get_channel_message(const size_type id, string& message)noexcept{
+    auto channel = find_channel(id);
+    if(!channel) return false;
+    std::unique_lock<std::mutex> lock(channel->mutex);
+    channel->message_ready.wait(lock,[&]{return !channel->messages.empty() || channel->closed;});
+    if(channel->messages.empty()) {
+      lock.unlock();
+      erase_channel(id);
+      return false;
+    }
+    message = std::move(channel->messages.front());
+    channel->messages.pop_front();
+    return true;
+  }
+
+
+  // Whether getting a message from channel <id> won't block
+  bool channel_is_ready(const size_type id)noexcept{
+    auto channel = find_channel(id);
+    if(!channel) return true;
+    std::lock_guard<std::mutex> lock(channel->mutex);
+    return !channel->messages.empty() || channel->closed;
+  }
+
+
+  void close_channel(const size_type id)noexcept{
+    auto channel = find_channel(id);
+    if(!channel) return;
+    bool emptied = false;
+    {
+      std::lock_guard<std::mutex> lock(channel->mutex);
+      channel->closed = true;
+      emptied = channel->messages.empty();
+    }
+    channel->message_ready.notify_all();
+    if(emptied) erase_channel(id);
+  }
+
+  /******************************************************************************
+  * CHANNEL OBJECTS
+  ******************************************************************************/
+
+  // Channel objects are instances of the "channel" class (see "stdlib.scm")
+  bool get_channel_id(const data& d, size_type& id)noexcept{
+    if(!d.is_type(types::obj) || d.obj->proto->class_name != "channel") return false;
+    for(size_type i = 0, n = d.obj->member_names().size(); i < n; ++i) {
+      if(d.obj->member_names()[i] == "channel:private:id") {
+        if(!d.obj->member_values[i].is_type(types::num) || !d.obj->member_values[i].num.is_integer() ||
+            d.obj->member_values[i].num.is_neg()) return false;
+        id = (size_type)d.obj->member_values[i].num.extract_inexact();
+        return true;
+      }
+    }
+    return false;
+  }
+
+
+  data make_channel_object(const size_type id, const data_vector& args, const char* name, const char* format) {
+    bool found = false;
+    auto val = G.GLOBAL_ENVIRONMENT_POINTER->lookup_variable_value("channel", found);
+    if(!found || !val.is_type(types::cls))
+      HEIST_THROW_ERR('\''<<name<<" 'channel symbol isn't bound to a class prototype!"
+        << format << HEIST_FCN_ERR(name,args));
+    data_vector make_object_args(2);
+    make_object_args[0] = std::move(val);
+    make_object_args[1] = make_vec(data_vector(1,num_type(id)));
+    return primitive_HEIST_CORE_OO_MAKE_OBJECT(std::move(make_object_args));
+  }
+
+
+  size_type confirm_channel_arg(const data& d, const data_vector& args, const char* name, const char* format) {
+    size_type id = 0;
+    if(!get_channel_id(d,id))
+      HEIST_THROW_ERR('\''<<name<<" arg "<<HEIST_PROFILE(d)<<" isn't a channel!"
+        << format << HEIST_FCN_ERR(name,args));
+    return id;
+  }
+
+  /******************************************************************************
+  * MESSAGE SERIALIZATION (EACH UNIVERSE ONLY EVER TOUCHES ITS OWN DATA)
+  ******************************************************************************/
+
+  string serialize_message(const data& d, const data_vector& args, const char* name, const char* format) {
+    stdlib_fasl::fasl_writer writer(nullptr,args,format,name,true);
+    writer.write_datum(d);
+    return std::move(writer.fasl);
+  }
+
+
+  data deserialize_message(const string& message, const data_vector& args, const char* name, const char* format) {
+    stdlib_fasl::fasl_reader reader(message,args,format,name,true);
+    return reader.read();
+  }
+
+  /******************************************************************************
+  * UNIVERSE THREADS
+  ******************************************************************************/
+
+  // Process-independent invariants inherited by spawned universes
+  struct spawned_universe_settings {
+    bool using_ansi_escape_sequences = true;
+    bool using_case_sensitive_symbols = true;
+    str_vector argv;
+  };
+
+
+  // Threads of spawned universes (joined before the process exits)
+  struct universe_thread {
+    std::thread thread;
+    std::shared_ptr<std::atomic<bool>> finished;
+  };
+
+  struct universe_thread_registry_t {
+    std::mutex mutex;
+    std::vector<universe_thread> threads;
+  };
+
+  universe_thread_registry_t UNIVERSE_THREAD_REGISTRY;
+
+
+  void join_universe_threads()noexcept{
+    for(;;) { // joined universes may have spawned more universes
+      std::vector<universe_thread> threads;
+      {
+        std::lock_guard<std::mutex> lock(UNIVERSE_THREAD_REGISTRY.mutex);
+        threads = std::move(UNIVERSE_THREAD_REGISTRY.threads);
+        UNIVERSE_THREAD_REGISTRY.threads.clear();
+      }
+      if(threads.empty()) return;
+      for(auto& t : threads) t.thread.join();
+    }
+  }
+
+
+  // Apply the procedure <datum> evaluates to (in a new universe) to its arguments,
+  //   then put the result in channel <result_id>
+  // => <application> is the serialized list: (<datum> <argument> ...)
+  spawned_universe_settings get_spawned_universe_settings()noexcept{
+    spawned_universe_settings settings;
+    settings.using_ansi_escape_sequences = G.USING_ANSI_ESCAPE_SEQUENCES;
+    settings.using_case_sensitive_symbols = GLOBALS::USING_CASE_SENSITIVE_SYMBOLS;
+    for(const auto& arg : GLOBALS::ARGV) settings.argv.push_back(*arg);
+    return settings;
+  }
+
+
+  // Initializes the current thread's universe w/ Heist's default bindings
+  void initialize_spawned_universe(const spawned_universe_settings& settings)noexcept{
+    G.USING_ANSI_ESCAPE_SEQUENCES = settings.using_ansi_escape_sequences;
+    GLOBALS::USING_CASE_SENSITIVE_SYMBOLS = settings.using_case_sensitive_symbols;
+    for(const auto& arg : settings.argv) GLOBALS::ARGV.push_back(make_str(arg));
+    set_default_global_environment();
+    GLOBALS::STACK_TRACE.clear();
+  }
+
+
+  // Evaluates <datum> in the current thread's universe as a procedure
+  data eval_procedure_datum(const data& datum, const char* name, const char* format) {
+    data_vector eval_args(3);
+    eval_args[0] = datum;
+    eval_args[1] = symconst::global_env;
+    eval_args[2] = G.GLOBAL_ENVIRONMENT_POINTER; // ignored
+    auto procedure = primitive_EVAL(std::move(eval_args));
+    primitive_toolkit::confirm_data_is_callable(procedure,data_vector(1,datum),name,format);
+    return primitive_toolkit::convert_callable_to_procedure(procedure);
+  }
+
+
+  void run_spawned_universe(const string& application, const size_type result_id, const spawned_universe_settings& settings)noexcept{
+    static constexpr const char * const format = "\n     (spawn-universe <procedure-datum> <argument> ...)";
+    initialize_spawned_universe(settings);
+    data datum;
+    try {
+      auto arguments = primitive_toolkit::convert_proper_list_to_data_vector(
+        deserialize_message(application,data_vector(),"spawn-universe",format));
+      datum = arguments[0];
+      arguments.erase(arguments.begin());
+      // apply the procedure <datum> evals to, & send back its result
+      auto procedure = eval_procedure_datum(datum,"spawn-universe",format);
+      auto result = execute_application(procedure,std::move(arguments),G.GLOBAL_ENVIRONMENT_POINTER,false,false);
+      put_channel_message(result_id,serialize_message(result,data_vector(1,datum),"spawn-universe",format));
+    } catch(const SCM_EXCEPT& eval_throw) {
+      // sandboxed exit
+      if(eval_throw == SCM_EXCEPT::EXIT) {
+        put_channel_message(result_id,serialize_message(num_type(GLOBALS::HEIST_EXIT_CODE),data_vector(),"spawn-universe",format));
+      } else {
+        fprintf(stderr, "\n  %s>> Spawned Universe Exception:%s\n     Procedure: %s\n%s",
+          HEIST_AFMT(AFMT_135), HEIST_AFMT(AFMT_01), datum.noexcept_write().c_str(), HEIST_AFMT(AFMT_0));
+      }
+    } catch(...) {
+      HEIST_PRINT_ERR("Uncaught C++ Exception Detected! -:- BUG ALERT -:-"
+           "\n     Triggered By Spawned Universe Procedure: " << datum.noexcept_write() <<
+           "\n  => Please send your code to jordanran199@gmail.com to fix"
+           "\n     the interpreter's bug!\n");
+    }
+    close_channel(result_id);
+  }
+
+
+  void launch_universe_thread(string&& application, const size_type result_id) {
+    static std::once_flag joining_at_exit;
+    std::call_once(joining_at_exit,[]{std::atexit(join_universe_threads);});
+    auto settings = get_spawned_universe_settings();
+    auto finished = std::make_shared<std::atomic<bool>>(false);
+    std::thread thread([application=std::move(application),result_id,settings=std::move(settings),finished]{
+      run_spawned_universe(application,result_id,settings);
+      finished->store(true);
+    });
+    std::lock_guard<std::mutex> lock(UNIVERSE_THREAD_REGISTRY.mutex);
+    // join universes that already finished
+    auto& threads = UNIVERSE_THREAD_REGISTRY.threads;
+    for(size_type i = threads.size(); i-- > 0;) {
+      if(threads[i].finished->load()) {
+        threads[i].thread.join();
+        threads.erase(threads.begin()+i);
+      }
+    }
+    threads.push_back(universe_thread{std::move(thread),std::move(finished)});
+  }
+
+  /******************************************************************************
+  * PARALLEL SEQUENCE JOBS (WORK-STEALING POOL OF UNIVERSES)
+  ******************************************************************************/
+
+  // # of chunks each worker starts w/ (extra chunks are stolen by idle workers)
+  constexpr size_type PARALLEL_CHUNKS_PER_WORKER = 8;
+
+  enum class parallel_operation {map, for_each, reduce};
+
+
+  struct parallel_worker_queue {
+    std::mutex mutex;
+    std::deque<size_type> chunks;
+  };
+
+
+  // Chunk bounds only depend on the sequence length & worker count, hence
+  //   results (combined by chunk index) are deterministic regardless of stealing
+  // => Boxed elements are serialized per chunk, whereas homogeneous vectors are
+  //    shared read-only (the calling universe is blocked until the job is done)
+  struct parallel_job {
+    parallel_operation operation;
+    const char* name;
+    const char* format;
+    string procedure;                                // serialized procedure datum
+    string seed;                                     // serialized seed (reduce only)
+    std::vector<std::pair<size_type,size_type>> chunk_bounds;
+    std::vector<string> chunk_inputs;                // serialized element vectors (boxed only)
+    const homogeneous_vector* hvector = nullptr;     // shared elements (unboxed only)
+    homogeneous_vector* hvector_results = nullptr;   // shared results (unboxed map only)
+    std::vector<string> chunk_results;               // serialized result vectors/reductions
+    string result;                                   // serialized reduction
+    std::vector<parallel_worker_queue> queues;
+    std::atomic<size_type> remaining_chunks{0};
+    std::atomic<bool> failed{false};
+
+    parallel_job(const parallel_operation op, const char* fcn_name, const char* fcn_format, 
+                 const size_type length, const size_type total_workers)
+      : operation(op), name(fcn_name), format(fcn_format), queues(total_workers) {
+      const size_type total_chunks = std::min(length, total_workers * PARALLEL_CHUNKS_PER_WORKER);
+      for(size_type i = 0; i < total_chunks; ++i) {
+        chunk_bounds.push_back(std::make_pair((length * i) / total_chunks, (length * (i+1)) / total_chunks));
+        queues[(i * total_workers) / total_chunks].chunks.push_back(i); // contiguous chunks per worker
+      }
+      chunk_results.resize(total_chunks);
+      remaining_chunks = total_chunks;
+    }
+  };
+
+
+  // Pops from the back of <worker>'s queue, else steals from the front of another's
+  bool get_parallel_chunk(parallel_job& job, const size_type worker, size_type& chunk)noexcept{
+    for(size_type i = 0, n = job.queues.size(); i < n; ++i) {
+      auto& queue = job.queues[(worker + i) % n];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if(queue.chunks.empty()) continue;
+      if(!i) {
+        chunk = queue.chunks.back();
+        queue.chunks.pop_back();
+      } else {
+        chunk = queue.chunks.front();
+        queue.chunks.pop_front();
+      }
+      return true;
+    }
+    return false;
+  }
+
+
+  data_vector get_parallel_chunk_elements(const parallel_job& job, const size_type chunk) {
+    if(!job.hvector) 
+      return std::move(*deserialize_message(job.chunk_inputs[chunk],data_vector(),job.name,job.format).vec);
+    data_vector elements;
+    for(size_type i = job.chunk_bounds[chunk].first; i < job.chunk_bounds[chunk].second; ++i)
+      elements.push_back(job.hvector->ref(i));
+    return elements;
+  }
+
+
+  data apply_parallel_procedure(data& procedure, data_vector&& args) {
+    return execute_application(procedure,std::move(args),G.GLOBAL_ENVIRONMENT_POINTER,false,false);
+  }
+
+
+  void run_parallel_chunk(parallel_job& job, data& procedure, const size_type chunk) {
+    auto elements = get_parallel_chunk_elements(job,chunk);
+    switch(job.operation) {
+      case parallel_operation::map: {
+        data_vector results(elements.size());
+        for(size_type i = 0, n = elements.size(); i < n; ++i)
+          results[i] = apply_parallel_procedure(procedure,data_vector(1,elements[i]));
+        if(!job.hvector_results) {
+          job.chunk_results[chunk] = serialize_message(make_vec(std::move(results)),data_vector(),job.name,job.format);
+          return;
+        }
+        for(size_type i = 0, n = results.size(); i < n; ++i) {
+          if(!results[i].is_type(types::num) || !job.hvector_results->is_valid_element(results[i].num))
+            HEIST_THROW_ERR('\''<<job.name<<" result "<<HEIST_PROFILE(results[i])<<" isn't a valid "
+              << job.hvector_results->tag_name() << " homogeneous vector element!" << job.format);
+          job.hvector_results->set(job.chunk_bounds[chunk].first+i,results[i].num);
+        }
+        return;
+      }
+      case parallel_operation::for_each:
+        for(auto& elt : elements) apply_parallel_procedure(procedure,data_vector(1,elt));
+        return;
+      default: { // the 1st chunk folds from the seed, others from their 1st element
+        size_type i = 1;
+        data accumulator = elements[0];
+        if(!chunk) {
+          accumulator = deserialize_message(job.seed,data_vector(),job.name,job.format);
+          i = 0;
+        }
+        for(size_type n = elements.size(); i < n; ++i) {
+          data_vector args(2);
+          args[0] = std::move(accumulator);
+          args[1] = std::move(elements[i]);
+          accumulator = apply_parallel_procedure(procedure,std::move(args));
+        }
+        job.chunk_results[chunk] = serialize_message(accumulator,data_vector(),job.name,job.format);
+      }
+    }
+  }
+
+
+  // Folds the reduced chunks in order (run by the worker finishing the last chunk)
+  void combine_parallel_reductions(parallel_job& job, data& procedure) {
+    data accumulator = deserialize_message(job.chunk_results[0],data_vector(),job.name,job.format);
+    for(size_type i = 1, n = job.chunk_results.size(); i < n; ++i) {
+      data_vector args(2);
+      args[0] = std::move(accumulator);
+      args[1] = deserialize_message(job.chunk_results[i],data_vector(),job.name,job.format);
+      accumulator = apply_parallel_procedure(procedure,std::move(args));
+    }
+    job.result = serialize_message(accumulator,data_vector(),job.name,job.format);
+  }
+
+
+  // Resets the current worker thread's universe from its booted snapshot
+  //   (booted upon the thread's 1st job)
+  void reset_parallel_worker_universe(const spawned_universe_settings& settings) {
+    GLOBALS::USING_CASE_SENSITIVE_SYMBOLS = settings.using_case_sensitive_symbols;
+    GLOBALS::ARGV.clear();
+    for(const auto& arg : settings.argv) GLOBALS::ARGV.push_back(make_str(arg));
+    stdlib_sysinterface::reset_process_invariant_state();
+    G.USING_ANSI_ESCAPE_SEQUENCES = settings.using_ansi_escape_sequences;
+    GLOBALS::STACK_TRACE.clear();
+  }
+
+
+  void run_parallel_worker(parallel_job& job, const size_type worker, const spawned_universe_settings& settings)noexcept{
+    data datum;
+    try {
+      reset_parallel_worker_universe(settings);
+      datum = deserialize_message(job.procedure,data_vector(),job.name,job.format);
+      auto procedure = eval_procedure_datum(datum,job.name,job.format);
+      size_type chunk = 0;
+      while(!job.failed.load() && get_parallel_chunk(job,worker,chunk)) {
+        run_parallel_chunk(job,procedure,chunk);
+        if(job.remaining_chunks.fetch_sub(1) == 1 && job.operation == parallel_operation::reduce)
+          combine_parallel_reductions(job,procedure);
+      }
+    } catch(const SCM_EXCEPT& eval_throw) {
+      job.failed.store(true);
+      if(eval_throw != SCM_EXCEPT::EXIT)
+        fprintf(stderr, "\n  %s>> Parallel Worker Universe Exception:%s\n     Procedure: %s\n%s",
+          HEIST_AFMT(AFMT_135), HEIST_AFMT(AFMT_01), datum.noexcept_write().c_str(), HEIST_AFMT(AFMT_0));
+    } catch(...) {
+      job.failed.store(true);
+      HEIST_PRINT_ERR("Uncaught C++ Exception Detected! -:- BUG ALERT -:-"
+           "\n     Triggered By Parallel Worker Universe Procedure: " << datum.noexcept_write() <<
+           "\n  => Please send your code to jordanran199@gmail.com to fix"
+           "\n     the interpreter's bug!\n");
+    }
+  }
+
+
+  // Shares <sequence>'s elements w/ <job>'s workers (PRECONDITION: <sequence> is a vector or hvector)
+  void set_parallel_job_elements(parallel_job& job, data& sequence, const data_vector& args) {
+    if(sequence.is_type(types::hvc)) {
+      job.hvector = &*sequence.hvc;
+      return;
+    }
+    for(const auto& bounds : job.chunk_bounds)
+      job.chunk_inputs.push_back(serialize_message(make_vec(data_vector(sequence.vec->begin()+bounds.first,
+        sequence.vec->begin()+bounds.second)),args,job.name,job.format));
+  }
+
+
+  // Validates <args> (w/ the sequence last & the procedure datum first), then 
+  //   splits the sequence into chunks across "parallel-workers" worker queues
+  std::unique_ptr<parallel_job> new_parallel_job(const parallel_operation op, data_vector& args, const char* name, const char* format) {
+    const size_type total_args = op == parallel_operation::reduce ? 3 : 2;
+    if(args.size() != total_args)
+      HEIST_THROW_ERR('\''<<name<<" didn't receive "<<total_args<<" args!"<<format<<HEIST_FCN_ERR(name,args));
+    auto& sequence = args.back();
+    if(!sequence.is_type(types::vec) && !sequence.is_type(types::hvc))
+      HEIST_THROW_ERR('\''<<name<<" last arg "<<HEIST_PROFILE(sequence)<<" isn't a vector or homogeneous vector!"
+        <<format<<HEIST_FCN_ERR(name,args));
+    const size_type length = sequence.is_type(types::hvc) ? sequence.hvc->size() : sequence.vec->size();
+    auto job = std::make_unique<parallel_job>(op,name,format,length,std::max(size_type(1),G.PARALLEL_WORKERS));
+    job->procedure = serialize_message(args[0],args,name,format);
+    if(op == parallel_operation::reduce) job->seed = serialize_message(args[1],args,name,format);
+    set_parallel_job_elements(*job,sequence,args);
+    return job;
+  }
+
+
+  /******************************************************************************
+  * PARALLEL WORKER POOL
+  ******************************************************************************/
+
+  // Persistent worker threads, each keeping its universe between jobs. Jobs are 
+  //   assigned to idle workers, & the pool grows whenever too few are idle (IE 
+  //   for jobs run by other jobs' workers). Joined before the process exits.
+  struct parallel_job_assignment {
+    parallel_job* job;
+    size_type worker;                           // index of the job's queue to start from
+    const spawned_universe_settings* settings;
+    size_type* remaining_workers;               // of the job (guarded by the pool's mutex)
+  };
+
+  struct parallel_worker_pool_t {
+    std::mutex mutex;
+    std::condition_variable job_assigned, job_finished;
+    std::deque<parallel_job_assignment> assignments;
+    std::vector<std::thread> threads;
+    size_type idle_workers = 0;
+    bool shutting_down = false;
+  };
+
+  parallel_worker_pool_t PARALLEL_WORKER_POOL;
+
+
+  void run_parallel_worker_thread()noexcept{
+    auto& pool = PARALLEL_WORKER_POOL;
+    std::unique_lock<std::mutex> lock(pool.mutex);
+    for(;;) {
+      pool.job_assigned.wait(lock,[&]{return pool.shutting_down || !pool.assignments.empty();});
+      if(pool.assignments.empty()) return;
+      auto assignment = pool.assignments.front();
+      pool.assignments.pop_front();
+      --pool.idle_workers;
+      lock.unlock();
+      run_parallel_worker(*assignment.job,assignment.worker,*assignment.settings);
+      lock.lock();
+      ++pool.idle_workers;
+      --*assignment.remaining_workers;
+      pool.job_finished.notify_all();
+    }
+  }
+
+
+  void join_parallel_worker_threads()noexcept{
+    auto& pool = PARALLEL_WORKER_POOL;
+    {
+      std::lock_guard<std::mutex> lock(pool.mutex);
+      pool.shutting_down = true;
+    }
+    pool.job_assigned.notify_all();
+    for(auto& thread : pool.threads) thread.join();
+  }
+
+
+  // Ensures <total_workers> idle workers aren't yet assigned a job, returning how
+  //   many are available (fewer if threads failed to spawn)
+  // PRECONDITION: PARALLEL_WORKER_POOL.mutex is locked
+  size_type reserve_parallel_workers(const size_type total_workers)noexcept{
+    static std::once_flag joining_at_exit;
+    std::call_once(joining_at_exit,[]{std::atexit(join_parallel_worker_threads);});
+    auto& pool = PARALLEL_WORKER_POOL;
+    while(pool.idle_workers - pool.assignments.size() < total_workers) {
+      try {
+        pool.threads.emplace_back(run_parallel_worker_thread);
+      } catch(const std::system_error&) {
+        break;
+      }
+      ++pool.idle_workers;
+    }
+    return std::min(total_workers, pool.idle_workers - pool.assignments.size());
+  }
+
+
+  // Runs <job> across its workers' universes
+  // => Workers that fail to spawn simply have their chunks stolen by the others
+  void run_parallel_job(parallel_job& job, const data_vector& args) {
+    if(job.chunk_bounds.empty()) return;
+    auto settings = get_spawned_universe_settings();
+    auto& pool = PARALLEL_WORKER_POOL;
+    std::unique_lock<std::mutex> lock(pool.mutex);
+    size_type remaining_workers = reserve_parallel_workers(job.queues.size());
+    if(!remaining_workers)
+      HEIST_THROW_ERR('\''<<job.name<<" couldn't spawn any worker threads!"<<job.format<<HEIST_FCN_ERR(job.name,args));
+    for(size_type i = 0; i < remaining_workers; ++i)
+      pool.assignments.push_back(parallel_job_assignment{&job,i,&settings,&remaining_workers});
+    pool.job_assigned.notify_all();
+    pool.job_finished.wait(lock,[&]{return !remaining_workers;});
+    lock.unlock();
+    if(job.failed.load() || job.remaining_chunks.load())
+      HEIST_THROW_ERR('\''<<job.name<<" procedure datum "<<HEIST_PROFILE(args[0])<<" failed in a worker universe!"
+        <<job.format<<HEIST_FCN_ERR(job.name,args));
+  }
+
 } // End of namespace heist::stdlib_universes
 
-#endif
\ No newline at end of file
+#endif
@@ -1,6 +1,7 @@
 // Author: Jordan Randleman -- jordanran199@gmail.com -- universes.hpp
 // => Defines an internally-used specialized "eval" procedure for "universe" 
-//    objects of the Heist Scheme Interpreter
+//    objects, & the thread-confined universe, channel, & parallel sequence
+//    primitives, of the Heist Scheme Interpreter
 
 #ifndef HEIST_SCHEME_CORE_STDLIB_UNIVERSES_HPP_
 #define HEIST_SCHEME_CORE_STDLIB_UNIVERSES_HPP_
@@ -24,6 +25,14 @@
  *   order to expose a specialized version of "eval" that, in addition to evaluating data
  *   as code, also provides the infrastructure to switch between process invariants.
  *
+ *   Said invariants (along w/ the GC & stack trace) are thread-local, hence 
+ *   "spawn-universe" may run a procedure in a new universe on its own thread. 
+ *   Universes never share data: they communicate via "channel"s, which hold
+ *   messages as fasl strings (see "fasl-write").
+ *
+ *   "pmap", "pfor-each", & "preduce" likewise apply a procedure datum across a
+ *   pool of universes, w/ idle workers stealing chunks of elements from busy ones.
+ *
  */
 
 namespace heist {
@@ -37,8 +46,8 @@ namespace heist {
     if(!args[1].is_type(types::obj) || args[1].obj->proto != stdlib_universes::get_universe_class_prototype(args,format))
       HEIST_THROW_ERR("'heist:core:universe:eval 2nd arg " << HEIST_PROFILE(args[1])
         << " isn't a <universe> object!" << format << HEIST_FCN_ERR("heist:core:universe:eval",args));
-    for(size_type i = 0, n = args[1].obj->member_names.size(); i < n; ++i) {
-      if(args[1].obj->member_names[i] == "universe:private:env") {
+    for(size_type i = 0, n = args[1].obj->member_names().size(); i < n; ++i) {
+      if(args[1].obj->member_names()[i] == "universe:private:env") {
         // Create new environment as needed
         if(!args[1].obj->member_values[i].is_type(types::prc)) {
           auto old_invariants = stdlib_sysinterface::reset_process_invariant_state();
@@ -81,6 +90,132 @@ namespace heist {
     return data(); // NEVER TRIGGERED
   }
 
+  /******************************************************************************
+  * THREAD-CONFINED UNIVERSES
+  ******************************************************************************/
+
+  data primitive_SPAWN_UNIVERSE(data_vector&& args) {
+    static constexpr const char * const format = 
+      "\n     (spawn-universe <procedure-datum> <argument> ...)"
+      "\n     <argument> ::= <pair> | <vector> | <string> | <symbol> | <number> | <char>"
+      "\n                  | <boolean> | <hmap> | <homogeneous-vector> | <void> | <channel>";
+    if(args.empty())
+      HEIST_THROW_ERR("'spawn-universe didn't receive any args!" 
+        << format << HEIST_FCN_ERR("spawn-universe",args));
+    auto application = stdlib_universes::serialize_message(
+      primitive_toolkit::convert_data_vector_to_proper_list(args.begin(),args.end()),args,"spawn-universe",format);
+    const auto result_id = stdlib_universes::open_channel();
+    auto result_channel = stdlib_universes::make_channel_object(result_id,args,"spawn-universe",format);
+    stdlib_universes::launch_universe_thread(std::move(application),result_id);
+    return result_channel;
+  }
+
+  /******************************************************************************
+  * CHANNELS
+  ******************************************************************************/
+
+  data primitive_MAKE_CHANNEL(data_vector&& args) {
+    static constexpr const char * const format = "\n     (make-channel)";
+    if(!args.empty())
+      HEIST_THROW_ERR("'make-channel doesn't accept any args!" 
+        << format << HEIST_FCN_ERR("make-channel",args));
+    return stdlib_universes::make_channel_object(stdlib_universes::open_channel(),args,"make-channel",format);
+  }
+
+
+  data primitive_CHANNEL_PUT_BANG(data_vector&& args) {
+    static constexpr const char * const format = 
+      "\n     (channel-put! <channel> <obj>)"
+      "\n     <obj> ::= <pair> | <vector> | <string> | <symbol> | <number> | <char>"
+      "\n             | <boolean> | <hmap> | <homogeneous-vector> | <void> | <channel>";
+    if(args.size() != 2)
+      HEIST_THROW_ERR("'channel-put! didn't receive 2 args!" 
+        << format << HEIST_FCN_ERR("channel-put!",args));
+    auto id = stdlib_universes::confirm_channel_arg(args[0],args,"channel-put!",format);
+    if(!stdlib_universes::put_channel_message(id,stdlib_universes::serialize_message(args[1],args,"channel-put!",format)))
+      HEIST_THROW_ERR("'channel-put! channel " << HEIST_PROFILE(args[0]) << " is closed!" 
+        << format << HEIST_FCN_ERR("channel-put!",args));
+    return GLOBALS::VOID_DATA_OBJECT;
+  }
+
+
+  data primitive_CHANNEL_GET(data_vector&& args) {
+    static constexpr const char * const format = "\n     (channel-get <channel>)";
+    if(args.size() != 1)
+      HEIST_THROW_ERR("'channel-get didn't receive 1 arg!" 
+        << format << HEIST_FCN_ERR("channel-get",args));
+    auto id = stdlib_universes::confirm_channel_arg(args[0],args,"channel-get",format);
+    string message;
+    if(!stdlib_universes::get_channel_message(id,message)) return chr_type(EOF);
+    return stdlib_universes::deserialize_message(message,args,"channel-get",format);
+  }
+
+
+  data primitive_CHANNEL_READYP(data_vector&& args) {
+    static constexpr const char * const format = "\n     (channel-ready? <channel>)";
+    if(args.size() != 1)
+      HEIST_THROW_ERR("'channel-ready? didn't receive 1 arg!" 
+        << format << HEIST_FCN_ERR("channel-ready?",args));
+    return boolean(stdlib_universes::channel_is_ready(stdlib_universes::confirm_channel_arg(args[0],args,"channel-ready?",format)));
+  }
+
+
+  data primitive_CHANNEL_CLOSE_BANG(data_vector&& args) {
+    static constexpr const char * const format = "\n     (channel-close! <channel>)";
+    if(args.size() != 1)
+      HEIST_THROW_ERR("'channel-close! didn't receive 1 arg!" 
+        << format << HEIST_FCN_ERR("channel-close!",args));
+    stdlib_universes::close_channel(stdlib_universes::confirm_channel_arg(args[0],args,"channel-close!",format));
+    return GLOBALS::VOID_DATA_OBJECT;
+  }
+
+  /******************************************************************************
+  * PARALLEL SEQUENCE OPERATIONS (ACROSS A WORK-STEALING POOL OF UNIVERSES)
+  ******************************************************************************/
+
+  data primitive_PMAP(data_vector&& args) {
+    static constexpr const char * const format = 
+      "\n     (pmap <procedure-datum> <sequence>)"
+      "\n     <sequence> ::= <vector> | <homogeneous-vector>";
+    auto job = stdlib_universes::new_parallel_job(stdlib_universes::parallel_operation::map,args,"pmap",format);
+    auto& sequence = args[1];
+    if(sequence.is_type(types::hvc)) {
+      homogeneous_vector results(sequence.hvc->tag(),sequence.hvc->size());
+      job->hvector_results = &results;
+      stdlib_universes::run_parallel_job(*job,args);
+      return make_hvc(std::move(results));
+    }
+    stdlib_universes::run_parallel_job(*job,args);
+    data_vector results;
+    results.reserve(sequence.vec->size());
+    for(const auto& chunk : job->chunk_results) {
+      auto chunk_results = stdlib_universes::deserialize_message(chunk,args,"pmap",format);
+      std::move(chunk_results.vec->begin(),chunk_results.vec->end(),std::back_inserter(results));
+    }
+    return make_vec(std::move(results));
+  }
+
+
+  data primitive_PFOR_EACH(data_vector&& args) {
+    static constexpr const char * const format = 
+      "\n     (pfor-each <procedure-datum> <sequence>)"
+      "\n     <sequence> ::= <vector> | <homogeneous-vector>";
+    auto job = stdlib_universes::new_parallel_job(stdlib_universes::parallel_operation::for_each,args,"pfor-each",format);
+    stdlib_universes::run_parallel_job(*job,args);
+    return GLOBALS::VOID_DATA_OBJECT;
+  }
+
+
+  data primitive_PREDUCE(data_vector&& args) {
+    static constexpr const char * const format = 
+      "\n     (preduce <associative-procedure-datum> <seed> <sequence>)"
+      "\n     <sequence> ::= <vector> | <homogeneous-vector>";
+    auto job = stdlib_universes::new_parallel_job(stdlib_universes::parallel_operation::reduce,args,"preduce",format);
+    if(job->chunk_bounds.empty()) return args[1];
+    stdlib_universes::run_parallel_job(*job,args);
+    return stdlib_universes::deserialize_message(job->result,args,"preduce",format);
+  }
+
 } // End of namespace heist
 
 #endif
\ No newline at end of file
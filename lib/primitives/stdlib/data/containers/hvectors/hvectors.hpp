@@ -0,0 +1,245 @@
+// Author: Jordan Randleman -- jordanran199@gmail.com -- hvectors.hpp
+// => Defines primitive homogeneous (SRFI-4 numeric) vector functions written in C++ for the Heist Scheme Interpreter
+
+#ifndef HEIST_SCHEME_CORE_STDLIB_HVECTORS_HPP_
+#define HEIST_SCHEME_CORE_STDLIB_HVECTORS_HPP_
+
+#include "implementation.hpp"
+
+namespace heist {
+
+  /******************************************************************************
+  * HOMOGENEOUS VECTOR CONSTRUCTORS
+  ******************************************************************************/
+
+  // primitive "s8vector" procedure:
+  data primitive_S8VECTOR(data_vector&& args) {
+    return stdlib_hvectors::hvector_from_args<hvector_tag::s8>(args);
+  }
+
+  // primitive "u8vector" procedure:
+  data primitive_U8VECTOR(data_vector&& args) {
+    return stdlib_hvectors::hvector_from_args<hvector_tag::u8>(args);
+  }
+
+  // primitive "s16vector" procedure:
+  data primitive_S16VECTOR(data_vector&& args) {
+    return stdlib_hvectors::hvector_from_args<hvector_tag::s16>(args);
+  }
+
+  // primitive "u16vector" procedure:
+  data primitive_U16VECTOR(data_vector&& args) {
+    return stdlib_hvectors::hvector_from_args<hvector_tag::u16>(args);
+  }
+
+  // primitive "s32vector" procedure:
+  data primitive_S32VECTOR(data_vector&& args) {
+    return stdlib_hvectors::hvector_from_args<hvector_tag::s32>(args);
+  }
+
+  // primitive "u32vector" procedure:
+  data primitive_U32VECTOR(data_vector&& args) {
+    return stdlib_hvectors::hvector_from_args<hvector_tag::u32>(args);
+  }
+
+  // primitive "s64vector" procedure:
+  data primitive_S64VECTOR(data_vector&& args) {
+    return stdlib_hvectors::hvector_from_args<hvector_tag::s64>(args);
+  }
+
+  // primitive "u64vector" procedure:
+  data primitive_U64VECTOR(data_vector&& args) {
+    return stdlib_hvectors::hvector_from_args<hvector_tag::u64>(args);
+  }
+
+  // primitive "f32vector" procedure:
+  data primitive_F32VECTOR(data_vector&& args) {
+    return stdlib_hvectors::hvector_from_args<hvector_tag::f32>(args);
+  }
+
+  // primitive "f64vector" procedure:
+  data primitive_F64VECTOR(data_vector&& args) {
+    return stdlib_hvectors::hvector_from_args<hvector_tag::f64>(args);
+  }
+
+  /******************************************************************************
+  * HOMOGENEOUS VECTOR SIZED CONSTRUCTORS
+  ******************************************************************************/
+
+  // primitive "make-s8vector" procedure:
+  data primitive_MAKE_S8VECTOR(data_vector&& args) {
+    return stdlib_hvectors::make_hvector<hvector_tag::s8>(args);
+  }
+
+  // primitive "make-u8vector" procedure:
+  data primitive_MAKE_U8VECTOR(data_vector&& args) {
+    return stdlib_hvectors::make_hvector<hvector_tag::u8>(args);
+  }
+
+  // primitive "make-s16vector" procedure:
+  data primitive_MAKE_S16VECTOR(data_vector&& args) {
+    return stdlib_hvectors::make_hvector<hvector_tag::s16>(args);
+  }
+
+  // primitive "make-u16vector" procedure:
+  data primitive_MAKE_U16VECTOR(data_vector&& args) {
+    return stdlib_hvectors::make_hvector<hvector_tag::u16>(args);
+  }
+
+  // primitive "make-s32vector" procedure:
+  data primitive_MAKE_S32VECTOR(data_vector&& args) {
+    return stdlib_hvectors::make_hvector<hvector_tag::s32>(args);
+  }
+
+  // primitive "make-u32vector" procedure:
+  data primitive_MAKE_U32VECTOR(data_vector&& args) {
+    return stdlib_hvectors::make_hvector<hvector_tag::u32>(args);
+  }
+
+  // primitive "make-s64vector" procedure:
+  data primitive_MAKE_S64VECTOR(data_vector&& args) {
+    return stdlib_hvectors::make_hvector<hvector_tag::s64>(args);
+  }
+
+  // primitive "make-u64vector" procedure:
+  data primitive_MAKE_U64VECTOR(data_vector&& args) {
+    return stdlib_hvectors::make_hvector<hvector_tag::u64>(args);
+  }
+
+  // primitive "make-f32vector" procedure:
+  data primitive_MAKE_F32VECTOR(data_vector&& args) {
+    return stdlib_hvectors::make_hvector<hvector_tag::f32>(args);
+  }
+
+  // primitive "make-f64vector" procedure:
+  data primitive_MAKE_F64VECTOR(data_vector&& args) {
+    return stdlib_hvectors::make_hvector<hvector_tag::f64>(args);
+  }
+
+  /******************************************************************************
+  * HOMOGENEOUS VECTOR PREDICATES
+  ******************************************************************************/
+
+  // primitive "s8vector?" procedure:
+  data primitive_S8VECTORP(data_vector&& args) {
+    return stdlib_hvectors::hvector_predicate<hvector_tag::s8>(args);
+  }
+
+  // primitive "u8vector?" procedure:
+  data primitive_U8VECTORP(data_vector&& args) {
+    return stdlib_hvectors::hvector_predicate<hvector_tag::u8>(args);
+  }
+
+  // primitive "s16vector?" procedure:
+  data primitive_S16VECTORP(data_vector&& args) {
+    return stdlib_hvectors::hvector_predicate<hvector_tag::s16>(args);
+  }
+
+  // primitive "u16vector?" procedure:
+  data primitive_U16VECTORP(data_vector&& args) {
+    return stdlib_hvectors::hvector_predicate<hvector_tag::u16>(args);
+  }
+
+  // primitive "s32vector?" procedure:
+  data primitive_S32VECTORP(data_vector&& args) {
+    return stdlib_hvectors::hvector_predicate<hvector_tag::s32>(args);
+  }
+
+  // primitive "u32vector?" procedure:
+  data primitive_U32VECTORP(data_vector&& args) {
+    return stdlib_hvectors::hvector_predicate<hvector_tag::u32>(args);
+  }
+
+  // primitive "s64vector?" procedure:
+  data primitive_S64VECTORP(data_vector&& args) {
+    return stdlib_hvectors::hvector_predicate<hvector_tag::s64>(args);
+  }
+
+  // primitive "u64vector?" procedure:
+  data primitive_U64VECTORP(data_vector&& args) {
+    return stdlib_hvectors::hvector_predicate<hvector_tag::u64>(args);
+  }
+
+  // primitive "f32vector?" procedure:
+  data primitive_F32VECTORP(data_vector&& args) {
+    return stdlib_hvectors::hvector_predicate<hvector_tag::f32>(args);
+  }
+
+  // primitive "f64vector?" procedure:
+  data primitive_F64VECTORP(data_vector&& args) {
+    return stdlib_hvectors::hvector_predicate<hvector_tag::f64>(args);
+  }
+
+  // primitive "homogeneous-vector?" procedure:
+  data primitive_HOMOGENEOUS_VECTORP(data_vector&& args) {
+    if(args.size() != 1)
+      HEIST_THROW_ERR("'homogeneous-vector? didn't receive exactly 1 arg!"
+        "\n     (homogeneous-vector? <obj>)" << HEIST_FCN_ERR("homogeneous-vector?",args));
+    return boolean(args[0].is_type(types::hvc));
+  }
+
+  // primitive "homogeneous-vector-type" procedure:
+  data primitive_HOMOGENEOUS_VECTOR_TYPE(data_vector&& args) {
+    if(args.size() != 1 || !args[0].is_type(types::hvc))
+      HEIST_THROW_ERR("'homogeneous-vector-type didn't receive exactly 1 homogeneous vector!"
+        "\n     (homogeneous-vector-type <homogeneous-vector>)" << HEIST_FCN_ERR("homogeneous-vector-type",args));
+    return sym_type(args[0].hvc->tag_name());
+  }
+
+  /******************************************************************************
+  * VECTOR->HOMOGENEOUS VECTOR COERCIONS
+  ******************************************************************************/
+
+  // primitive "vector->s8vector" procedure:
+  data primitive_COERCE_VECTOR_TO_S8VECTOR(data_vector&& args) {
+    return stdlib_hvectors::vector_to_hvector<hvector_tag::s8>(args);
+  }
+
+  // primitive "vector->u8vector" procedure:
+  data primitive_COERCE_VECTOR_TO_U8VECTOR(data_vector&& args) {
+    return stdlib_hvectors::vector_to_hvector<hvector_tag::u8>(args);
+  }
+
+  // primitive "vector->s16vector" procedure:
+  data primitive_COERCE_VECTOR_TO_S16VECTOR(data_vector&& args) {
+    return stdlib_hvectors::vector_to_hvector<hvector_tag::s16>(args);
+  }
+
+  // primitive "vector->u16vector" procedure:
+  data primitive_COERCE_VECTOR_TO_U16VECTOR(data_vector&& args) {
+    return stdlib_hvectors::vector_to_hvector<hvector_tag::u16>(args);
+  }
+
+  // primitive "vector->s32vector" procedure:
+  data primitive_COERCE_VECTOR_TO_S32VECTOR(data_vector&& args) {
+    return stdlib_hvectors::vector_to_hvector<hvector_tag::s32>(args);
+  }
+
+  // primitive "vector->u32vector" procedure:
+  data primitive_COERCE_VECTOR_TO_U32VECTOR(data_vector&& args) {
+    return stdlib_hvectors::vector_to_hvector<hvector_tag::u32>(args);
+  }
+
+  // primitive "vector->s64vector" procedure:
+  data primitive_COERCE_VECTOR_TO_S64VECTOR(data_vector&& args) {
+    return stdlib_hvectors::vector_to_hvector<hvector_tag::s64>(args);
+  }
+
+  // primitive "vector->u64vector" procedure:
+  data primitive_COERCE_VECTOR_TO_U64VECTOR(data_vector&& args) {
+    return stdlib_hvectors::vector_to_hvector<hvector_tag::u64>(args);
+  }
+
+  // primitive "vector->f32vector" procedure:
+  data primitive_COERCE_VECTOR_TO_F32VECTOR(data_vector&& args) {
+    return stdlib_hvectors::vector_to_hvector<hvector_tag::f32>(args);
+  }
+
+  // primitive "vector->f64vector" procedure:
+  data primitive_COERCE_VECTOR_TO_F64VECTOR(data_vector&& args) {
+    return stdlib_hvectors::vector_to_hvector<hvector_tag::f64>(args);
+  }
+
+} // End of namespace heist
+
+#endif
\ No newline at end of file
@@ -0,0 +1,169 @@
+// Author: Jordan Randleman -- jordanran199@gmail.com -- implementation.hpp
+// => Defines helper functions for hvectors.hpp
+
+#ifndef HEIST_SCHEME_CORE_STDLIB_HVECTORS_IMPLEMENTATION_HPP_
+#define HEIST_SCHEME_CORE_STDLIB_HVECTORS_IMPLEMENTATION_HPP_
+
+namespace heist::stdlib_hvectors {
+
+  /******************************************************************************
+  * ELEMENT TYPE DESCRIPTIONS
+  ******************************************************************************/
+
+  // "<tag>vector" procedure name (ie "f64vector")
+  string hvector_name(const hvector_tag tag)noexcept{
+    return string(HVECTOR_TAG_NAMES[size_type(tag)]) + "vector";
+  }
+
+
+  // Description of the elements a <tag>vector may hold
+  const char* hvector_element_description(const hvector_tag tag)noexcept{
+    static constexpr const char * const descriptions[] = {
+      "exact integer in [-128,127]",
+      "exact integer in [0,255]",
+      "exact integer in [-32768,32767]",
+      "exact integer in [0,65535]",
+      "exact integer in [-2147483648,2147483647]",
+      "exact integer in [0,4294967295]",
+      "exact integer in [-9223372036854775808,9223372036854775807]",
+      "exact integer in [0,18446744073709551615]",
+      "real number (stored as a 32-bit float)",
+      "real number (stored as a 64-bit float)",
+    };
+    return descriptions[size_type(tag)];
+  }
+
+
+  // "\n     <tag> ::= <description>" format suffix
+  string hvector_element_format(const hvector_tag tag)noexcept{
+    return "\n     <" + string(HVECTOR_TAG_NAMES[size_type(tag)]) + "> ::= " + hvector_element_description(tag);
+  }
+
+  /******************************************************************************
+  * ELEMENT VALIDATION
+  ******************************************************************************/
+
+  void confirm_valid_hvector_element(const homogeneous_vector& hv, const data& d, const char* name,
+                                     const string& format, const data_vector& args){
+    if(!d.is_type(types::num) || !hv.is_valid_element(d.num))
+      HEIST_THROW_ERR('\''<<name<<" received "<<HEIST_PROFILE(d)<<" which isn't a valid "
+        << hv.tag_name() << " element!" << format << hvector_element_format(hv.tag()) << HEIST_FCN_ERR(name,args));
+  }
+
+  /******************************************************************************
+  * BOXING & UNBOXING
+  ******************************************************************************/
+
+  // Convert <elements> into a <tag>vector (throws if any elt is an invalid <tag> element)
+  data convert_data_vector_to_hvector(const hvector_tag tag, const data_vector& elements, const char* name,
+                                      const string& format, const data_vector& args){
+    homogeneous_vector hv(tag,elements.size());
+    for(size_type i = 0, n = elements.size(); i < n; ++i) {
+      confirm_valid_hvector_element(hv,elements[i],name,format,args);
+      hv.set(i,elements[i].num);
+    }
+    return make_hvc(std::move(hv));
+  }
+
+
+  // Convert <hv>'s elements into heist numbers
+  data_vector convert_hvector_to_data_vector(const homogeneous_vector& hv)noexcept{
+    const size_type n = hv.size();
+    data_vector elements(n);
+    for(size_type i = 0; i < n; ++i) elements[i] = hv.ref(i);
+    return elements;
+  }
+
+
+  data convert_hvector_to_list(const homogeneous_vector& hv)noexcept{
+    data lis = symconst::emptylist;
+    for(size_type i = hv.size(); i-- > 0;) {
+      data new_pair = make_par();
+      new_pair.par->first = hv.ref(i);
+      new_pair.par->second = std::move(lis);
+      lis = std::move(new_pair);
+    }
+    return lis;
+  }
+
+  /******************************************************************************
+  * GENERIC <tag>VECTOR PRIMITIVE IMPLEMENTATIONS
+  ******************************************************************************/
+
+  // "(<tag>vector <number1> <number2> ...)"
+  template<hvector_tag TAG>
+  data hvector_from_args(data_vector& args){
+    const auto name = hvector_name(TAG);
+    return convert_data_vector_to_hvector(TAG,args,name.c_str(),"\n     ("+name+" <number1> <number2> ...)",args);
+  }
+
+
+  // "(make-<tag>vector <size> <optional-fill-number>)"
+  template<hvector_tag TAG>
+  data make_hvector(data_vector& args){
+    const auto name = "make-" + hvector_name(TAG);
+    const auto format = "\n     (" + name + " <size> <optional-fill-number>)"
+                        "\n     <size> range: [0," + std::to_string(GLOBALS::MAX_SIZE_TYPE) + ']';
+    if(args.empty() || args.size() > 2)
+      HEIST_THROW_ERR('\''<<name<<" didn't receive the proper number of args!" << format << HEIST_FCN_ERR(name,args));
+    auto [n, valid_size] = primitive_toolkit::convert_data_to_size_type(args[0]);
+    if(!valid_size)
+      HEIST_THROW_ERR('\''<<name<<" didn't receive a proper positive integer size!" << format << HEIST_FCN_ERR(name,args));
+    homogeneous_vector hv(TAG,n);
+    if(args.size() == 2) {
+      confirm_valid_hvector_element(hv,args[1],name.c_str(),format,args);
+      hv.fill(args[1].num);
+    }
+    return make_hvc(std::move(hv));
+  }
+
+
+  // "(<tag>vector? <obj>)"
+  template<hvector_tag TAG>
+  data hvector_predicate(data_vector& args){
+    if(args.size() != 1)
+      HEIST_THROW_ERR('\''<<hvector_name(TAG)<<"? didn't receive exactly 1 arg!"
+        "\n     ("<<hvector_name(TAG)<<"? <obj>)"<<HEIST_FCN_ERR(hvector_name(TAG)+'?',args));
+    return boolean(args[0].is_type(types::hvc) && args[0].hvc->tag() == TAG);
+  }
+
+
+  // "(vector-><tag>vector <vector>)"
+  template<hvector_tag TAG>
+  data vector_to_hvector(data_vector& args){
+    const auto name = "vector->" + hvector_name(TAG);
+    const auto format = "\n     (" + name + " <vector>)";
+    if(args.size() != 1 || !args[0].is_type(types::vec))
+      HEIST_THROW_ERR('\''<<name<<" didn't receive exactly 1 vector!" << format << HEIST_FCN_ERR(name,args));
+    return convert_data_vector_to_hvector(TAG,*args[0].vec,name.c_str(),format,args);
+  }
+
+  /******************************************************************************
+  * SEQUENCE PRIMITIVE INTEGRATION
+  ******************************************************************************/
+
+  // Whether any of <args> (starting from <first_seq_idx>) is a homogeneous vector
+  bool has_hvector_arg(const data_vector& args, const size_type first_seq_idx)noexcept{
+    for(size_type i = first_seq_idx, n = args.size(); i < n; ++i)
+      if(args[i].is_type(types::hvc)) return true;
+    return false;
+  }
+
+
+  // Index of <hv> referenced by args[idx_pos] (throws if invalid)
+  size_type get_if_valid_hvector_idx(const data_vector& args, const char* name, const char* format, const size_type idx_pos = 1){
+    auto [i, valid_index] = primitive_toolkit::convert_data_to_size_type(args[idx_pos]);
+    if(!valid_index)
+      HEIST_THROW_ERR('\''<<name<<" index "<<args[idx_pos]<<" isn't a proper non-negative integer!"
+        << format << "\n     <index> range: [0," << GLOBALS::MAX_SIZE_TYPE << ']' << HEIST_FCN_ERR(name,args));
+    const size_type l = args[0].hvc->size();
+    if(i >= l)
+      HEIST_THROW_ERR('\''<<name<<" received out of range index " << i
+        <<"\n     for "<<args[0].hvc->tag_name()<<"vector "<<args[0]<<" of size "
+        <<l<<'!'<<format<<HEIST_FCN_ERR(name,args));
+    return i;
+  }
+
+} // End of namespace heist::stdlib_hvectors
+
+#endif
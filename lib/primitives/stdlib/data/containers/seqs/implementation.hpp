@@ -128,6 +128,62 @@ namespace heist::stdlib_seqs {
     return get_if_valid_str_or_vec_idx(args,name,format,"string",idx_pos,0,&data::str);
   }
 
+  /******************************************************************************
+  * GENERAL HOMOGENEOUS VECTOR SEQUENCE HELPER PROCEDURES
+  ******************************************************************************/
+
+  // Whether <args>' sequences (from <first_seq_idx>) are vectors including a homogeneous vector
+  bool is_hvector_seq_application(const data_vector& args, const size_type first_seq_idx)noexcept{
+    return args[first_seq_idx].is_type(types::hvc) || 
+           (args[first_seq_idx].is_type(types::vec) && stdlib_hvectors::has_hvector_arg(args,first_seq_idx+1));
+  }
+
+
+  size_type hvector_seq_size(const data& seq)noexcept{
+    return seq.is_type(types::hvc) ? seq.hvc->size() : seq.vec->size();
+  }
+
+
+  // Confirm <args>' sequences (from <first_seq_idx>) are same-sized vectors/hvectors, returning their size
+  size_type confirm_same_sized_hvector_seqs(const data_vector& args, const size_type first_seq_idx, 
+                                            const char* name, const char* format){
+    const size_type length = hvector_seq_size(args[first_seq_idx]);
+    for(size_type i = first_seq_idx+1, n = args.size(); i < n; ++i) {
+      if(!args[i].is_type(types::hvc) && !args[i].is_type(types::vec))
+        HEIST_THROW_ERR('\''<<name<<" arg #" << i+1 << ' ' << HEIST_PROFILE(args[i]) 
+          << " isn't a vector or homogeneous vector!" << format << HEIST_FCN_ERR(name,args));
+      if(length != hvector_seq_size(args[i]))
+        HEIST_THROW_ERR('\''<<name<<" vectors "<< args[first_seq_idx] << " and " 
+          << args[i] << " differ in length!" << format << HEIST_FCN_ERR(name,args));
+    }
+    return length;
+  }
+
+
+  // Applies <elts_fcn> to each index & the elts at said index of <args>' sequences 
+  //   (from <first_seq_idx>), iterating from the last index if <REVERSE>
+  // => A lone hvector's typed storage is iterated directly, only boxing 1 elt at a time
+  template<bool REVERSE, typename ELTS_FCN>
+  void for_each_hvector_seq_elts(const data_vector& args, const size_type first_seq_idx, const size_type length, ELTS_FCN elts_fcn){
+    if(first_seq_idx+1 == args.size() && args[first_seq_idx].is_type(types::hvc)) {
+      auto hv = args[first_seq_idx].hvc; // keep alive while applying <elts_fcn>
+      std::visit([&](const auto& elts){
+        for(size_type k = 0; k < length; ++k) {
+          const size_type i = REVERSE ? length-k-1 : k;
+          elts_fcn(i,data_vector(1,homogeneous_vector::box_element(elts[i])));
+        }
+      },hv->val);
+      return;
+    }
+    for(size_type k = 0; k < length; ++k) {
+      const size_type i = REVERSE ? length-k-1 : k;
+      data_vector elts(args.size()-first_seq_idx);
+      for(size_type j = first_seq_idx, n = args.size(); j < n; ++j)
+        elts[j-first_seq_idx] = args[j].is_type(types::hvc) ? data(args[j].hvc->ref(i)) : args[j].vec->operator[](i);
+      elts_fcn(i,std::move(elts));
+    }
+  }
+
   /******************************************************************************
   * GENERAL LIST HELPER PROCEDURES
   ******************************************************************************/
@@ -172,6 +228,7 @@ namespace heist::stdlib_seqs {
   ******************************************************************************/
 
   data compute_length(data_vector& args, const char* name, const char* format){
+    if(args[0].is_type(types::hvc)) return num_type(args[0].hvc->size());
     switch(is_proper_sequence(args[0],args,name,format)) {
       case heist_sequence::vec: return num_type(args[0].vec->size());
       case heist_sequence::str: return num_type(args[0].str->size());
@@ -256,6 +313,24 @@ namespace heist::stdlib_seqs {
   }
 
 
+  // -- HOMOGENEOUS VECTORS (& VECTORS)
+  template<bool FOLDING_LEFT>
+  data fold_hvector_seqs(data& procedure, data_vector& args, const char* format){
+    static constexpr const char* name = get_fold_function_name<FOLDING_LEFT>();
+    const size_type length = confirm_same_sized_hvector_seqs(args,2,name,format);
+    data init_val = args[1];
+    for_each_hvector_seq_elts<!FOLDING_LEFT>(args,2,length,[&](const size_type, data_vector&& elts){
+      if constexpr (FOLDING_LEFT) {
+        elts.insert(elts.begin(),init_val);
+      } else {
+        elts.push_back(init_val);
+      }
+      init_val = execute_application(procedure,std::move(elts));
+    });
+    return init_val;
+  }
+
+
   // -- LISTS
   template<bool FOLDING_LEFT>
   void fold_list_accumulator(data_vector& curr_pairs, data& proc, data& init_val){
@@ -376,6 +451,28 @@ namespace heist::stdlib_seqs {
   }
 
 
+  // -- HOMOGENEOUS VECTORS (& VECTORS)
+  // Yields a homogeneous vector w/ the same element type as args[1] if args[1] 
+  //   is a homogeneous vector, else a vector
+  data hvector_map(data& procedure, data_vector& args, const char* name, const char* format){
+    const size_type length = confirm_same_sized_hvector_seqs(args,1,name,format);
+    if(!args[1].is_type(types::hvc)) {
+      data_vector mapped(length);
+      for_each_hvector_seq_elts<false>(args,1,length,[&](const size_type i, data_vector&& elts){
+        mapped[i] = execute_application(procedure,std::move(elts));
+      });
+      return make_vec(std::move(mapped));
+    }
+    homogeneous_vector mapped(args[1].hvc->tag(),length);
+    for_each_hvector_seq_elts<false>(args,1,length,[&](const size_type i, data_vector&& elts){
+      auto result = execute_application(procedure,std::move(elts));
+      stdlib_hvectors::confirm_valid_hvector_element(mapped,result,name,format,args);
+      mapped.set(i,result.num);
+    });
+    return make_hvc(std::move(mapped));
+  }
+
+
   // -- LISTS
   data list_map_constructor(data_vector& curr_pairs, data& proc){
     data_vector args(curr_pairs.size());
@@ -449,6 +546,16 @@ namespace heist::stdlib_seqs {
   }
 
 
+  // -- HOMOGENEOUS VECTORS (& VECTORS)
+  data hvector_for_each(data& procedure, data_vector& args, const char* format){
+    const size_type length = confirm_same_sized_hvector_seqs(args,1,"for-each",format);
+    for_each_hvector_seq_elts<false>(args,1,length,[&](const size_type, data_vector&& elts){
+      execute_application(procedure,std::move(elts));
+    });
+    return GLOBALS::VOID_DATA_OBJECT;
+  }
+
+
   // -- LISTS
   void list_for_each_applicator(data_vector& curr_pairs, data& proc){
     data_vector args(curr_pairs.size());
@@ -1597,6 +1704,223 @@ namespace heist::stdlib_seqs {
     return random_access_seq_diff<true,std::nullptr_t,std::nullptr_t>(callable,list_exps,[](auto& d){return d.exp;});
   }
 
+  /******************************************************************************
+  * SORT: NATIVE COMPARATORS
+  ******************************************************************************/
+
+  // Primitive predicates whose order can be evaluated w/o applying them
+  enum class native_order {none, num_lt, num_gt, str_lt, str_gt, chr_lt, chr_gt};
+
+
+  native_order get_native_order(const data& predicate)noexcept{
+    if(!predicate.is_type(types::fcn) || !predicate.fcn.param_instances().empty()) 
+      return native_order::none; // partially applied primitives are applied as usual
+    const auto prm = predicate.fcn.prm;
+    if(prm == primitive_LT)        return native_order::num_lt;
+    if(prm == primitive_GT)        return native_order::num_gt;
+    if(prm == primitive_STRING_LTP) return native_order::str_lt;
+    if(prm == primitive_STRING_GTP) return native_order::str_gt;
+    if(prm == primitive_CHAR_LTP)   return native_order::chr_lt;
+    if(prm == primitive_CHAR_GTP)   return native_order::chr_gt;
+    return native_order::none;
+  }
+
+
+  bool is_char_order(const native_order order)noexcept{
+    return order == native_order::chr_lt || order == native_order::chr_gt;
+  }
+
+
+  // Whether <d> is a valid argument for the primitive denoted by <order>
+  bool is_natively_comparable(const data& d, const native_order order)noexcept{
+    switch(order) {
+      case native_order::num_lt: case native_order::num_gt: return d.is_type(types::num) && d.num.is_real();
+      case native_order::str_lt: case native_order::str_gt: return d.is_type(types::str);
+      case native_order::chr_lt: case native_order::chr_gt: return d.is_type(types::chr);
+      default: return false;
+    }
+  }
+
+
+  // Whether every elt of <sequence> is a valid argument for the primitive denoted by <order>
+  bool is_natively_comparable(const data_vector& sequence, const native_order order)noexcept{
+    if(order == native_order::none) return false;
+    for(const auto& d : sequence)
+      if(!is_natively_comparable(d,order)) return false;
+    return true;
+  }
+
+
+  // PRECONDITION: is_natively_comparable(lhs,order) && is_natively_comparable(rhs,order)
+  bool native_compare(const native_order order, const data& lhs, const data& rhs)noexcept{
+    switch(order) {
+      case native_order::num_lt: return lhs.num < rhs.num;
+      case native_order::num_gt: return lhs.num > rhs.num;
+      case native_order::str_lt: return *lhs.str < *rhs.str;
+      case native_order::str_gt: return *lhs.str > *rhs.str;
+      case native_order::chr_lt: return lhs.chr < rhs.chr;
+      default:                   return lhs.chr > rhs.chr;
+    }
+  }
+
+  /******************************************************************************
+  * SORT: PARALLEL STABLE MERGE-SORT
+  ******************************************************************************/
+
+  // Minimum # of elements each thread sorts before partitioning across threads
+  constexpr size_type PARALLEL_SORT_MINIMUM_PARTITION = 1 << 16;
+
+
+  // Runs <tasks> concurrently, reverting to the current thread if unable to spawn more
+  void run_tasks_in_parallel(std::vector<std::function<void()>>& tasks) {
+    std::vector<std::thread> workers;
+    for(size_type i = 1, n = tasks.size(); i < n; ++i) {
+      try {
+        workers.emplace_back(tasks[i]);
+      } catch(const std::system_error&) {
+        tasks[i]();
+      }
+    }
+    if(!tasks.empty()) tasks[0]();
+    for(auto& worker : workers) worker.join();
+  }
+
+
+  // Stable-sorts partitions of [first,last) concurrently, then merges them pairwise
+  // PRECONDITION: <cmp> doesn't touch interpreter state (ie doesn't apply heist procedures)
+  template<typename RandomIt, typename Compare>
+  void parallel_stable_sort(RandomIt first, RandomIt last, Compare cmp) {
+    const size_type n = last - first;
+    const size_type total_partitions = std::min(size_type(std::thread::hardware_concurrency()), n / PARALLEL_SORT_MINIMUM_PARTITION);
+    if(total_partitions < 2) {
+      std::stable_sort(first,last,cmp);
+      return;
+    }
+    std::vector<RandomIt> bounds(total_partitions+1);
+    for(size_type i = 0; i <= total_partitions; ++i)
+      bounds[i] = first + (n * i) / total_partitions;
+    std::vector<std::function<void()>> tasks;
+    for(size_type i = 0; i < total_partitions; ++i)
+      tasks.push_back([start=bounds[i],end=bounds[i+1],&cmp]{std::stable_sort(start,end,cmp);});
+    run_tasks_in_parallel(tasks);
+    for(size_type width = 1; width < total_partitions; width *= 2) {
+      tasks.clear();
+      for(size_type i = 0; i + width < total_partitions; i += 2 * width)
+        tasks.push_back([start=bounds[i],mid=bounds[i+width],end=bounds[std::min(i+2*width,total_partitions)],&cmp]{
+          std::inplace_merge(start,mid,end,cmp);
+        });
+      run_tasks_in_parallel(tasks);
+    }
+  }
+
+  /******************************************************************************
+  * SORT: UNBOXED KEYS
+  ******************************************************************************/
+
+  // Sort keys paired w/ the index of their element in the unsorted sequence
+  template<typename KEY>
+  using sort_keys = std::vector<std::pair<KEY,size_type>>;
+
+
+  // Reorders <sequence> as per its sorted <keys> (moves rather than copies elements)
+  template<typename KEY, typename Compare>
+  void sort_by_keys(data_vector& sequence, sort_keys<KEY>& keys, Compare cmp) {
+    parallel_stable_sort(keys.begin(), keys.end(), 
+      [&cmp](const std::pair<KEY,size_type>& lhs, const std::pair<KEY,size_type>& rhs){
+        return cmp(lhs.first,rhs.first);
+      });
+    data_vector sorted;
+    sorted.reserve(sequence.size());
+    for(const auto& key : keys)
+      sorted.push_back(std::move(sequence[key.second]));
+    sequence = std::move(sorted);
+  }
+
+
+  template<bool ASCENDING, typename KEY>
+  void sort_by_keys(data_vector& sequence, sort_keys<KEY>& keys) {
+    if constexpr (ASCENDING) {
+      sort_by_keys(sequence,keys,[](const KEY& lhs, const KEY& rhs){return lhs < rhs;});
+    } else {
+      sort_by_keys(sequence,keys,[](const KEY& lhs, const KEY& rhs){return lhs > rhs;});
+    }
+  }
+
+
+  // Largest magnitude of an exact integer whose flonum conversion is guaranteed to be exact
+  constexpr num_type::inexact_t MAX_EXACT_FLONUM_SORT_KEY = 1e15L;
+
+
+  // Sorts by flonum keys if every number is inexact or a "small" exact integer,
+  //   else by comparing the numbers themselves (ie bigints & exact fractions)
+  template<bool ASCENDING>
+  void sort_numbers(data_vector& sequence) {
+    const size_type n = sequence.size();
+    sort_keys<num_type::inexact_t> flonum_keys(n);
+    for(size_type i = 0; i < n; ++i) {
+      const auto& num = sequence[i].num;
+      auto key = num.extract_inexact();
+      if(num.is_exact() && (!num.is_integer() || key > MAX_EXACT_FLONUM_SORT_KEY || key < -MAX_EXACT_FLONUM_SORT_KEY)) {
+        sort_keys<const num_type*> number_keys(n);
+        for(size_type j = 0; j < n; ++j) number_keys[j] = std::make_pair(&sequence[j].num,j);
+        if constexpr (ASCENDING) {
+          sort_by_keys(sequence,number_keys,[](const num_type* lhs, const num_type* rhs){return *lhs < *rhs;});
+        } else {
+          sort_by_keys(sequence,number_keys,[](const num_type* lhs, const num_type* rhs){return *lhs > *rhs;});
+        }
+        return;
+      }
+      flonum_keys[i] = std::make_pair(key,i);
+    }
+    sort_by_keys<ASCENDING>(sequence,flonum_keys);
+  }
+
+
+  template<bool ASCENDING>
+  void sort_strings(data_vector& sequence) {
+    const size_type n = sequence.size();
+    sort_keys<const string*> keys(n);
+    for(size_type i = 0; i < n; ++i) keys[i] = std::make_pair(&*sequence[i].str,i);
+    if constexpr (ASCENDING) {
+      sort_by_keys(sequence,keys,[](const string* lhs, const string* rhs){return *lhs < *rhs;});
+    } else {
+      sort_by_keys(sequence,keys,[](const string* lhs, const string* rhs){return *lhs > *rhs;});
+    }
+  }
+
+
+  template<bool ASCENDING>
+  void sort_chars(data_vector& sequence) {
+    const size_type n = sequence.size();
+    sort_keys<chr_type> keys(n);
+    for(size_type i = 0; i < n; ++i) keys[i] = std::make_pair(sequence[i].chr,i);
+    sort_by_keys<ASCENDING>(sequence,keys);
+  }
+
+
+  // Sorts the characters of <str> directly (no chars are boxed as heist data)
+  void sort_string_chars(string& str, const native_order order) {
+    if(order == native_order::chr_lt)
+      parallel_stable_sort(str.begin(),str.end(),[](const char lhs, const char rhs){return chr_type(lhs) < chr_type(rhs);});
+    else
+      parallel_stable_sort(str.begin(),str.end(),[](const char lhs, const char rhs){return chr_type(lhs) > chr_type(rhs);});
+  }
+
+
+  // Sorts <sequence> w/o applying the primitive denoted by <order>
+  // => Returns false (leaving <sequence> untouched) if any elt is an invalid argument for the primitive
+  bool native_sort(data_vector& sequence, const native_order order) {
+    if(!is_natively_comparable(sequence,order)) return false;
+    switch(order) {
+      case native_order::num_lt: sort_numbers<true>(sequence);  return true;
+      case native_order::num_gt: sort_numbers<false>(sequence); return true;
+      case native_order::str_lt: sort_strings<true>(sequence);  return true;
+      case native_order::str_gt: sort_strings<false>(sequence); return true;
+      case native_order::chr_lt: sort_chars<true>(sequence);    return true;
+      default:                   sort_chars<false>(sequence);   return true;
+    }
+  }
+
   /******************************************************************************
   * SORT
   ******************************************************************************/
@@ -1632,84 +1956,144 @@ namespace heist::stdlib_seqs {
   }
 
 
-  // Sort the args[1] vector or list sequence using the args[0] procedure
+  // Stable-sorts <sequence> by applying <procedure>, reusing 1 argument buffer across comparisons
+  void scheme_predicate_sort(data_vector& sequence, data& procedure) {
+    data_vector args_list;
+    std::stable_sort(sequence.begin(), sequence.end(),
+      [&procedure,&args_list](const data& lhs, const data& rhs) {
+        args_list.resize(2);
+        args_list[0] = lhs, args_list[1] = rhs;
+        return is_true_scm_condition(procedure,std::move(args_list));
+      });
+  }
+
+
+  // Sorts <sequence> natively if <predicate> is a recognized primitive, else by applying <predicate>
+  void sort_data_vector(data_vector& sequence, data& predicate) {
+    if(sequence.size() < 2 || native_sort(sequence,get_native_order(predicate))) return;
+    auto procedure = primitive_toolkit::convert_callable_to_procedure(predicate);
+    scheme_predicate_sort(sequence,procedure);
+  }
+
+
+  // Sort the args[1] vector, list, or string sequence using the args[0] procedure
   data sort_sequence(data_vector& args, const char* name, const char* format){
+    if(args[1].is_type(types::str) && is_char_order(get_native_order(args[0]))) {
+      auto sorted = make_str(*args[1].str);
+      sort_string_chars(*sorted,get_native_order(args[0]));
+      return sorted;
+    }
     data_vector sequence;
-    const types seq_type = args[1].type;
     cast_scheme_sequence_to_ast(args[1],sequence);
-    // sort unpacked sequence
-    if(sequence.size() > 1) {
-      std::sort(sequence.begin(), sequence.end(),
-        [procedure=primitive_toolkit::convert_callable_to_procedure(args[0])]
-        (data& lhs, data& rhs) mutable {
-          data_vector args_list(2);
-          args_list[0] = lhs, args_list[1] = rhs;
-          return is_true_scm_condition(procedure,std::move(args_list));
-        });
+    sort_data_vector(sequence,args[0]);
+    return cast_ast_sequence_to_scheme(args[1].type,sequence,name,format,args);
+  }
+
+
+  // Sort the args[1] vector, list, or string sequence in-place using the args[0] procedure
+  data sort_sequence_in_place(data_vector& args, const char* name, const char* format){
+    if(args[1].is_type(types::str)) {
+      if(is_char_order(get_native_order(args[0])))
+        sort_string_chars(*args[1].str,get_native_order(args[0]));
+      else
+        *args[1].str = *sort_sequence(args,name,format).str;
+      return GLOBALS::VOID_DATA_OBJECT;
+    }
+    // vectors: native sorts reorder the vector directly, whereas heist procedures
+    //          sort a copy (they may raise an error or mutate the vector mid-sort)
+    if(args[1].is_type(types::vec)) {
+      auto& vect = *args[1].vec;
+      if(vect.size() < 2 || native_sort(vect,get_native_order(args[0]))) 
+        return GLOBALS::VOID_DATA_OBJECT;
+      data_vector sequence(vect);
+      auto procedure = primitive_toolkit::convert_callable_to_procedure(args[0]);
+      scheme_predicate_sort(sequence,procedure);
+      vect = std::move(sequence);
+      return GLOBALS::VOID_DATA_OBJECT;
+    }
+    // lists: write the sorted elements back into the list's existing pairs
+    auto sequence = primitive_toolkit::convert_proper_list_to_data_vector(args[1]);
+    sort_data_vector(sequence,args[0]);
+    data iter = args[1];
+    for(size_type i = 0, n = sequence.size(); i < n && iter.is_type(types::par); ++i) {
+      iter.par->first = std::move(sequence[i]);
+      iter = iter.par->second;
+    }
+    return GLOBALS::VOID_DATA_OBJECT;
+  }
+
+  /******************************************************************************
+  * SORTED?
+  ******************************************************************************/
+
+  // Determine whether the args[1] sequence is sorted as per the args[0] procedure
+  bool sequence_is_sorted(data_vector& args) {
+    data_vector sequence;
+    cast_scheme_sequence_to_ast(args[1],sequence);
+    if(sequence.size() < 2) return true;
+    if(const auto order = get_native_order(args[0]); is_natively_comparable(sequence,order)) {
+      for(size_type i = 0, n = sequence.size(); i+1 < n; ++i)
+        if(!native_compare(order,sequence[i],sequence[i+1])) return false;
+      return true;
+    }
+    auto procedure = primitive_toolkit::convert_callable_to_procedure(args[0]);
+    for(size_type i = 0, n = sequence.size(); i+1 < n; ++i) {
+      data_vector args_list(2);
+      args_list[0] = sequence[i], args_list[1] = sequence[i+1];
+      if(is_false_scm_condition(procedure,std::move(args_list)))
+        return false;
     }
-    // return the sorted sequence
-    return cast_ast_sequence_to_scheme(seq_type,sequence,name,format,args);
+    return true;
   }
 
   /******************************************************************************
   * MERGE
   ******************************************************************************/
 
-  // -- RANDOM ACCESS SEQUENCES: STRINGS & VECTORS
-  data random_access_seq_merge(data_vector& args, data_vector& merged, const char* format){
-    auto procedure(primitive_toolkit::convert_callable_to_procedure(args[0]));
-    data_vector sequence1, sequence2;
-    cast_scheme_sequence_to_ast(args[1],sequence1);
-    cast_scheme_sequence_to_ast(args[2],sequence2);
+  // Merges <sequence1> & <sequence2> into <merged>: takes from <sequence1> iff 
+  //   <procedure> holds for the current elts of <sequence1> & <sequence2>
+  void merge_data_vectors(data& procedure, const data_vector& sequence1, const data_vector& sequence2, data_vector& merged){
     const size_type n1 = sequence1.size(), n2 = sequence2.size();
+    merged.reserve(n1 + n2);
     size_type i = 0, j = 0;
-    // Merge sequences
-    for(; i < n1 && j < n2;) {
-      data_vector eq_args(2);
-      eq_args[0] = sequence1[i], eq_args[1] = sequence2[j];
-      if(is_true_scm_condition(procedure,std::move(eq_args)))
-        merged.push_back(sequence1[i]), ++i;
-      else
-        merged.push_back(sequence2[j]), ++j;
+    if(const auto order = get_native_order(procedure); 
+       is_natively_comparable(sequence1,order) && is_natively_comparable(sequence2,order)) {
+      for(; i < n1 && j < n2;) {
+        if(native_compare(order,sequence1[i],sequence2[j]))
+          merged.push_back(sequence1[i]), ++i;
+        else
+          merged.push_back(sequence2[j]), ++j;
+      }
+    } else {
+      data_vector eq_args;
+      for(; i < n1 && j < n2;) {
+        eq_args.resize(2);
+        eq_args[0] = sequence1[i], eq_args[1] = sequence2[j];
+        if(is_true_scm_condition(procedure,std::move(eq_args)))
+          merged.push_back(sequence1[i]), ++i;
+        else
+          merged.push_back(sequence2[j]), ++j;
+      }
     }
     // If fully iterated through 1 sequence, append elts of the non-empty sequence
     if(i != n1)
       merged.insert(merged.end(),sequence1.begin()+i,sequence1.end());
     else if(j != n2)
       merged.insert(merged.end(),sequence2.begin()+j,sequence2.end());
-    return cast_ast_sequence_to_scheme(args[1].type,merged,"merge",format,args);
   }
 
 
-  // -- LISTS
-  void list_merge(data_vector& curr_pairs, data& proc, data_vector& merged_list){
-    // If fully iterated both lists, return
-    if(!curr_pairs[0].is_type(types::par) && !curr_pairs[1].is_type(types::par))return;
-    // If fully iterated through 1 list, append all the elts of the non-empty list & return
-    if(!curr_pairs[0].is_type(types::par) || !curr_pairs[1].is_type(types::par)) {
-      auto non_empty_list = !curr_pairs[0].is_type(types::par) ? curr_pairs[1] : curr_pairs[0];
-      while(non_empty_list.is_type(types::par)) {
-        merged_list.push_back(non_empty_list.par->first);
-        non_empty_list = non_empty_list.par->second;
-      }
-      return;
-    }
-    // Test proc, merge appropriate arg, & recurse down the rest of the lists
-    data_vector args(2);
-    args[0] = curr_pairs[0].par->first;
-    args[1] = curr_pairs[1].par->first;
-    if(is_true_scm_condition(proc,std::move(args))) {
-      merged_list.push_back(curr_pairs[0].par->first);
-      curr_pairs[0] = curr_pairs[0].par->second;
-    } else {
-      merged_list.push_back(curr_pairs[1].par->first);
-      curr_pairs[1] = curr_pairs[1].par->second;
-    }
-    list_merge(curr_pairs, proc, merged_list);
+  // Merge the args[1] & args[2] sequences (of the same type) using the args[0] procedure
+  data merge_sequences(data& procedure, data_vector& args, const char* format){
+    data_vector sequence1, sequence2, merged;
+    cast_scheme_sequence_to_ast(args[1],sequence1);
+    cast_scheme_sequence_to_ast(args[2],sequence2);
+    merge_data_vectors(procedure,sequence1,sequence2,merged);
+    return cast_ast_sequence_to_scheme(args[1].type,merged,"merge",format,args);
   }
 
   /******************************************************************************
-  * SORT! & DELETE-NEIGHBOR-DUPS!
+  * DELETE-NEIGHBOR-DUPS!
   ******************************************************************************/
 
   // Mutates 'sequence_target' by assigning its value to 'sequence_source'
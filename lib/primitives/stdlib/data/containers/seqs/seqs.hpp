@@ -22,6 +22,7 @@ namespace heist {
     if(args[0].is_type(types::par))             return symconst::emptylist;
     if(args[0].is_type(types::vec))             return make_vec(data_vector());
     if(args[0].is_type(types::str))             return make_str("");
+    if(args[0].is_type(types::hvc))             return make_hvc(homogeneous_vector(args[0].hvc->tag()));
     HEIST_THROW_ERR("'empty given arg "<<HEIST_PROFILE(args[0])<<" isn't a proper sequence!" 
         "\n     (empty <sequence>)" SEQUENCE_DESCRIPTION << HEIST_FCN_ERR("empty",args));
     return GLOBALS::VOID_DATA_OBJECT; // never used due to the throw above
@@ -83,6 +84,7 @@ namespace heist {
       HEIST_THROW_ERR("'fold received insufficient args (only " 
         << args.size() << "):" << format << HEIST_FCN_ERR("fold",args));
     auto procedure = primitive_toolkit::validate_callable_and_convert_to_procedure(args[0], args, "fold", format);
+    if(stdlib_seqs::is_hvector_seq_application(args,2)) return stdlib_seqs::fold_hvector_seqs<true>(procedure, args, format);
     switch(stdlib_seqs::is_proper_sequence(args[2],args,"fold",format)) {
       case stdlib_seqs::heist_sequence::vec:
         return stdlib_seqs::fold_random_access_seq<true,types::vec>(procedure, args, format, &data::vec);
@@ -104,6 +106,7 @@ namespace heist {
       HEIST_THROW_ERR("'fold-right received insufficient args (only " 
         << args.size() << "):" << format << HEIST_FCN_ERR("fold-right",args));
     auto procedure = primitive_toolkit::validate_callable_and_convert_to_procedure(args[0], args, "fold-right", format);
+    if(stdlib_seqs::is_hvector_seq_application(args,2)) return stdlib_seqs::fold_hvector_seqs<false>(procedure, args, format);
     switch(stdlib_seqs::is_proper_sequence(args[2],args,"fold-right",format)) {
       case stdlib_seqs::heist_sequence::vec:
         return stdlib_seqs::fold_random_access_seq<false,types::vec>(procedure, args, format, &data::vec);
@@ -146,6 +149,7 @@ namespace heist {
       HEIST_THROW_ERR("'map received incorrect # of args (given " 
         << args.size() << "):" << format << HEIST_FCN_ERR("map",args));
     auto procedure = primitive_toolkit::validate_callable_and_convert_to_procedure(args[0], args, "map", format);
+    if(stdlib_seqs::is_hvector_seq_application(args,1)) return stdlib_seqs::hvector_map(procedure, args, "map", format);
     switch(stdlib_seqs::is_proper_sequence(args[1],args,"map",format)) {
       case stdlib_seqs::heist_sequence::vec:
         return stdlib_seqs::random_access_seq_map<types::vec>(procedure, args, "map", format, &data::vec);
@@ -165,6 +169,10 @@ namespace heist {
       HEIST_THROW_ERR("'map! received incorrect # of args (given " 
         << args.size() << "):" << format << HEIST_FCN_ERR("map!",args));
     auto procedure = primitive_toolkit::validate_callable_and_convert_to_procedure(args[0], args, "map!", format);
+    if(args[1].is_type(types::hvc)) {
+      *args[1].hvc = std::move(*stdlib_seqs::hvector_map(procedure, args, "map!", format).hvc);
+      return GLOBALS::VOID_DATA_OBJECT;
+    }
     switch(stdlib_seqs::is_proper_sequence(args[1],args,"map!",format)) {
       case stdlib_seqs::heist_sequence::vec:
         *args[1].vec = *stdlib_seqs::random_access_seq_map<types::vec>(procedure, args, "map!", format, &data::vec).vec;
@@ -186,6 +194,7 @@ namespace heist {
       HEIST_THROW_ERR("'for-each received incorrect # of args (given " 
         << args.size() << "):" << format << HEIST_FCN_ERR("for-each",args));
     auto procedure = primitive_toolkit::validate_callable_and_convert_to_procedure(args[0], args, "for-each", format);
+    if(stdlib_seqs::is_hvector_seq_application(args,1)) return stdlib_seqs::hvector_for_each(procedure, args, format);
     switch(stdlib_seqs::is_proper_sequence(args[1],args,"for-each",format)) {
       case stdlib_seqs::heist_sequence::vec:
         return stdlib_seqs::random_access_seq_for_each<types::vec>(procedure, args, format, &data::vec);
@@ -247,6 +256,8 @@ namespace heist {
       HEIST_THROW_ERR("'ref received incorrect # of args (given " 
         << args.size() << "):" << format 
         << VALID_SEQUENCE_INDEX_RANGE << HEIST_FCN_ERR("ref",args));
+    if(args[0].is_type(types::hvc))
+      return args[0].hvc->ref(stdlib_hvectors::get_if_valid_hvector_idx(args,"ref",format));
     switch(stdlib_seqs::is_proper_sequence(args[0],args,"ref",format)) {
       case stdlib_seqs::heist_sequence::nul:
         HEIST_THROW_ERR("'ref 1st arg '() of type \"null\" has no elements to reference:" 
@@ -284,6 +295,12 @@ namespace heist {
       HEIST_THROW_ERR("'set-index! received incorrect # of args (given " 
         << args.size() << "):" << format 
         << VALID_SEQUENCE_INDEX_RANGE << HEIST_FCN_ERR("set-index!",args));
+    if(args[0].is_type(types::hvc)) {
+      const auto idx = stdlib_hvectors::get_if_valid_hvector_idx(args,"set-index!",format);
+      stdlib_hvectors::confirm_valid_hvector_element(*args[0].hvc,args[2],"set-index!",format,args);
+      args[0].hvc->set(idx,args[2].num);
+      return GLOBALS::VOID_DATA_OBJECT;
+    }
     switch(stdlib_seqs::is_proper_sequence(args[0],args,"set-index!",format)) {
       case stdlib_seqs::heist_sequence::nul:
         HEIST_THROW_ERR("'set-index! 1st arg '() of type \"null\" has no elements to set:" 
@@ -342,6 +359,11 @@ namespace heist {
       HEIST_THROW_ERR("'fill! received incorrect # of args (given " 
         << args.size() << "):" << format 
         << HEIST_FCN_ERR("fill!",args));
+    if(args[0].is_type(types::hvc)) {
+      stdlib_hvectors::confirm_valid_hvector_element(*args[0].hvc,args[1],"fill!",format,args);
+      args[0].hvc->fill(args[1].num);
+      return GLOBALS::VOID_DATA_OBJECT;
+    }
     switch(stdlib_seqs::is_proper_sequence(args[0],args,"fill!",format)) {
       case stdlib_seqs::heist_sequence::vec: return stdlib_seqs::vector_fill_bang(args);
       case stdlib_seqs::heist_sequence::str: return stdlib_seqs::string_fill_bang(args,format);
@@ -788,6 +810,7 @@ namespace heist {
     static constexpr const char * const format = "\n     (seq->list <sequence>)" SEQUENCE_DESCRIPTION;
     if(args.size() != 1) 
       HEIST_THROW_ERR("'seq->list didn't receive exactly 1 arg!" << format << HEIST_FCN_ERR("seq->list",args));
+    if(args[0].is_type(types::hvc)) return stdlib_hvectors::convert_hvector_to_list(*args[0].hvc);
     switch(stdlib_seqs::is_proper_sequence(args[0],args,"seq->list",format)) {
       case stdlib_seqs::heist_sequence::vec: return stdlib_seqs::convert_vector_to_list(args[0]);
       case stdlib_seqs::heist_sequence::str: return stdlib_seqs::convert_string_to_list(*args[0].str);
@@ -800,6 +823,7 @@ namespace heist {
     static constexpr const char * const format = "\n     (seq->vector <sequence>)" SEQUENCE_DESCRIPTION;
     if(args.size() != 1) 
       HEIST_THROW_ERR("'seq->vector didn't receive exactly 1 arg!" << format << HEIST_FCN_ERR("seq->vector",args));
+    if(args[0].is_type(types::hvc)) return make_vec(stdlib_hvectors::convert_hvector_to_data_vector(*args[0].hvc));
     switch(stdlib_seqs::is_proper_sequence(args[0],args,"seq->vector",format)) {
       case stdlib_seqs::heist_sequence::vec: return args[0].shallow_copy();
       case stdlib_seqs::heist_sequence::str: return stdlib_seqs::convert_string_to_vector(*args[0].str);
@@ -926,9 +950,8 @@ namespace heist {
     stdlib_seqs::confirm_sortable_sequence(args, "sort!", format);
     // return if sorting the empty list (already sorted)
     if(args[1].is_type(types::sym)) return GLOBALS::VOID_DATA_OBJECT;
-    // set the sequence to its sorted variant
-    return stdlib_seqs::mutatable_assign_scm_sequence(args[1],
-      stdlib_seqs::sort_sequence(args,"sort!",format));
+    // sort the sequence in-place
+    return stdlib_seqs::sort_sequence_in_place(args, "sort!", format);
   }
 
   // primitive "sorted?" procedure:
@@ -938,20 +961,8 @@ namespace heist {
     stdlib_seqs::confirm_sortable_sequence(args, "sorted?", "\n     (sorted? <predicate> <sequence>)" SEQUENCE_DESCRIPTION);
     // return if sorting the empty list
     if(args[1].is_type(types::sym)) return GLOBALS::TRUE_DATA_BOOLEAN;
-    // unpack the sequence
-    data_vector sequence;
-    stdlib_seqs::cast_scheme_sequence_to_ast(args[1],sequence);
-    // confirm the unpacked sequence is sorted as per the args[0] procedure
-    if(sequence.size() > 1) {
-      auto procedure = primitive_toolkit::convert_callable_to_procedure(args[0]);
-      for(size_type i = 0, n = sequence.size(); i+1 < n; ++i) {
-        data_vector args_list(2);
-        args_list[0] = sequence[i], args_list[1] = sequence[i+1];
-        if(stdlib_seqs::is_false_scm_condition(procedure,std::move(args_list)))
-          return GLOBALS::FALSE_DATA_BOOLEAN;
-      }
-    }
-    return GLOBALS::TRUE_DATA_BOOLEAN;
+    // confirm the sequence is sorted as per the args[0] procedure
+    return boolean(stdlib_seqs::sequence_is_sorted(args));
   }
 
   // primitive "merge" procedure:
@@ -977,14 +988,8 @@ namespace heist {
       HEIST_THROW_ERR("'merge sequences " << HEIST_PROFILE(args[1]) << " and "
         << HEIST_PROFILE(args[2]) << "\n     are not matching sequence types!"
         << format << HEIST_FCN_ERR("merge",args));
-    // If merging vectors or strings: 
-    data_vector merged_sequence;
-    if(!args[1].is_type(types::par)) 
-      return stdlib_seqs::random_access_seq_merge(args,merged_sequence,format);
-    // Else apply the procedure on each list elt & merge args as per the result into a list
-    data_vector list_heads(args.begin()+1, args.end());
-    stdlib_seqs::list_merge(list_heads,procedure,merged_sequence);
-    return primitive_toolkit::convert_data_vector_to_proper_list(merged_sequence.begin(),merged_sequence.end());
+    // Apply the procedure on each sequence elt & merge args as per the result
+    return stdlib_seqs::merge_sequences(procedure,args,format);
   }
 
   // primitive "delete-neighbor-dups" procedure:
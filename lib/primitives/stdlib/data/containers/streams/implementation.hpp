@@ -104,30 +104,31 @@ namespace heist::stdlib_streams {
   }
 
 
-  // "stream" special form helper fcn: recursively constructs embedded sconses
+  // "stream" special form helper fcn: constructs embedded sconses (from the last elt)
   data convert_data_vector_to_stream(const data_vector::iterator& obj, const data_vector::iterator& null_obj)noexcept{
-    if(obj == null_obj) {
-      data_vector empty_list(1,symconst::list);
-      return empty_list; // becomes '() once forced
+    data stream = data_vector(1,symconst::list); // becomes '() once forced
+    for(auto elt = null_obj; elt != obj;) {
+      data new_stream_pair = data(make_par());
+      new_stream_pair.par->first  = make_del(*(--elt),G.GLOBAL_ENVIRONMENT_POINTER,false);
+      new_stream_pair.par->second = make_del(stream,G.GLOBAL_ENVIRONMENT_POINTER,false);
+      stream = std::move(new_stream_pair);
     }
-    data new_stream_pair = data(make_par());
-    new_stream_pair.par->first  = make_del(*obj,G.GLOBAL_ENVIRONMENT_POINTER,false);
-    new_stream_pair.par->second = make_del(convert_data_vector_to_stream(obj+1,null_obj),G.GLOBAL_ENVIRONMENT_POINTER,false);
-    return new_stream_pair;
+    return stream;
   }
 
 
+  // NOTE: Stream traversals iterate (rather than recurse) to support arbitrarily 
+  //       long streams, & only hold their current pair (freeing traversed pairs)
   void unpack_stream_into_exp(data&& curr_pair, data_vector& stream_as_exp) {
-    if(!data_is_stream_pair(curr_pair)) return;
-    stream_as_exp.push_back(get_stream_data_car(curr_pair));
-    unpack_stream_into_exp(get_stream_data_cdr(curr_pair), stream_as_exp);
+    for(; data_is_stream_pair(curr_pair); curr_pair = get_stream_data_cdr(curr_pair))
+      stream_as_exp.push_back(get_stream_data_car(curr_pair));
   }
 
 
   // "stream-length" primitive helper fcn
   size_type stream_length(data&& curr_pair, size_type count = 1){
-    if(data_is_stream_pair(curr_pair)) 
-      return stream_length(get_stream_data_cdr(curr_pair), count+1);
+    for(; data_is_stream_pair(curr_pair); ++count)
+      curr_pair = get_stream_data_cdr(curr_pair);
     return count;
   }
 
@@ -180,19 +181,20 @@ namespace heist::stdlib_streams {
 
   void stream_for_each(data_vector& curr_streams, data& proc){
     data_vector args(curr_streams.size());
-    if(acquire_scars_advance_scdrs(curr_streams,args, "stream-for-each",
-      "\n     (stream-for-each <procedure> <stream1> <stream2> ...)")) return;
-    // Execute proc & recurse down the rest of the lists
-    execute_application(proc,std::move(args));
-    stream_for_each(curr_streams, proc);
+    // Execute proc & iterate down the rest of the lists
+    while(!acquire_scars_advance_scdrs(curr_streams,args, "stream-for-each",
+           "\n     (stream-for-each <procedure> <stream1> <stream2> ...)")) {
+      execute_application(proc,std::move(args));
+      args = data_vector(curr_streams.size());
+    }
   }
 
 
   data stream_ref_drop(data&& curr_pair, const size_type& n, const char* name,  const char* format, 
                                                              size_type count=1, const bool must_exist=true){
+    for(; count != n && data_is_stream_pair(curr_pair); ++count)
+      curr_pair = get_stream_data_cdr(curr_pair);
     if(count == n) return std::move(curr_pair);
-    if(data_is_stream_pair(curr_pair))
-      return stream_ref_drop(get_stream_data_cdr(curr_pair),n,name,format,count+1,must_exist);
     if(must_exist) HEIST_THROW_ERR('\''<<name<<" index "<<n<<" is out of range!"<<format);
     return std::move(curr_pair);
   }
@@ -200,35 +202,39 @@ namespace heist::stdlib_streams {
 
   void stream_take(data&& curr_pair,    const size_type& n, 
                                        data_vector& substream, size_type count=0){
-    if(count < n && data_is_stream_pair(curr_pair)) {
+    for(; count < n && data_is_stream_pair(curr_pair); ++count) {
       substream.push_back(get_stream_data_car(curr_pair));
-      stream_take(get_stream_data_cdr(curr_pair),n,substream,count+1);
+      if(count+1 < n) curr_pair = get_stream_data_cdr(curr_pair);
     }
   }
 
 
   data stream_drop_while(data&& curr_pair, data& proc){
-    if(!data_is_stream_pair(curr_pair)) return std::move(curr_pair);
-    if(execute_application(proc,data_vector(1,get_stream_data_car(curr_pair))).is_falsey()) return std::move(curr_pair);
-    return stream_drop_while(get_stream_data_cdr(curr_pair),proc);
+    while(data_is_stream_pair(curr_pair) && 
+          !execute_application(proc,data_vector(1,get_stream_data_car(curr_pair))).is_falsey())
+      curr_pair = get_stream_data_cdr(curr_pair);
+    return std::move(curr_pair);
   }
 
 
   template<bool FOLDING_LEFT>
   void stream_fold_accumulator(data&& curr_pair, data& proc, data& init_val){
-    // Return if fully iterated through stream
-    if(!data_is_stream_pair(curr_pair)) return;
-    // Execute proc, accumulate result, & recurse down the rest of the lists
-    if constexpr (FOLDING_LEFT) { // stream-fold is preorder
-      data_vector args(2);
-      args[0] = init_val, args[1] = get_stream_data_car(curr_pair);
-      init_val = execute_application(proc,std::move(args));
-    }
-    stream_fold_accumulator<FOLDING_LEFT>(get_stream_data_cdr(curr_pair),proc,init_val);
-    if constexpr (!FOLDING_LEFT) { // stream-fold-right is postorder
-      data_vector args(2);
-      args[0] = get_stream_data_car(curr_pair), args[1] = init_val;
-      init_val = execute_application(proc,std::move(args));
+    // stream-fold is preorder: execute proc, accumulate result, & iterate down the rest of the stream
+    if constexpr (FOLDING_LEFT) {
+      for(; data_is_stream_pair(curr_pair); curr_pair = get_stream_data_cdr(curr_pair)) {
+        data_vector args(2);
+        args[0] = init_val, args[1] = get_stream_data_car(curr_pair);
+        init_val = execute_application(proc,std::move(args));
+      }
+    // stream-fold-right is postorder: accumulate from the last elt
+    } else {
+      data_vector elts;
+      unpack_stream_into_exp(std::move(curr_pair),elts);
+      for(size_type i = elts.size(); i-- > 0;) {
+        data_vector args(2);
+        args[0] = std::move(elts[i]), args[1] = init_val;
+        init_val = execute_application(proc,std::move(args));
+      }
     }
   }
 
@@ -329,6 +329,7 @@ namespace heist {
     stdlib_streams::confirm_only_given_streams(stream_heads,"stream-for-each",format,1,args);
     // Apply the procedure on each elt of each stream
     auto procedure(primitive_toolkit::validate_callable_and_convert_to_procedure(args[0], args, "stream-for-each", format));
+    args.clear(); // only <stream_heads> references the streams, thus traversed pairs are freed
     stdlib_streams::stream_for_each(stream_heads, procedure);
     return GLOBALS::VOID_DATA_OBJECT;
   }
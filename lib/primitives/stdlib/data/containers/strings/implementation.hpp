@@ -5,6 +5,7 @@
 #define HEIST_SCHEME_CORE_STDLIB_STRINGS_IMPLEMENTATION_HPP_
 
 #include <regex>
+#include "linear_regex.hpp"
 
 namespace heist::stdlib_strings {
 
@@ -114,42 +115,57 @@ namespace heist::stdlib_strings {
   }
 
 
+  // Whitespace trimming reads <args[0]> in-place, only copying out the result.
+  // Predicate trimming copies <args[0]> first, since the predicate may mutate it.
   data trim_left_of_string(data_vector& args) {
+    if(args.size() == 1) { // no predicate given, trim whitespace
+      const string& str = *args[0].str;
+      size_type i = 0;
+      for(const size_type n = str.size(); i < n && isspace(str[i]); ++i);
+      return make_str(str.substr(i));
+    }
     string str(*args[0].str);
     const size_type n = str.size();
     size_type i = 0;
     auto procedure(primitive_toolkit::convert_callable_to_procedure(args[1]));
-    if(args.size() == 1) { // no predicate given, trim whitespace
-      for(; i < n && isspace(str[i]); ++i);
-    } else {
-      for(; i < n; ++i) { // while predicate is true, trim character
-        if(execute_application(procedure,data_vector(1,chr_type(str[i]))).is_falsey()) break;
-      }
+    for(; i < n; ++i) { // while predicate is true, trim character
+      if(execute_application(procedure,data_vector(1,chr_type(str[i]))).is_falsey()) break;
     }
     if(i == n) return make_str("");
-    return make_str(str.substr(i));
+    str.erase(0,i);
+    return make_str(std::move(str));
   }
 
 
   data trim_right_of_string(data_vector& args) {
     if(args[0].str->empty()) return make_str("");
+    if(args.size() == 1) { // no predicate given, trim whitespace
+      const string& str = *args[0].str;
+      size_type n = str.size();
+      for(; n > 0 && isspace(str[n-1]); --n);
+      return make_str(str.substr(0,n));
+    }
     string str(*args[0].str);
     const size_type n = str.size();
     size_type i = n-1;
     auto procedure(primitive_toolkit::convert_callable_to_procedure(args[1]));
-    if(args.size() == 1) { // no predicate given, trim whitespace
-      for(; i > 0 && isspace(str[i]); --i);
-      if(i == 0 && isspace(str[i])) return make_str("");
-    } else {
-      for(; i > 0; --i) { // while predicate is true, trim character
-        if(execute_application(procedure,data_vector(1,chr_type(str[i]))).is_falsey()) break;
-      }
-      if(i == 0 && execute_application(procedure,data_vector(1,chr_type(str[i]))).is_truthy()) {
-        return make_str("");
-      }
+    for(; i > 0; --i) { // while predicate is true, trim character
+      if(execute_application(procedure,data_vector(1,chr_type(str[i]))).is_falsey()) break;
     }
-    if(i == n) return make_str("");
-    return make_str(str.substr(0,i+1));
+    if(i == 0 && execute_application(procedure,data_vector(1,chr_type(str[i]))).is_truthy()) {
+      return make_str("");
+    }
+    str.erase(i+1);
+    return make_str(std::move(str));
+  }
+
+
+  // Trims whitespace from both ends of <str> w/ a single copy
+  data trim_whitespace_of_string(const string& str) {
+    size_type start = 0, end = str.size();
+    for(; start < end && isspace(str[start]); ++start);
+    for(; end > start && isspace(str[end-1]); --end);
+    return make_str(str.substr(start,end-start));
   }
 
   /******************************************************************************
@@ -351,7 +367,7 @@ namespace heist::stdlib_strings {
   data regex_replace(const string& target, const string& regex, const string& replacement){
     std::smatch reg_matches;
     while(std::regex_search(target, reg_matches, std::regex(regex)))
-      return reg_matches.prefix().str() + replacement + reg_matches.suffix().str();
+      return make_str(reg_matches.prefix().str() + replacement + reg_matches.suffix().str());
     return make_str(target);
   }
 
@@ -361,49 +377,188 @@ namespace heist::stdlib_strings {
   }
 
 
+  // Replaces in a single pass over <target>: <procedure> receives the prefix & 
+  //   suffix of each match w/in the original <target> (as per the linear engine)
   template<bool REPLACE_ONE>
-  data regex_replace_fcn_generic(string target, const string& regex, 
+  data regex_replace_fcn_generic(const string& target, const string& regex, 
                                  const data_vector& args,const char* format, const char* name, data&& procedure){
     const std::regex reg(regex);
-    std::smatch reg_matches;
-    while(std::regex_search(target, reg_matches, reg)) {
+    string result;
+    size_type last_end = 0;
+    for(std::sregex_iterator match(target.begin(),target.end(),reg), end; match != end; ++match) {
+      const auto& reg_matches = *match;
+      const size_type match_start = size_type(reg_matches.position());
       // save prefix, suffix, and matches
       data_vector reg_args(2 + reg_matches.size());
-      reg_args[0] = make_str(reg_matches.prefix().str());
+      reg_args[0] = make_str(target.substr(0,match_start));
       reg_args[1] = make_str(reg_matches.suffix().str());
       for(std::size_t i = 0, n = reg_matches.size(); i < n; ++i)
         reg_args[i+2] = make_str(reg_matches.str(i));
       // pass to given procedure & confirm returned a string
-      data result = execute_application(procedure,std::move(reg_args));
-      if(!result.is_type(types::str))
+      data replacement = execute_application(procedure,std::move(reg_args));
+      if(!replacement.is_type(types::str))
         HEIST_THROW_ERR('\''<<name<<" procedure \""<<procedure.fcn.name // skip prefixing ' '
-          <<"\" didn't return a string (returned "<<HEIST_PROFILE(result)<<")!"<<format<<HEIST_FCN_ERR(name,args));
-      // replace as often as needed
+          <<"\" didn't return a string (returned "<<HEIST_PROFILE(replacement)<<")!"<<format<<HEIST_FCN_ERR(name,args));
+      result.append(target, last_end, match_start-last_end);
+      result += *replacement.str;
+      last_end = match_start + size_type(reg_matches.length());
+      if constexpr (REPLACE_ONE) break;
+    }
+    result.append(target, last_end, string::npos);
+    return make_str(std::move(result));
+  }
+
+  /******************************************************************************
+  * LINEAR-TIME REGEX ENGINE HELPERS
+  ******************************************************************************/
+
+  // Pops the optional trailing 'linear or 'backtracking engine symbol from <args>
+  // => returns whether to use the linear-time engine (defaults to "linear-regex?")
+  bool pop_regex_engine_choice(data_vector& args)noexcept{
+    if(args.size() > 1 && args.back().is_type(types::sym)) {
+      if(args.back().sym == "linear") {
+        args.pop_back();
+        return true;
+      }
+      if(args.back().sym == "backtracking") {
+        args.pop_back();
+        return false;
+      }
+    }
+    return G.USING_LINEAR_REGEX_ENGINE;
+  }
+
+
+  // Returns <nullptr> if <regex> uses syntax requiring the backtracking engine
+  std::shared_ptr<linear_regex::program> compile_linear_regex(const string& regex) {
+    try {
+      return linear_regex::compile(regex);
+    } catch(const linear_regex::unsupported_regex&) {
+      return nullptr;
+    }
+  }
+
+
+  data linear_regex_matches(const string& str, const linear_regex::program& prog) {
+    data_vector matches;
+    // unmatched submatches are positioned at the end of <str> (as per <std::regex>)
+    auto submatch_pos = [&](const std::vector<size_type>& caps, const size_type i) {
+      return num_type(caps[2*i] == linear_regex::npos ? str.size() : caps[2*i]);
+    };
+    auto submatch_str = [&](const std::vector<size_type>& caps, const size_type i) {
+      string sub;
+      linear_regex::append_submatch(sub,str,caps,i);
+      return make_str(std::move(sub));
+    };
+    linear_regex::for_each_match(prog,str,[&](const std::vector<size_type>& caps, size_type) {
+      data_vector match_instance;
+      if(prog.total_groups == 1) { // alist (1 substring per regex match)
+        match_instance.push_back(submatch_pos(caps,0));
+        match_instance.push_back(submatch_str(caps,0));
+      } else { // 2nd order alist (more than 1 substring per regex match)
+        for(size_type i = 0; i < prog.total_groups; ++i) {
+          data_vector submatch_instance(2);
+          submatch_instance[0] = submatch_pos(caps,i);
+          submatch_instance[1] = submatch_str(caps,i);
+          match_instance.push_back(primitive_toolkit::convert_data_vector_to_proper_list(submatch_instance.begin(),submatch_instance.end()));
+        }
+      }
+      matches.push_back(primitive_toolkit::convert_data_vector_to_proper_list(match_instance.begin(),match_instance.end()));
+      return true;
+    });
+    return primitive_toolkit::convert_data_vector_to_proper_list(matches.begin(),matches.end());
+  }
+
+
+  // Replaces in a single pass over <target>: "$" sequences in <replacement> are
+  // only expanded when replacing all matches (mirroring the backtracking engine)
+  template<bool REPLACE_ONE>
+  data linear_regex_replace_generic(const string& target, const linear_regex::program& prog, const string& replacement){
+    string result;
+    size_type last_end = 0;
+    linear_regex::for_each_match(prog,target,[&](const std::vector<size_type>& caps, const size_type prefix_start) {
+      result.append(target, prefix_start, caps[0]-prefix_start);
       if constexpr (REPLACE_ONE) {
-        return make_str(string(reg_matches.prefix().str() + *result.str + reg_matches.suffix().str()));
+        result += replacement;
       } else {
-        target = reg_matches.prefix().str() + *result.str + reg_matches.suffix().str();
+        linear_regex::append_formatted_replacement(result,replacement,target,caps,prefix_start);
       }
-    }
-    return make_str(string(target));
+      last_end = caps[1];
+      return !REPLACE_ONE;
+    });
+    result.append(target, last_end, string::npos);
+    return make_str(std::move(result));
   }
 
-  auto regex_replace_all_fcn = regex_replace_fcn_generic<false>;
-  auto regex_replace_fcn     = regex_replace_fcn_generic<true>;
+
+  // <procedure> receives the prefix & suffix of each match w/in the original <target>
+  template<bool REPLACE_ONE>
+  data linear_regex_replace_fcn_generic(const string& target, const linear_regex::program& prog, 
+                                        const data_vector& args,const char* format, const char* name, data&& procedure){
+    string result;
+    size_type last_end = 0;
+    linear_regex::for_each_match(prog,target,[&](const std::vector<size_type>& caps, const size_type prefix_start) {
+      // save prefix, suffix, and matches
+      data_vector reg_args(2 + prog.total_groups);
+      reg_args[0] = make_str(target.substr(0,caps[0]));
+      reg_args[1] = make_str(target.substr(caps[1]));
+      for(size_type i = 0; i < prog.total_groups; ++i) {
+        string sub;
+        linear_regex::append_submatch(sub,target,caps,i);
+        reg_args[i+2] = make_str(std::move(sub));
+      }
+      // pass to given procedure & confirm returned a string
+      data replacement = execute_application(procedure,std::move(reg_args));
+      if(!replacement.is_type(types::str))
+        HEIST_THROW_ERR('\''<<name<<" procedure \""<<procedure.fcn.name // skip prefixing ' '
+          <<"\" didn't return a string (returned "<<HEIST_PROFILE(replacement)<<")!"<<format<<HEIST_FCN_ERR(name,args));
+      result.append(target, prefix_start, caps[0]-prefix_start);
+      result += *replacement.str;
+      last_end = caps[1];
+      return !REPLACE_ONE;
+    });
+    result.append(target, last_end, string::npos);
+    return make_str(std::move(result));
+  }
 
 
+  // Splits around non-empty matches, & empty matches not at either end of <target>
+  data linear_regex_split(const string& target, const linear_regex::program& prog){
+    data_vector split;
+    size_type last_end = 0;
+    linear_regex::for_each_match(prog,target,[&](const std::vector<size_type>& caps, size_type) {
+      if(caps[0] == caps[1] && (caps[0] == 0 || caps[0] == target.size())) return true;
+      split.push_back(make_str(target.substr(last_end,caps[0]-last_end)));
+      last_end = caps[1];
+      return true;
+    });
+    split.push_back(make_str(target.substr(last_end)));
+    return primitive_toolkit::convert_data_vector_to_proper_list(split.begin(),split.end());
+  }
+
+  /******************************************************************************
+  * REGEX PRIMITIVE DISPATCH
+  ******************************************************************************/
+
   // dipatch for "regex-replace" & "regex-replace-all"
-  data regex_primitive_replace_application(data_vector& args, const char* format, const char* name,
-                                           decltype(regex_replace) str_replace, decltype(regex_replace_fcn) fcn_replace){
+  template<bool REPLACE_ONE>
+  data regex_primitive_replace_application(data_vector& args, const char* format, const char* name, const bool using_linear_engine){
+    const auto prog = using_linear_engine ? compile_linear_regex(*args[1].str) : nullptr;
     if(args[2].is_type(types::str)) {
+      if(prog) return linear_regex_replace_generic<REPLACE_ONE>(*args[0].str,*prog,*args[2].str);
       try {
-        return str_replace(*args[0].str,*args[1].str,*args[2].str);
+        if constexpr (REPLACE_ONE) {
+          return regex_replace(*args[0].str,*args[1].str,*args[2].str);
+        } else {
+          return regex_replace_all(*args[0].str,*args[1].str,*args[2].str);
+        }
       } catch(...) {
         return throw_malformed_regex(args,format,name);
       }
     } else if(primitive_toolkit::data_is_callable(args[2])) {
+      if(prog) return linear_regex_replace_fcn_generic<REPLACE_ONE>(*args[0].str,*prog,args,format,name,primitive_toolkit::convert_callable_to_procedure(args[2]));
       try {
-        return fcn_replace(*args[0].str,*args[1].str,args,format,name,primitive_toolkit::convert_callable_to_procedure(args[2]));
+        return regex_replace_fcn_generic<REPLACE_ONE>(*args[0].str,*args[1].str,args,format,name,primitive_toolkit::convert_callable_to_procedure(args[2]));
       } catch(const SCM_EXCEPT& err) {
         throw err; // thrown by the procedure
       } catch(...) {
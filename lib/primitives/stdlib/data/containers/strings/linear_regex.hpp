@@ -0,0 +1,616 @@
+// Author: Jordan Randleman -- jordanran199@gmail.com -- linear_regex.hpp
+// => Defines a linear-time regex engine for the "regex-" string primitives
+
+// The engine compiles the ECMAScript subset of regexes without backreferences or
+// lookaheads into a Thompson NFA, which is then simulated by a Pike VM. Matching
+// is O(<pattern-length> * <target-length>), never recurses on the target string,
+// & hence is stack-safe on arbitrarily large inputs (unlike <std::regex>).
+//
+// Match semantics (leftmost-first priorities, empty-match iteration, submatch
+// positions, & "$" replacement formatting) mirror <std::regex>'s ECMAScript mode,
+// such that both engines yield the same results for patterns this engine accepts.
+// Patterns using syntax beyond said subset throw <unsupported_regex>, signaling
+// callers to fall back onto <std::regex>.
+
+#ifndef HEIST_SCHEME_CORE_STDLIB_STRINGS_LINEAR_REGEX_HPP_
+#define HEIST_SCHEME_CORE_STDLIB_STRINGS_LINEAR_REGEX_HPP_
+
+#include <bitset>
+#include <memory>
+
+namespace heist::stdlib_strings::linear_regex {
+
+  /******************************************************************************
+  * COMPILED PROGRAM REPRESENTATION
+  ******************************************************************************/
+
+  // Thrown when a regex can't be compiled into a linear-time program
+  struct unsupported_regex {};
+
+  constexpr const size_type npos = GLOBALS::MAX_SIZE_TYPE;
+
+  // Max # of instructions a program may expand to (via counted repetitions)
+  constexpr const size_type MAX_PROGRAM_LENGTH = 100000;
+
+  enum class opcode : unsigned char {chr, any, cls, split, jmp, save, bol, eol, wordb, nwordb, match};
+
+  // chr: <x> = char | cls: <x> = class idx | split: <x> preferred, <y> alternative | jmp: <x> | save: <x> capture slot
+  struct instruction {
+    opcode op;
+    size_type x = 0, y = 0;
+  };
+
+  using char_class = std::bitset<256>;
+
+  struct program {
+    std::vector<instruction> code;
+    std::vector<char_class> classes;
+    size_type total_groups = 1; // group 0 denotes the entire match
+  };
+
+  /******************************************************************************
+  * PARSE TREE
+  ******************************************************************************/
+
+  enum class node_t : unsigned char {empty, chr, any, cls, concat, alt, repeat, group, assertion};
+
+  struct node {
+    node_t type = node_t::empty;
+    size_type val = 0;                  // char | class idx | group idx (npos if non-capturing) | assertion opcode
+    size_type min = 0, max = 0;         // repetition bounds (max == npos ::= unbounded)
+    bool greedy = true;                 // repetition greediness
+    std::vector<std::unique_ptr<node>> children;
+  };
+
+  using node_ptr = std::unique_ptr<node>;
+
+  /******************************************************************************
+  * CHARACTER CLASS HELPERS
+  ******************************************************************************/
+
+  bool is_word_char(const int c)noexcept{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+  }
+
+  char_class make_class(int(*pred)(int))noexcept{
+    char_class cls;
+    for(int c = 0; c < 128; ++c) if(pred(c)) cls.set(c);
+    return cls;
+  }
+
+  char_class digit_class()noexcept{return make_class(isdigit);}
+  char_class space_class()noexcept{return make_class(isspace);}
+  char_class word_class()noexcept{
+    char_class cls;
+    for(int c = 0; c < 128; ++c) if(is_word_char(c)) cls.set(c);
+    return cls;
+  }
+
+
+  // Returns whether <name> denoted a POSIX "[:name:]" bracket class
+  bool posix_class(const string& name, char_class& cls)noexcept{
+    static constexpr const char * const names[] = {
+      "alnum","alpha","blank","cntrl","digit","graph","lower","print","punct","space","upper","xdigit","d","s","w"
+    };
+    static int(* const preds[])(int) = {
+      isalnum,isalpha,isblank,iscntrl,isdigit,isgraph,islower,isprint,ispunct,isspace,isupper,isxdigit,isdigit,isspace,nullptr
+    };
+    for(size_type i = 0; i < sizeof(names)/sizeof(names[0]); ++i) {
+      if(name == names[i]) {
+        cls = preds[i] ? make_class(preds[i]) : word_class();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /******************************************************************************
+  * PARSER: PATTERN -> PARSE TREE
+  ******************************************************************************/
+
+  struct parser {
+    const string& pat;
+    program& prog;
+    size_type i = 0;
+
+    parser(const string& p, program& pr)noexcept:pat(p),prog(pr){}
+
+    bool at_end()const noexcept{return i >= pat.size();}
+    char peek()const noexcept{return pat[i];}
+
+    static node_ptr make_node(const node_t t, const size_type val = 0)noexcept{
+      auto n = std::make_unique<node>();
+      n->type = t, n->val = val;
+      return n;
+    }
+
+    node_ptr make_class_node(const char_class& cls)noexcept{
+      prog.classes.push_back(cls);
+      return make_node(node_t::cls, prog.classes.size()-1);
+    }
+
+    node_ptr parse() {
+      auto n = parse_alternation();
+      if(!at_end()) throw unsupported_regex(); // unbalanced ')'
+      return n;
+    }
+
+    node_ptr parse_alternation() {
+      auto alt = make_node(node_t::alt);
+      alt->children.push_back(parse_concatenation());
+      while(!at_end() && peek() == '|') {
+        ++i;
+        alt->children.push_back(parse_concatenation());
+      }
+      if(alt->children.size() == 1) return std::move(alt->children[0]);
+      return alt;
+    }
+
+    node_ptr parse_concatenation() {
+      auto cat = make_node(node_t::concat);
+      while(!at_end() && peek() != '|' && peek() != ')')
+        cat->children.push_back(parse_quantified());
+      return cat;
+    }
+
+    // Returns whether parsed a "{min}", "{min,}", or "{min,max}" quantifier
+    bool parse_braced_quantifier(size_type& min, size_type& max) {
+      size_type j = i+1;
+      auto read_number = [&](size_type& n) {
+        const size_type start = j;
+        n = 0;
+        for(; j < pat.size() && isdigit(pat[j]); ++j) {
+          n = n * 10 + (pat[j] - '0');
+          if(n > MAX_PROGRAM_LENGTH) throw unsupported_regex();
+        }
+        return j > start;
+      };
+      if(!read_number(min)) return false;
+      if(j < pat.size() && pat[j] == '}') {
+        max = min;
+      } else if(j < pat.size() && pat[j] == ',') {
+        ++j;
+        if(j < pat.size() && pat[j] == '}') max = npos;
+        else if(!read_number(max) || max < min) return false;
+        if(j >= pat.size() || pat[j] != '}') return false;
+      } else {
+        return false;
+      }
+      i = j+1;
+      return true;
+    }
+
+    node_ptr parse_quantified() {
+      auto atom = parse_atom();
+      if(at_end()) return atom;
+      size_type min = 0, max = 0;
+      switch(peek()) {
+        case '*': min = 0, max = npos, ++i; break;
+        case '+': min = 1, max = npos, ++i; break;
+        case '?': min = 0, max = 1,    ++i; break;
+        case '{': if(!parse_braced_quantifier(min,max)) throw unsupported_regex(); break;
+        default: return atom;
+      }
+      if(atom->type == node_t::assertion) throw unsupported_regex();
+      auto rep = make_node(node_t::repeat);
+      rep->min = min, rep->max = max;
+      if(!at_end() && peek() == '?') rep->greedy = false, ++i;
+      // let <std::regex> diagnose consecutive quantifiers
+      if(!at_end() && (peek() == '*' || peek() == '+' || peek() == '?' || peek() == '{')) throw unsupported_regex();
+      rep->children.push_back(std::move(atom));
+      return rep;
+    }
+
+    node_ptr parse_atom() {
+      const char c = pat[i++];
+      switch(c) {
+        case '.': return make_node(node_t::any);
+        case '^': return make_node(node_t::assertion, size_type(opcode::bol));
+        case '$': return make_node(node_t::assertion, size_type(opcode::eol));
+        case '(': return parse_group();
+        case '[': return parse_bracket();
+        case '\\': return parse_escape();
+        case '*': case '+': case '?': case '{': case '}': case ']': case ')':
+          throw unsupported_regex(); // let <std::regex> diagnose the malformed syntax
+        default: return make_node(node_t::chr, (unsigned char)c);
+      }
+    }
+
+    node_ptr parse_group() {
+      size_type group_idx = npos;
+      if(!at_end() && peek() == '?') { // only "(?:" non-capturing groups (no lookaheads)
+        if(i+1 >= pat.size() || pat[i+1] != ':') throw unsupported_regex();
+        i += 2;
+      } else {
+        group_idx = prog.total_groups++;
+      }
+      auto group = make_node(node_t::group, group_idx);
+      group->children.push_back(parse_alternation());
+      if(at_end() || peek() != ')') throw unsupported_regex();
+      ++i;
+      return group;
+    }
+
+    // Parses hex digits for "\x" & "\u" escapes
+    int parse_hex(const size_type total_digits) {
+      if(i + total_digits > pat.size()) throw unsupported_regex();
+      int val = 0;
+      for(size_type j = 0; j < total_digits; ++j, ++i) {
+        if(!isxdigit(pat[i])) throw unsupported_regex();
+        val = val * 16 + (isdigit(pat[i]) ? pat[i]-'0' : (tolower(pat[i])-'a'+10));
+      }
+      if(val > 255) throw unsupported_regex(); // can't be held by a <char>
+      return val;
+    }
+
+    // Parses the escaped char after a '\' into <c>, returns false if denotes a class
+    // (stored in <cls>) rather than a char
+    bool parse_escaped_char_or_class(int& c, char_class& cls, const bool in_bracket) {
+      if(at_end()) throw unsupported_regex();
+      const char e = pat[i++];
+      switch(e) {
+        case 'd': cls = digit_class(); return false;
+        case 'D': cls = ~digit_class(); return false;
+        case 's': cls = space_class(); return false;
+        case 'S': cls = ~space_class(); return false;
+        case 'w': cls = word_class(); return false;
+        case 'W': cls = ~word_class(); return false;
+        case 'n': c = '\n'; return true;
+        case 't': c = '\t'; return true;
+        case 'r': c = '\r'; return true;
+        case 'f': c = '\f'; return true;
+        case 'v': c = '\v'; return true;
+        case '0': c = '\0'; return true;
+        case 'x': c = parse_hex(2); return true;
+        case 'u': c = parse_hex(4); return true;
+        default:
+          // backreferences, "\b" in brackets, & unknown letter escapes are left to <std::regex>
+          if(isalnum(e) || (in_bracket && e == 'b')) throw unsupported_regex();
+          c = (unsigned char)e; // identity escape
+          return true;
+      }
+    }
+
+    node_ptr parse_escape() {
+      if(!at_end() && (peek() == 'b' || peek() == 'B'))
+        return make_node(node_t::assertion, size_type(pat[i++] == 'b' ? opcode::wordb : opcode::nwordb));
+      int c = 0;
+      char_class cls;
+      if(parse_escaped_char_or_class(c,cls,false)) return make_node(node_t::chr, (unsigned char)c);
+      return make_class_node(cls);
+    }
+
+    // Parses a single bracket class element: returns false if a class (stored in <cls>)
+    bool parse_bracket_element(int& c, char_class& cls) {
+      if(at_end()) throw unsupported_regex();
+      if(peek() == '\\') {
+        ++i;
+        return parse_escaped_char_or_class(c,cls,true);
+      }
+      if(peek() == '[' && i+1 < pat.size() && pat[i+1] == ':') {
+        const auto close = pat.find(":]", i+2);
+        if(close == string::npos || !posix_class(pat.substr(i+2,close-i-2),cls)) throw unsupported_regex();
+        i = close+2;
+        return false;
+      }
+      if(peek() == '[' && i+1 < pat.size() && (pat[i+1] == '=' || pat[i+1] == '.'))
+        throw unsupported_regex(); // equivalence classes & collating symbols
+      c = (unsigned char)pat[i++];
+      return true;
+    }
+
+    node_ptr parse_bracket() {
+      char_class result;
+      bool negated = false;
+      if(!at_end() && peek() == '^') negated = true, ++i;
+      bool first = true;
+      while(true) {
+        if(at_end()) throw unsupported_regex();
+        if(peek() == ']' && !first) { ++i; break; }
+        first = false;
+        int lo = 0;
+        char_class cls;
+        if(!parse_bracket_element(lo,cls)) {
+          if(!at_end() && peek() == '-' && i+1 < pat.size() && pat[i+1] != ']') throw unsupported_regex();
+          result |= cls;
+          continue;
+        }
+        // character range
+        if(!at_end() && peek() == '-' && i+1 < pat.size() && pat[i+1] != ']') {
+          ++i;
+          int hi = 0;
+          if(!parse_bracket_element(hi,cls) || hi < lo) throw unsupported_regex();
+          for(int ch = lo; ch <= hi; ++ch) result.set(ch);
+        } else {
+          result.set(lo);
+        }
+      }
+      if(negated) result.flip();
+      return make_class_node(result);
+    }
+  }; // End struct parser
+
+  /******************************************************************************
+  * CODE GENERATION: PARSE TREE -> PROGRAM
+  ******************************************************************************/
+
+  struct code_generator {
+    program& prog;
+
+    size_type emit(const opcode op, const size_type x = 0, const size_type y = 0) {
+      if(prog.code.size() >= MAX_PROGRAM_LENGTH) throw unsupported_regex();
+      prog.code.push_back(instruction{op,x,y});
+      return prog.code.size()-1;
+    }
+
+    // Split favoring the next instruction if <greedy>, else favoring <target>
+    void patch_split(const size_type split_idx, const size_type target, const bool greedy)noexcept{
+      if(greedy) prog.code[split_idx].x = split_idx+1, prog.code[split_idx].y = target;
+      else       prog.code[split_idx].x = target,      prog.code[split_idx].y = split_idx+1;
+    }
+
+    void generate(const node& n) {
+      switch(n.type) {
+        case node_t::empty: return;
+        case node_t::chr: emit(opcode::chr,n.val); return;
+        case node_t::any: emit(opcode::any); return;
+        case node_t::cls: emit(opcode::cls,n.val); return;
+        case node_t::assertion: emit(opcode(n.val)); return;
+        case node_t::concat:
+          for(const auto& child : n.children) generate(*child);
+          return;
+        case node_t::group:
+          if(n.val != npos) emit(opcode::save,2*n.val);
+          generate(*n.children[0]);
+          if(n.val != npos) emit(opcode::save,2*n.val+1);
+          return;
+        case node_t::alt: {
+          std::vector<size_type> jumps;
+          for(size_type i = 0, total = n.children.size(); i < total; ++i) {
+            if(i+1 < total) {
+              const auto split = emit(opcode::split);
+              generate(*n.children[i]);
+              jumps.push_back(emit(opcode::jmp));
+              prog.code[split].x = split+1, prog.code[split].y = prog.code.size();
+            } else {
+              generate(*n.children[i]);
+            }
+          }
+          for(auto j : jumps) prog.code[j].x = prog.code.size();
+          return;
+        }
+        case node_t::repeat: {
+          const node& body = *n.children[0];
+          for(size_type i = 0; i < n.min; ++i) generate(body);
+          if(n.max == npos) { // L: split body, out | body | jmp L
+            const auto split = emit(opcode::split);
+            generate(body);
+            emit(opcode::jmp,split);
+            patch_split(split,prog.code.size(),n.greedy);
+          } else { // nested optionals: (body(body(...)?)?)?
+            std::vector<size_type> splits;
+            for(size_type i = n.min; i < n.max; ++i) {
+              splits.push_back(emit(opcode::split));
+              generate(body);
+            }
+            for(auto s : splits) patch_split(s,prog.code.size(),n.greedy);
+          }
+          return;
+        }
+      }
+    }
+  }; // End struct code_generator
+
+
+  // Throws <unsupported_regex> if <pattern> can't be compiled into a linear-time program
+  std::shared_ptr<program> compile(const string& pattern) {
+    auto prog = std::make_shared<program>();
+    parser p(pattern,*prog);
+    auto tree = p.parse();
+    code_generator gen{*prog};
+    gen.emit(opcode::save,0);
+    gen.generate(*tree);
+    gen.emit(opcode::save,1);
+    gen.emit(opcode::match);
+    return prog;
+  }
+
+  /******************************************************************************
+  * PIKE VM
+  ******************************************************************************/
+
+  // Search flags
+  constexpr const unsigned char MATCH_NOT_NULL   = 1; // reject empty matches
+  constexpr const unsigned char MATCH_CONTINUOUS = 2; // match must begin at the start position
+
+  struct thread_list {
+    std::vector<size_type> sparse, dense; // sparse set of instruction idxs
+    std::vector<size_type> caps;          // dense[k]'s captures: caps[k*ncap ... (k+1)*ncap)
+    size_type length = 0, ncap = 0;
+
+    thread_list(const size_type total_instructions, const size_type total_caps)noexcept
+      :sparse(total_instructions),dense(total_instructions),caps(total_instructions*total_caps),ncap(total_caps){}
+
+    bool contains(const size_type pc)const noexcept{
+      return sparse[pc] < length && dense[sparse[pc]] == pc;
+    }
+    size_type insert(const size_type pc)noexcept{
+      sparse[pc] = length, dense[length] = pc;
+      return length++;
+    }
+    void clear()noexcept{length = 0;}
+  };
+
+
+  struct vm {
+    const program& prog;
+    const string& str;
+    // epsilon-closure job: explore <pc> if <slot> is <npos>, else restore <caps[slot]> to <value>
+    struct job {
+      size_type pc, slot, value;
+    };
+    std::vector<job> stack;
+    thread_list clist, nlist;
+    std::vector<size_type> scratch;
+
+    vm(const program& p, const string& s)noexcept
+      :prog(p),str(s),clist(p.code.size(),2*p.total_groups),nlist(p.code.size(),2*p.total_groups),scratch(2*p.total_groups,npos){}
+
+    bool assertion_holds(const opcode op, const size_type pos)const noexcept{
+      switch(op) {
+        case opcode::bol: return pos == 0;
+        case opcode::eol: return pos == str.size();
+        default: {
+          const bool prev_word = pos > 0 && is_word_char((unsigned char)str[pos-1]);
+          const bool next_word = pos < str.size() && is_word_char((unsigned char)str[pos]);
+          return (prev_word != next_word) == (op == opcode::wordb);
+        }
+      }
+    }
+
+    // Follows the epsilon closure of <pc0> (iteratively, in priority order) adding
+    //   threads to <list>. <caps> is restored to its original state upon return.
+    void add_thread(thread_list& list, const size_type pc0, const size_type pos, size_type* caps) {
+      stack.push_back(job{pc0,npos,npos});
+      while(!stack.empty()) {
+        auto [pc, slot, value] = stack.back();
+        stack.pop_back();
+        if(slot != npos) { // restore a capture slot
+          caps[slot] = value;
+          continue;
+        }
+        while(!list.contains(pc)) {
+          const auto k = list.insert(pc);
+          const auto& ins = prog.code[pc];
+          if(ins.op == opcode::jmp) {
+            pc = ins.x;
+          } else if(ins.op == opcode::split) {
+            stack.push_back(job{ins.y,npos,npos});
+            pc = ins.x;
+          } else if(ins.op == opcode::save) {
+            if(ins.x < list.ncap) {
+              stack.push_back(job{0,ins.x,caps[ins.x]});
+              caps[ins.x] = pos;
+            }
+            ++pc;
+          } else if(ins.op == opcode::bol || ins.op == opcode::eol || ins.op == opcode::wordb || ins.op == opcode::nwordb) {
+            if(!assertion_holds(ins.op,pos)) break;
+            ++pc;
+          } else { // consuming instruction or match: record the thread's captures
+            std::copy(caps, caps+list.ncap, list.caps.begin()+k*list.ncap);
+            break;
+          }
+        }
+      }
+    }
+
+    bool consumes(const instruction& ins, const size_type pos)const noexcept{
+      if(pos >= str.size()) return false;
+      const unsigned char c = str[pos];
+      switch(ins.op) {
+        case opcode::chr: return c == ins.x;
+        case opcode::any: return c != '\n' && c != '\r';
+        case opcode::cls: return prog.classes[ins.x][c];
+        default:          return false;
+      }
+    }
+
+    // Search <str> from <start>: populates <result> w/ the captures of the highest-priority match
+    bool search(const size_type start, const unsigned char flags, std::vector<size_type>& result) {
+      const size_type ncap = clist.ncap;
+      bool matched = false;
+      clist.clear();
+      for(size_type pos = start; pos <= str.size(); ++pos) {
+        // seed a new lowest-priority thread until a match is found (leftmost match)
+        if(!matched && (pos == start || !(flags & MATCH_CONTINUOUS))) {
+          std::fill(scratch.begin(),scratch.end(),npos);
+          add_thread(clist,0,pos,scratch.data());
+        }
+        if(!clist.length) break;
+        nlist.clear();
+        for(size_type k = 0; k < clist.length; ++k) {
+          const auto pc = clist.dense[k];
+          const auto& ins = prog.code[pc];
+          auto thread_caps = clist.caps.begin()+k*ncap;
+          if(ins.op == opcode::match) {
+            if((flags & MATCH_NOT_NULL) && thread_caps[0] == thread_caps[1]) continue;
+            result.assign(thread_caps,thread_caps+ncap);
+            matched = true;
+            break; // cut off all lower-priority threads
+          }
+          if(consumes(ins,pos)) {
+            std::copy(thread_caps,thread_caps+ncap,scratch.begin());
+            add_thread(nlist,pc+1,pos+1,scratch.data());
+          }
+        }
+        std::swap(clist,nlist);
+      }
+      return matched;
+    }
+  }; // End struct vm
+
+  /******************************************************************************
+  * MATCH ITERATION (MIRRORS <std::regex_iterator>)
+  ******************************************************************************/
+
+  // <callback> is invoked as <callback(captures, prefix_start)> for each match, where
+  //   captures[2*i] & captures[2*i+1] bound submatch <i> (npos if unmatched), and
+  //   <prefix_start> is the end of the previous match (or 0 for the first match).
+  template<typename callback_t>
+  void for_each_match(const program& prog, const string& str, callback_t callback) {
+    vm machine(prog,str);
+    std::vector<size_type> caps;
+    size_type prefix_start = 0;
+    if(!machine.search(0,0,caps)) return;
+    while(true) {
+      if(!callback(caps,prefix_start)) return;
+      prefix_start = caps[1];
+      size_type next = caps[1];
+      if(caps[0] == caps[1]) { // empty match: retry non-empty in place, then advance 1 char
+        if(next == str.size()) return;
+        if(machine.search(next,MATCH_NOT_NULL|MATCH_CONTINUOUS,caps)) continue;
+        ++next;
+      }
+      if(!machine.search(next,0,caps)) return;
+    }
+  }
+
+  /******************************************************************************
+  * REPLACEMENT FORMATTING (MIRRORS <std::match_results::format>)
+  ******************************************************************************/
+
+  void append_submatch(string& out, const string& str, const std::vector<size_type>& caps, const size_type i)noexcept{
+    if(2*i+1 < caps.size() && caps[2*i] != npos) out.append(str, caps[2*i], caps[2*i+1]-caps[2*i]);
+  }
+
+
+  void append_formatted_replacement(string& out, const string& fmt, const string& str,
+                                    const std::vector<size_type>& caps, const size_type prefix_start)noexcept{
+    const size_type total_groups = caps.size()/2;
+    for(size_type i = 0, n = fmt.size(); i < n; ++i) {
+      if(fmt[i] != '$' || i+1 == n) {
+        out += fmt[i];
+        continue;
+      }
+      const char c = fmt[++i];
+      if(c == '$') {
+        out += '$';
+      } else if(c == '&') {
+        append_submatch(out,str,caps,0);
+      } else if(c == '`') {
+        out.append(str, prefix_start, caps[0]-prefix_start);
+      } else if(c == '\'') {
+        out.append(str, caps[1], string::npos);
+      } else if(isdigit(c)) {
+        size_type group = c - '0';
+        if(i+1 < n && isdigit(fmt[i+1])) group = group * 10 + (fmt[++i] - '0');
+        if(group < total_groups) append_submatch(out,str,caps,group);
+      } else {
+        out += '$';
+        --i; // reprocess the char after '$' as a literal
+      }
+    }
+  }
+} // End of namespace heist::stdlib_strings::linear_regex
+
+#endif
@@ -101,8 +101,9 @@ namespace heist {
   // primitive "string-trim-both" procedure:
   data primitive_STRING_TRIM_BOTH(data_vector&& args) {
     stdlib_strings::confirm_valid_string_trim_args(args, "string-trim-both","\n     (string-trim-both <string> <optional-predicate>)");
+    if(args.size() == 1) return stdlib_strings::trim_whitespace_of_string(*args[0].str);
     data_vector right_trim_args;
-    right_trim_args.push_back(make_str(*stdlib_strings::trim_left_of_string(args).str));
+    right_trim_args.push_back(stdlib_strings::trim_left_of_string(args));
     if(args.size() == 2) right_trim_args.push_back(args[1]);
     return stdlib_strings::trim_right_of_string(right_trim_args);
   }
@@ -176,19 +177,22 @@ namespace heist {
     data_vector strings_list;
     stdlib_strings::confirm_proper_string_join_args(args, grammar, delimiter, strings_list);
     if(!strings_list.empty()) {
+      size_type total_length = delimiter.size() * strings_list.size();
+      for(const auto& data_str : strings_list) total_length += data_str.str->size();
+      joined_string.reserve(total_length);
       if(grammar == stdlib_strings::STRING_GRAMMARS::INFIX) {
         joined_string += *strings_list[0].str;
         for(size_type i = 1, n = strings_list.size(); i < n; ++i)
-          joined_string += delimiter + *strings_list[i].str;
+          joined_string.append(delimiter).append(*strings_list[i].str);
       } else if(grammar == stdlib_strings::STRING_GRAMMARS::SUFFIX) {
         for(const auto& data_str : strings_list)
-          joined_string += *data_str.str + delimiter;
+          joined_string.append(*data_str.str).append(delimiter);
       } else if(grammar == stdlib_strings::STRING_GRAMMARS::PREFIX) {
         for(const auto& data_str : strings_list)
-          joined_string += delimiter + *data_str.str;
+          joined_string.append(delimiter).append(*data_str.str);
       }
     }
-    return make_str(joined_string);
+    return make_str(std::move(joined_string));
   }
 
   // primitive "string-split" procedure:
@@ -275,6 +279,32 @@ namespace heist {
     return GLOBALS::VOID_DATA_OBJECT;
   }
 
+  // primitive "string-append!" procedure:
+  // => appends in-place w/ amortized O(1) cost per char, hence strings double as
+  //    efficient "string builders" for incrementally constructed output
+  data primitive_STRING_APPEND_BANG(data_vector&& args) {
+    static constexpr const char * const format = 
+      "\n     (string-append! <string> <char-or-string1> <char-or-string2> ...)";
+    if(args.size() == 1) return primitive_toolkit::GENERATE_PRIMITIVE_PARTIAL(primitive_STRING_APPEND_BANG,args);
+    if(args.empty())
+      HEIST_THROW_ERR("'string-append! didn't receive any args:" << format << HEIST_FCN_ERR("string-append!", args));
+    if(!args[0].is_type(types::str))
+      HEIST_THROW_ERR("'string-append! 1st arg "<<HEIST_PROFILE(args[0])<<" isn't a string:" 
+        << format << HEIST_FCN_ERR("string-append!", args));
+    if(auto i = stdlib_strings::confirm_only_char_or_string_args(args); i != GLOBALS::MAX_SIZE_TYPE)
+      HEIST_THROW_ERR("'string-append! arg #" << i+1 << ", " << HEIST_PROFILE(args[i]) << ", isn't a character or string:"
+        << format << HEIST_FCN_ERR("string-append!", args));
+    auto& target = *args[0].str;
+    for(size_type i = 1, n = args.size(); i < n; ++i) {
+      if(args[i].is_type(types::chr)) {
+        target += char(args[i].chr);
+      } else {
+        target.append(*args[i].str); // self-appending is safe
+      }
+    }
+    return GLOBALS::VOID_DATA_OBJECT;
+  }
+
   // primitive "string-push-front!" procedure:
   data primitive_STRING_PUSH_FRONT_BANG(data_vector&& args) {
     static constexpr const char * const format = 
@@ -456,24 +486,28 @@ namespace heist {
   // primitive "regex-replace": replaces 1st instance w/ a string or using the given callable
   data primitive_REGEX_REPLACE(data_vector&& args) {
     static constexpr const char * const format = 
-      "\n     (regex-replace <target-string> <regex-string> <replacement-string>)"
-      "\n     (regex-replace <target-string> <regex-string> <callable>)"
-      "\n     -> <callable> ::= (lambda (<prefix>, <suffix>, <match1>, ...) <body>)";
+      "\n     (regex-replace <target-string> <regex-string> <replacement-string> <optional-engine>)"
+      "\n     (regex-replace <target-string> <regex-string> <callable> <optional-engine>)"
+      "\n     -> <callable> ::= (lambda (<prefix>, <suffix>, <match1>, ...) <body>)"
+      "\n     -> <optional-engine> ::= 'linear | 'backtracking";
     if(!args.empty() && args.size() < 3) return primitive_toolkit::GENERATE_PRIMITIVE_PARTIAL(primitive_REGEX_REPLACE,args);
+    const bool using_linear_engine = stdlib_strings::pop_regex_engine_choice(args);
     stdlib_strings::confirm_n_args_and_first_2_args_are_strings(args,3,format,"regex-replace");
-    return stdlib_strings::regex_primitive_replace_application(args,format,"regex-replace",stdlib_strings::regex_replace,stdlib_strings::regex_replace_fcn);
+    return stdlib_strings::regex_primitive_replace_application<true>(args,format,"regex-replace",using_linear_engine);
   }
 
 
   // primitive "regex-replace-all": replaces all instances w/ a string or using the given callable
   data primitive_REGEX_REPLACE_ALL(data_vector&& args) {
     static constexpr const char * const format = 
-      "\n     (regex-replace-all <target-string> <regex-string> <replacement-string>)"
-      "\n     (regex-replace-all <target-string> <regex-string> <callable>)"
-      "\n     -> <callable> ::= (lambda (<prefix>, <suffix>, <match1>, ...) <body>)";
+      "\n     (regex-replace-all <target-string> <regex-string> <replacement-string> <optional-engine>)"
+      "\n     (regex-replace-all <target-string> <regex-string> <callable> <optional-engine>)"
+      "\n     -> <callable> ::= (lambda (<prefix>, <suffix>, <match1>, ...) <body>)"
+      "\n     -> <optional-engine> ::= 'linear | 'backtracking";
     if(!args.empty() && args.size() < 3) return primitive_toolkit::GENERATE_PRIMITIVE_PARTIAL(primitive_REGEX_REPLACE_ALL,args);
+    const bool using_linear_engine = stdlib_strings::pop_regex_engine_choice(args);
     stdlib_strings::confirm_n_args_and_first_2_args_are_strings(args,3,format,"regex-replace-all");
-    return stdlib_strings::regex_primitive_replace_application(args,format,"regex-replace-all",stdlib_strings::regex_replace_all,stdlib_strings::regex_replace_all_fcn);
+    return stdlib_strings::regex_primitive_replace_application<false>(args,format,"regex-replace-all",using_linear_engine);
   }
 
 
@@ -482,9 +516,14 @@ namespace heist {
   //    -> each sublist begins with the position, followed by all match
   data primitive_REGEX_MATCH(data_vector&& args) {
     static constexpr const char * const format = 
-      "\n     (regex-match <target-string> <regex-string>)";
+      "\n     (regex-match <target-string> <regex-string> <optional-engine>)"
+      "\n     -> <optional-engine> ::= 'linear | 'backtracking";
     if(args.size() == 1) return primitive_toolkit::GENERATE_PRIMITIVE_PARTIAL(primitive_REGEX_MATCH,args);
+    const bool using_linear_engine = stdlib_strings::pop_regex_engine_choice(args);
     stdlib_strings::confirm_n_args_and_first_2_args_are_strings(args,2,format,"regex-match");
+    if(using_linear_engine)
+      if(auto prog = stdlib_strings::compile_linear_regex(*args[1].str))
+        return stdlib_strings::linear_regex_matches(*args[0].str,*prog);
     try {
       return stdlib_strings::get_regex_matches(*args[0].str,*args[1].str);
     } catch(...) {
@@ -496,11 +535,16 @@ namespace heist {
   // primitive "regex-split" procedure:
   data primitive_REGEX_SPLIT(data_vector&& args) {
     static constexpr const char * const format = 
-      "\n     (regex-split <target-string> <optional-regex-string> <optional-start-index>)";
+      "\n     (regex-split <target-string> <optional-regex-string> <optional-start-index> <optional-engine>)"
+      "\n     -> <optional-engine> ::= 'linear | 'backtracking";
+    const bool using_linear_engine = stdlib_strings::pop_regex_engine_choice(args);
     string delimiter("");
     size_type start_index = 0;
     stdlib_strings::confirm_proper_string_split_args(args,"regex-split",format,delimiter,start_index);
     // split the string into a list of strings
+    if(using_linear_engine && !delimiter.empty())
+      if(auto prog = stdlib_strings::compile_linear_regex(delimiter))
+        return stdlib_strings::linear_regex_split(args[0].str->substr(start_index),*prog);
     try {
       return stdlib_strings::regex_split(args[0].str->substr(start_index),delimiter);
     } catch(...) {
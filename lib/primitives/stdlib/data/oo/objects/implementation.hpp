@@ -39,7 +39,7 @@ namespace heist::stdlib_objects {
 
 
   data initialize_OO_ctord_object_HMAP(data_vector& args, cls_type& class_proto_obj, object_type& obj, const char* format) {
-    const size_type total_members = obj.member_names.size();
+    const size_type total_members = obj.member_names().size();
     for(auto& keyval : args[1].map->val) {
       auto key = map_object::unhash_key(keyval.first);
       if(!key.is_type(types::sym))
@@ -50,7 +50,7 @@ namespace heist::stdlib_objects {
           << "\" (\"super\" & \"prototype\" are initialized internally)!" << format 
           << HEIST_FCN_ERR(class_proto_obj->class_name,args));
       for(size_type i = 0; i < total_members; ++i) {
-        if(obj.member_names[i] == key.sym) {
+        if(obj.member_names()[i] == key.sym) {
           obj.member_values[i] = keyval.second;
           goto next_member;
         }
@@ -68,7 +68,7 @@ namespace heist::stdlib_objects {
     if(args[1].vec->size() > (obj.member_values.size() - 2))
       throw_too_many_values_in_OO_initialization(args,class_proto_obj,obj,format,"vector");
     for(size_type i = 0, j = 0, n = args[1].vec->size(); i < n; ++j)
-      if(obj.member_names[j] != "prototype" && obj.member_names[j] != "super")
+      if(obj.member_names()[j] != "prototype" && obj.member_names()[j] != "super")
         obj.member_values[j] = args[1].vec->operator[](i++);
     return make_obj(std::move(obj));
   }
@@ -83,7 +83,7 @@ namespace heist::stdlib_objects {
     data iter = args[1];
     while(iter.is_type(types::par)) {
       if(i == n) throw_too_many_values_in_OO_initialization(args,class_proto_obj,obj,format,"list");
-      if(obj.member_names[i] == "prototype" || obj.member_names[i] == "super") {
+      if(obj.member_names()[i] == "prototype" || obj.member_names()[i] == "super") {
         ++i;
         continue;
       }
@@ -99,13 +99,12 @@ namespace heist::stdlib_objects {
     obj.proto = class_proto_obj; // ptr to the prototype object
     for(size_type i = 0, n = class_proto_obj->member_values.size(); i < n; ++i)
       obj.member_values.push_back(class_proto_obj->member_values[i].copy());
-    obj.member_names = class_proto_obj->member_names;
-    obj.method_names = class_proto_obj->method_names, obj.method_values = class_proto_obj->method_values;
+    obj.method_values = class_proto_obj->method_values;
+    // share the class's shape (its property names & the <prototype> and <super> members)
+    obj.shape = class_proto_obj->get_instance_shape();
     // add the <prototype> member
-    obj.member_names.push_back("prototype");
     obj.member_values.push_back(class_proto_obj);
     // add the <super> member
-    obj.member_names.push_back("super");
     if(class_proto_obj->super) {
       object_type super_obj;
       initialize_object_with_prototype_properties_and_inheritance(super_obj,class_proto_obj->super);
@@ -136,8 +135,9 @@ namespace heist::stdlib_objects {
 
 
   bool object_has_property_name(obj_type& obj, const string& name)noexcept{
-    return std::find(obj->member_names.begin(),obj->member_names.end(),name) != obj->member_names.end() || 
-           std::find(obj->method_names.begin(),obj->method_names.end(),name) != obj->method_names.end();
+    size_type slot = 0;
+    bool is_member = false;
+    return obj->shape->find_property(name,slot,is_member);
   }
 
 
@@ -145,14 +145,12 @@ namespace heist::stdlib_objects {
     auto proto = obj->proto;
     for(size_type i = 0, n = proto->member_names.size(); i < n; ++i) {
       if(!object_has_property_name(obj,proto->member_names[i])) {
-        obj->member_names.push_back(proto->member_names[i]);
-        obj->member_values.push_back(proto->member_values[i].copy());
+        obj->add_member(proto->member_names[i],proto->member_values[i].copy());
       }
     }
     for(size_type i = 0, n = proto->method_names.size(); i < n; ++i) {
       if(!object_has_property_name(obj,proto->method_names[i])) {
-        obj->method_names.push_back(proto->method_names[i]);
-        obj->method_values.push_back(proto->method_values[i]);
+        obj->add_method(proto->method_names[i],proto->method_values[i]);
       }
     }
   }
@@ -163,14 +161,14 @@ namespace heist::stdlib_objects {
   template<bool DONT_INCLUDE_SUPER_PROTOTYPE_MEMBERS>
   data recursively_convert_OBJ_to_HMAP(const data& d)noexcept{
     map_object m;
-    for(size_type i = 0, n = d.obj->member_names.size(); i < n; ++i) {
+    for(size_type i = 0, n = d.obj->member_names().size(); i < n; ++i) {
       if constexpr (DONT_INCLUDE_SUPER_PROTOTYPE_MEMBERS)
-        if(d.obj->member_names[i] == "super" || d.obj->member_names[i] == "prototype") 
+        if(d.obj->member_names()[i] == "super" || d.obj->member_names()[i] == "prototype") 
           continue;
       if(d.obj->member_values[i].is_type(types::obj))
-        m.val[d.obj->member_names[i]+char(types::sym)] = recursively_convert_OBJ_to_HMAP<DONT_INCLUDE_SUPER_PROTOTYPE_MEMBERS>(d.obj->member_values[i]);
+        m.val[d.obj->member_names()[i]+char(types::sym)] = recursively_convert_OBJ_to_HMAP<DONT_INCLUDE_SUPER_PROTOTYPE_MEMBERS>(d.obj->member_values[i]);
       else
-        m.val[d.obj->member_names[i]+char(types::sym)] = d.obj->member_values[i];
+        m.val[d.obj->member_names()[i]+char(types::sym)] = d.obj->member_values[i];
     }
     return make_map(std::move(m));
   }
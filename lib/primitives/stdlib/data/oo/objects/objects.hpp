@@ -75,8 +75,8 @@ namespace heist {
     stdlib_objects::confirm_given_unary_object_arg(args,"object-members");
     stdlib_objects::populate_obj_with_new_dynamic_proto_properties(args[0].obj);
     map_object m;
-    for(size_type i = 0, n = args[0].obj->member_names.size(); i < n; ++i)
-      m.val[args[0].obj->member_names[i]+char(types::sym)] = args[0].obj->member_values[i];
+    for(size_type i = 0, n = args[0].obj->member_names().size(); i < n; ++i)
+      m.val[args[0].obj->member_names()[i]+char(types::sym)] = args[0].obj->member_values[i];
     return make_map(std::move(m));
   }
 
@@ -84,8 +84,8 @@ namespace heist {
     stdlib_objects::confirm_given_unary_object_arg(args,"object-methods");
     stdlib_objects::populate_obj_with_new_dynamic_proto_properties(args[0].obj);
     map_object m;
-    for(size_type i = 0, n = args[0].obj->method_names.size(); i < n; ++i)
-      m.val[args[0].obj->method_names[i]+char(types::sym)] = args[0].obj->method_values[i].fcn.bind_self(args[0].obj);
+    for(size_type i = 0, n = args[0].obj->method_names().size(); i < n; ++i)
+      m.val[args[0].obj->method_names()[i]+char(types::sym)] = args[0].obj->method_values[i].fcn.bind_self(args[0].obj);
     return make_map(std::move(m));
   }
 
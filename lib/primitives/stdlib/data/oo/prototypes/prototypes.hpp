@@ -52,6 +52,9 @@ namespace heist {
       args[0].cls->member_names.push_back(args[1].sym);
       args[0].cls->member_values.push_back(args[2]);
     }
+    // New instances get the new property in their shape, & inherited-property caches go stale
+    args[0].cls->instance_shape = nullptr;
+    ++GLOBALS::PROTOTYPE_PROPERTY_ADDITIONS;
     return GLOBALS::VOID_DATA_OBJECT;
   }
 
@@ -31,7 +31,7 @@ namespace heist::stdlib_type_predicates {
 
   bool object_has_overloaded_COERCE_SELF_TO_TYPE_method(obj_type& obj)noexcept{
     stdlib_objects::populate_obj_with_new_dynamic_proto_properties(obj);
-    for(const auto& method_name : obj->method_names) 
+    for(const auto& method_name : obj->method_names()) 
       if(method_name == "self->type") return true;
     return obj->super && object_has_overloaded_COERCE_SELF_TO_TYPE_method(obj->super);
   }
@@ -47,8 +47,8 @@ namespace heist::stdlib_type_predicates {
   // <apply_dynamic_method> comes from: 
   //   lib/core/type_system/scheme_types/data/implementation_helpers/dynamic_method_applicator.hpp
   data apply_object_overloaded_COERCE_SELF_TO_TYPE_method(obj_type& obj) {
-    for(size_type i = 0, n = obj->method_names.size(); i < n; ++i)
-      if(obj->method_names[i] == "self->type")
+    for(size_type i = 0, n = obj->method_names().size(); i < n; ++i)
+      if(obj->method_names()[i] == "self->type")
         return apply_dynamic_method(obj,data_vector(),obj->method_values[i].fcn);
     if(obj->super) 
       return apply_object_overloaded_COERCE_SELF_TO_TYPE_method(obj->super);
@@ -75,15 +75,14 @@ namespace heist {
   ******************************************************************************/
 
   data primitive_JUMP_BANG(data_vector&& args) {
+    // get whether in a tail call
+    bool tail_call = args.rbegin()->bol.val;
+    args.pop_back();
     if(args.size() > 1)
       HEIST_THROW_ERR("'jump! received incorrect # of args!"
         "\n     (jump! <optional-arg>)" << HEIST_FCN_ERR("jump!",args));
-    if(args.size() == 1)
-      GLOBALS::JUMP_GLOBAL_PRIMITIVE_ARGUMENT = args[0];
-    else
-      GLOBALS::JUMP_GLOBAL_PRIMITIVE_ARGUMENT = GLOBALS::VOID_DATA_OBJECT;
-    throw SCM_EXCEPT::JUMP;
-    return data();
+    if(args.empty()) args.push_back(GLOBALS::VOID_DATA_OBJECT);
+    return stdlib_controlflow::jump_to_escape_frame(0,args[0],tail_call);
   }
 
   data primitive_CATCH_JUMP(data_vector&& args) {
@@ -91,14 +90,35 @@ namespace heist {
       HEIST_THROW_ERR("'catch-jump received incorrect # of args!"
         "\n     (catch-jump <callable> <arg1> ... <argN>)" << HEIST_FCN_ERR("catch-jump",args));
     primitive_toolkit::confirm_data_is_callable(args[0], args, "catch-jump", "\n     (catch-jump <callable> <arg1> ... <argN>)");
-    try {
-      return primitive_toolkit::apply_callable(args[0],data_vector(args.begin()+1,args.end()));
-    } catch(const SCM_EXCEPT& jump_error) {
-      if(jump_error == SCM_EXCEPT::JUMP)
-        return GLOBALS::JUMP_GLOBAL_PRIMITIVE_ARGUMENT;
-      throw jump_error;
-    }
-    return data();
+    return stdlib_controlflow::apply_within_escape_frame(0,args[0],data_vector(args.begin()+1,args.end()));
+  }
+
+  /******************************************************************************
+  * ESCAPE CONTINUATIONS
+  ******************************************************************************/
+
+  // Escape procedures generated by "call/ec" (bound to the id of their escape frame)
+  data primitive_ESCAPE_CONTINUATION(data_vector&& args) {
+    // get whether in a tail call
+    bool tail_call = args.rbegin()->bol.val;
+    args.pop_back();
+    if(args.size() > 2)
+      HEIST_THROW_ERR("'escape-continuation received incorrect # of args!"
+        "\n     (<escape-continuation> <optional-arg>)" 
+        << HEIST_FCN_ERR("escape-continuation",data_vector(args.begin()+1,args.end())));
+    if(args.size() == 1) args.push_back(GLOBALS::VOID_DATA_OBJECT);
+    return stdlib_controlflow::jump_to_escape_frame((size_type)args[0].num.extract_inexact(),args[1],tail_call);
+  }
+
+  data primitive_CALL_EC(data_vector&& args) {
+    static constexpr const char * const format = "\n     (call/ec <unary-callable>)";
+    if(args.size() != 1)
+      HEIST_THROW_ERR("'call/ec received incorrect # of args!" << format << HEIST_FCN_ERR("call/ec",args));
+    primitive_toolkit::confirm_data_is_callable(args[0], args, "call/ec", format);
+    const auto id = stdlib_controlflow::new_escape_frame_id();
+    auto escape = primitive_toolkit::GENERATE_PRIMITIVE_PARTIAL(primitive_ESCAPE_CONTINUATION,data_vector(1,num_type(id)));
+    escape.fcn.name = "escape-continuation";
+    return stdlib_controlflow::apply_within_escape_frame(id,args[0],data_vector(1,std::move(escape)));
   }
 
   /******************************************************************************
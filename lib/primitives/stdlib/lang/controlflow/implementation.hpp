@@ -88,8 +88,8 @@ namespace heist::stdlib_controlflow {
     obj_type obj = d.obj;
     while(obj) {
       // search object's local members
-      for(size_type i = 0, n = obj->method_names.size(); i < n; ++i)
-        if(obj->method_names[i] == "self->procedure") {
+      for(size_type i = 0, n = obj->method_names().size(); i < n; ++i)
+        if(obj->method_names()[i] == "self->procedure") {
           obj->method_values[i].fcn.set_using_dynamic_scope(using_dynamic_scope);
           return;
         }
@@ -97,7 +97,7 @@ namespace heist::stdlib_controlflow {
       for(size_type i = 0, n = obj->proto->method_names.size(); i < n; ++i)
         if(obj->proto->method_names[i] == "self->procedure") {
           // Cache the method dynamically added to the object's prototype IN the object
-          obj->method_names.push_back("self->procedure"), obj->method_values.push_back(obj->proto->method_values[i]);
+          obj->add_method("self->procedure",obj->proto->method_values[i]);
           obj->method_values.rbegin()->fcn.set_using_dynamic_scope(using_dynamic_scope);
           return;
         }
@@ -128,6 +128,72 @@ namespace heist::stdlib_controlflow {
     return boolean(primitive_toolkit::validate_callable_and_convert_to_procedure(args[0],args,name,format).fcn.is_using_dynamic_scope() == checking_dynamic_scope);
   }
 
+  /******************************************************************************
+  * ESCAPE FRAMES (CATCH-JUMP & CALL/EC)
+  ******************************************************************************/
+
+  // Links an escape frame onto the current stack while applying its callable
+  struct escape_frame_registration {
+    escape_frame frame;
+    size_type stack_trace_size;
+    escape_frame_registration(const size_type id)noexcept
+      : frame{id,GLOBALS::APPLICATION_DEPTH,GLOBALS::ESCAPE_FRAMES}, stack_trace_size(GLOBALS::STACK_TRACE.size()) {
+      GLOBALS::ESCAPE_FRAMES = &frame;
+    }
+    ~escape_frame_registration()noexcept{GLOBALS::ESCAPE_FRAMES = frame.parent;}
+  };
+
+
+  // Unique (per-thread) id for each "call/ec" escape procedure
+  size_type new_escape_frame_id()noexcept{
+    static thread_local size_type escape_frame_count = 0;
+    return ++escape_frame_count;
+  }
+
+
+  // Applies <callable> to <args> w/in an escape frame: returns either its result, 
+  //   or the value of the jump/escape targeting the frame
+  data apply_within_escape_frame(const size_type id, data& callable, data_vector&& args) {
+    escape_frame_registration registration(id);
+    try {
+      return primitive_toolkit::apply_callable(callable,std::move(args));
+    } catch(const SCM_EXCEPT& jump_error) {
+      if(jump_error != SCM_EXCEPT::JUMP || GLOBALS::JUMP_TARGET != id) throw jump_error;
+      // clear the unwound calls from the stack trace
+      if(GLOBALS::STACK_TRACE.size() > registration.stack_trace_size)
+        GLOBALS::STACK_TRACE.resize(registration.stack_trace_size);
+      return GLOBALS::JUMP_GLOBAL_PRIMITIVE_ARGUMENT;
+    }
+  }
+
+
+  // Whether a fiber's resumer (or theirs, etc.) is running w/in the frame w/ <id>
+  bool escape_frame_is_active_in_a_resumer(const size_type id)noexcept{
+    for(auto fiber = coroutine_fiber::running(); fiber; fiber = fiber->resumer)
+      for(auto frame = fiber->escape_frames; frame; frame = frame->parent)
+        if(frame->id == id) return true;
+    return false;
+  }
+
+
+  // Jumps to the frame w/ <id> (the innermost "catch-jump" if 0) w/ <value>.
+  // => Jumping in a tail call of the frame's callable is equivalent to returning 
+  //    from it, hence such simply returns <value> rather than unwinding the stack.
+  data jump_to_escape_frame(const size_type id, data& value, const bool tail_call) {
+    auto frame = GLOBALS::ESCAPE_FRAMES;
+    while(frame && frame->id != id) frame = frame->parent;
+    if(frame && tail_call && frame->application_depth+1 == GLOBALS::APPLICATION_DEPTH)
+      return value;
+    if(id && !frame && !escape_frame_is_active_in_a_resumer(id))
+      HEIST_THROW_ERR("'call/ec escape continuation invoked outside of its \"call/ec\" application!"
+        "\n     (call/ec <unary-callable>)" 
+        "\n     => Escape continuations can only be invoked w/in their \"call/ec\" application!");
+    GLOBALS::JUMP_GLOBAL_PRIMITIVE_ARGUMENT = value;
+    GLOBALS::JUMP_TARGET = id;
+    throw SCM_EXCEPT::JUMP;
+    return data(); // never triggered
+  }
+
   /******************************************************************************
   * MACRO EXPANSION
   ******************************************************************************/
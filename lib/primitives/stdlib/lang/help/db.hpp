@@ -58,7 +58,8 @@ static constexpr const char* HELP_MENU_TYPES[] = {
   "char",            "boolean",    "list",       "pair",               "vector", 
   "hmap",            "alist",      "input-port", "output-port",        "object", 
   "class-prototype", "procedure",  "void",       "undefined",          "sequence", 
-  "coroutine",       "universe",   "module",     "syntax-transformer", 
+  "coroutine",       "universe",   "module",     "syntax-transformer", "channel", 
+  "async-operation", "socket-listener", 
 };
 
 static constexpr const char* HELP_MENU_SPECIALS[] = { 
@@ -70,7 +71,7 @@ static constexpr const char* HELP_MENU_SPECIALS[] = {
   "vector-literal", "hmap-literal",        "define-syntax", "syntax-rules",     "syntax-hash",
   "core-syntax",    "define-reader-alias", "scm->cps",      "cps-quote",        "using-cps?",
   "curry",          "-<>",                 "defclass",      "new",              "define-coroutine", 
-  "define-module",  "define-overload",     "infix!",        "unfix!",
+  "define-module",  "define-overload",     "infix!",        "unfix!",           "let/ec",
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES[] = { 
@@ -80,7 +81,7 @@ static constexpr const char* HELP_MENU_PROCEDURES[] = {
   "predicates",   "coercion",     "copying",     "evalapply", "compose-bind-id", 
   "output",       "formatoutput", "input",       "files",     "ports", 
   "sysinterface", "invariants",   "controlflow", "call/cc",   "gensyms",
-  "syntax",       "json",         "csv", 
+  "syntax",       "json",         "csv",         "fasl",      "eventloop", 
 };
 
 static constexpr char** HELP_MENU_SUBMENUS[] = {
@@ -111,7 +112,8 @@ static constexpr const char* HELP_MENU_PROCEDURES_PROTOTYPES[] = {
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES_COROUTINES[] = {
-  "coroutine?", "coroutine->generator", "cycle-coroutines!",
+  "coroutine?", "coroutine->generator", "cycle-coroutines!", "set-coroutine-stack-size!", 
+  "coroutine-stack-size",
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES_STREAMS[] = {
@@ -120,7 +122,7 @@ static constexpr const char* HELP_MENU_PROCEDURES_STREAMS[] = {
   "stream-drop-while", "stream-take",     "stream-take-while", "stream-map", 
   "stream-filter",     "stream-for-each", "stream-unfold",     "stream-fold", 
   "stream-fold-right", "stream-from",     "stream-iterate",    "stream-zip", 
-  "stream-constant",   "stream-interleave", 
+  "stream-constant",   "stream-interleave", "port->line-stream", 
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES_NUMBERS[] = {
@@ -151,16 +153,16 @@ static constexpr const char* HELP_MENU_PROCEDURES_CHARS[] = {
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES_STRINGS[] = {
-  "string",             "make-string",              "string-unfold",      "string-unfold-right", 
-  "string-pad",         "string-pad-right",         "string-trim",        "string-trim-right", 
-  "string-trim-both",   "string-replace",           "string-contains",    "string-contains-right", 
-  "string-contains-ci", "string-contains-right-ci", "string-join",        "string-split",
-  "string-swap!",       "string-push-back!",        "string-push-front!", "string-pop-back!", 
-  "string-pop-front!",  "string-empty?",            "string-copy!",       "string=?",
-  "string<?",           "string>?",                 "string<=?",          "string>=?",
-  "string-ci=?",        "string-ci<?",              "string-ci>?",        "string-ci<=?",
-  "string-ci>=?",       "regex-replace",            "regex-replace-all",  "regex-match",
-  "regex-split", 
+  "string",             "make-string",              "string-unfold",   "string-unfold-right",
+  "string-pad",         "string-pad-right",         "string-trim",     "string-trim-right",
+  "string-trim-both",   "string-replace",           "string-contains", "string-contains-right",
+  "string-contains-ci", "string-contains-right-ci", "string-join",     "string-split",
+  "string-swap!",       "string-push-back!",        "string-append!",  "string-push-front!",
+  "string-pop-back!",   "string-pop-front!",        "string-empty?",   "string-copy!",
+  "string=?",           "string<?",                 "string>?",        "string<=?",
+  "string>=?",          "string-ci=?",              "string-ci<?",     "string-ci>?",
+  "string-ci<=?",       "string-ci>=?",             "regex-replace",   "regex-replace-all",
+  "regex-match",        "regex-split",
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES_PAIRS[] = {
@@ -177,7 +179,9 @@ static constexpr const char* HELP_MENU_PROCEDURES_VECTORS[] = {
   "vector",              "make-vector",          "vector-push-back!",           "vector-push-front!", 
   "vector-pop-back!",    "vector-pop-front!",    "vector-iota",                 "vector-unfold", 
   "vector-unfold-right", "vector-grow",          "vector-empty?",               "vector-copy!",  
-  "vector-swap!",        "vector-binary-search", "vector-get-all-combinations", 
+  "vector-swap!",        "vector-binary-search", "vector-get-all-combinations", "<tag>vector", 
+  "make-<tag>vector",    "<tag>vector?",         "vector-><tag>vector",         "homogeneous-vector?", 
+  "homogeneous-vector-type", 
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES_HMAPS[] = {
@@ -203,6 +207,7 @@ static constexpr const char* HELP_MENU_PROCEDURES_SEQUENCES[] = {
   "seq->vector",   "seq->string",          "union",                "intersection",
   "difference",    "symmetric-difference", "sort",                 "sort!",
   "sorted?",       "merge",                "delete-neighbor-dups", "delete-neighbor-dups!", 
+  "pmap",          "pfor-each",            "preduce",
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES_PREDICATES[] = {
@@ -269,6 +274,7 @@ static constexpr const char* HELP_MENU_PROCEDURES_PORTS[] = {
   "call-with-input-file", "call-with-output-file", "with-input-from-file", "with-output-to-file", 
   "open-input-file",      "open-output-file",      "open-output-file+",    "open-output-file!",
   "rewind-port!",         "port-seek!",            "port-seek-front!",     "close-port", 
+  "open-input-string",    "flush-output-port",     "set-port-buffering!",
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES_SYSINTERFACE[] = {
@@ -281,14 +287,15 @@ static constexpr const char* HELP_MENU_PROCEDURES_INVARIANTS[] = {
   "set-nansi!",          "nansi?",                   "ci?",                 "set-pprint-column-width!", 
   "pprint-column-width", "set-max-recursion-depth!", "max-recursion-depth", "set-repl-prompt!",
   "repl-prompt",         "set-dynamic-call-trace!",  "dynamic-call-trace?", "set-trace-args!",
-  "trace-args?",         "set-dot!",                 "dot",                 "set-falsey!", 
-  "set-truthy!",         "falsey-values",
+  "trace-args?",         "set-linear-regex!",        "linear-regex?",       "set-dot!",
+  "dot",                 "set-falsey!",              "set-truthy!",         "falsey-values",
+  "set-parallel-workers!", "parallel-workers",
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES_CONTROLFLOW[] = {
   "exit",                         "error",                        "syntax-error",   "call/ce", 
   "lexical-scope->dynamic-scope", "dynamic-scope->lexical-scope", "dynamic-scope?", "lexical-scope?", 
-  "jump!",                        "catch-jump",                   "trace", 
+  "jump!",                        "catch-jump",                   "call/ec",        "trace", 
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES_CALLCC[] = {""}; // direct link
@@ -301,11 +308,23 @@ static constexpr const char* HELP_MENU_PROCEDURES_SYNTAX[] = {
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES_JSON[] = {
-  "json->scm", "scm->json", "object->json", "json-datum?", 
+  "json->scm", "scm->json", "object->json", "json-datum?", "write-json", 
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES_CSV[] = {
   "csv->list", "csv->vector", "list->csv", "vector->csv", "csv-datum?", 
+  "csv->alists", "read-csv-row", "port->csv-stream", 
+};
+
+static constexpr const char* HELP_MENU_PROCEDURES_FASL[] = {
+  "fasl-write", "fasl-read", 
+};
+
+static constexpr const char* HELP_MENU_PROCEDURES_EVENTLOOP[] = {
+  "async",             "await",             "async-done?",      "run-event-loop", 
+  "sleep-async",       "read-line-async",   "read-char-async",  "display-async", 
+  "run-process-async", "open-tcp-listener", "open-unix-listener", "listener-port", 
+  "close-listener!",   "accept-async",      "connect-tcp-async", "connect-unix-async", 
 };
 
 static constexpr const char* HELP_MENU_PROCEDURES_GENSYM[] = {
@@ -326,6 +345,7 @@ static constexpr char** HELP_MENU_PROCEDURES_SUBMENU[] = {
   (char**)HELP_MENU_PROCEDURES_FORMATOUTPUT, (char**)HELP_MENU_PROCEDURES_INPUT,      (char**)HELP_MENU_PROCEDURES_FILES,         (char**)HELP_MENU_PROCEDURES_PORTS,
   (char**)HELP_MENU_PROCEDURES_SYSINTERFACE, (char**)HELP_MENU_PROCEDURES_INVARIANTS, (char**)HELP_MENU_PROCEDURES_CONTROLFLOW,   (char**)HELP_MENU_PROCEDURES_CALLCC,
   (char**)HELP_MENU_PROCEDURES_GENSYM,       (char**)HELP_MENU_PROCEDURES_SYNTAX,     (char**)HELP_MENU_PROCEDURES_JSON,          (char**)HELP_MENU_PROCEDURES_CSV,           
+  (char**)HELP_MENU_PROCEDURES_FASL,         (char**)HELP_MENU_PROCEDURES_EVENTLOOP, 
 };
 
 static constexpr size_type HELP_MENU_PROCEDURES_SUBMENU_LENGTH[] = {
@@ -346,6 +366,7 @@ static constexpr size_type HELP_MENU_PROCEDURES_SUBMENU_LENGTH[] = {
   sizeof(HELP_MENU_PROCEDURES_CONTROLFLOW)/sizeof(HELP_MENU_PROCEDURES_CONTROLFLOW[0]),     0, /* call/cc => direct link */
   sizeof(HELP_MENU_PROCEDURES_GENSYM)/sizeof(HELP_MENU_PROCEDURES_GENSYM[0]),               sizeof(HELP_MENU_PROCEDURES_SYNTAX)/sizeof(HELP_MENU_PROCEDURES_SYNTAX[0]),
   sizeof(HELP_MENU_PROCEDURES_JSON)/sizeof(HELP_MENU_PROCEDURES_JSON[0]),                   sizeof(HELP_MENU_PROCEDURES_CSV)/sizeof(HELP_MENU_PROCEDURES_CSV[0]),           
+  sizeof(HELP_MENU_PROCEDURES_FASL)/sizeof(HELP_MENU_PROCEDURES_FASL[0]),                   sizeof(HELP_MENU_PROCEDURES_EVENTLOOP)/sizeof(HELP_MENU_PROCEDURES_EVENTLOOP[0]), 
 };
 
 static constexpr char** HELP_MENU_PROCEDURES_DIRECT_LINKS[] = {
@@ -703,6 +724,7 @@ Used with:
 
 Get the current implicit output-port w/ "current-output-port" (stdout by default).
   *) Sessions automatically close remaining open ports upon a successful exit.
+  *) Output to file ports is buffered: see "set-port-buffering!".
 )",
 
 
@@ -752,8 +774,9 @@ Analyze prototypes via the "proto-name" "proto-members" "proto-methods" &
            too!
 
 NOTE: "coroutine" is a class prototype under the hood, and "define-coroutine"
-      simply serves to manipute the coro body & use it generate a coroutine
-      object, which is then passed back to the user to control coro execution!
+      simply serves to wrap the coro body in a thunk & use it generate a 
+      coroutine object, which is then passed back to the user to control coro
+      execution! Said thunk runs on its own native stack (a "fiber").
 
 NOTE: "module" is simply a class prototype under the hood too, with 
       "define-module" serving to generate objects with exposed procedures!
@@ -2540,22 +2563,29 @@ Initial invocation '(<co-name>)' will yield a "coroutine" object!
   *) Re-invoking '(<co-name>)' will return a new "coroutine" object instance!
   *) Hence "<co-name>" should not be called recursively internally, rather use
      the 'named-let' construct in order to perform recursive operations!
+  *) Each coroutine runs on its own native stack ("fiber"), allocated upon its 1st ".next":
+     => Hence "yield" simply switches stacks, rather than capturing a continuation
+     => Hence recursion depth, "jump!", errors, & nested coroutines all behave as
+        they do outside of coroutines
+     => Discarded suspended coroutines are unwound & have their stacks recycled
 
 Coroutine Objects:
-  *) Creation: Either from invoking '(<co-name>)' or "yield" in a coroutine
+  *) Creation: Invoking '(<co-name>)'
   *) 2 Properties, ".value" member & ".next" method:
-     => ".value": yielded value ("#f" if object isn't from a "yield")
+     => ".value": last yielded value ("#f" if the coroutine hasn't yielded yet)
      => ".next": either starts or continues the coroutine's execution
+        -> Returns the coroutine object itself upon a "yield", else the final value
+        -> Coroutines are one-shot: calling ".next" on a finished coroutine is an error!
 
 Associated Special Form:
-  *) (yield <value>): yield a value from the coroutine via a new coroutine object!
+  *) (yield <value>): yield a value from the coroutine by setting its ".value" & suspending it!
      => '(yield)' is equivalent to '(yield #f)', designed for use with "cycle-coroutines"!
+     => Using "yield" outside of a running coroutine is an error!
 
 Danger Zone:
-  0. Nesting "define-coroutine" instances (or use in "scm->cps") is undefined behavior!
-  1. Using "jump!" or "catch-jump" in "define-coroutine" is undefined behavior (used by "yield")!
-  2. The "id" procedure is returned if no expressions exist after the last "yield"!
-  3. Like "scm->cps", avoid runtime-macros/eval/load expanding to a "define" in the current environment!
+  0. "#<void>" is returned if no expressions exist after the last "yield"!
+  1. "call/cc" continuations captured inside a coroutine must only be invoked while
+     that coroutine is running!
 
 Examples:
 
@@ -2605,14 +2635,13 @@ Examples:
     4)
 
   (define cobj (example))
-  (set! cobj (cobj.next)) ; launch coroutine
-  (display cobj.value)    ; 1
-  (set! cobj (cobj.next))
-  (display cobj.value)    ; 2
-  (set! cobj (cobj.next))
-  (display cobj.value)    ; 3
-  (set! cobj (cobj.next)) ; last iteration returns the final value!
-  (display cobj)          ; 4
+  (cobj.next)          ; launch coroutine
+  (display cobj.value) ; 1
+  (cobj.next)
+  (display cobj.value) ; 2
+  (cobj.next)
+  (display cobj.value) ; 3
+  (display (cobj.next)) ; last iteration returns the final value: 4
 )",
 
 
@@ -3292,7 +3321,7 @@ R"(
 )",
 R"(
 Coroutine predicate. Note that coroutines can ONLY be made by 
-"define-coroutine" or as the result of a "yield" expression!
+"define-coroutine"!
 )",
 
 
@@ -3365,6 +3394,45 @@ TAKE HEED: if none of the coroutines ever finish, neither will this procedure!
 
 
 
+}, {
+"set-coroutine-stack-size!",
+"Procedure",
+R"(
+(set-coroutine-stack-size! <positive-integer>)
+)",
+R"(
+Sets the # of bytes of the native stack given to each coroutine launched 
+afterwards by the current thread (rounded up to whole pages, no less than 
+65536), & returns the previous size. Defaults to 8MiB, matching the stack 
+recursion depth available outside of coroutines. Only the pages a coroutine 
+actually touches are committed, but each unfinished coroutine holds its own 
+stack mapping, & the OS caps how many may exist at once.
+
+TAKE HEED: smaller stacks crash the interpreter upon deep recursion inside of
+           coroutines, well before reaching "max-recursion-depth"!
+  *) Check the current size via "coroutine-stack-size".
+)",
+
+
+
+
+
+}, {
+"coroutine-stack-size",
+"Procedure",
+R"(
+(coroutine-stack-size)
+)",
+R"(
+Returns the # of bytes of the native stack given to each coroutine launched
+by the current thread.
+  *) Set the size via "set-coroutine-stack-size!".
+)",
+
+
+
+
+
 }, {
 "stream-length",
 "Procedure",
@@ -3682,6 +3750,22 @@ Form a stream by interleaving elts of either <stream>.
 
 
 
+}, {
+"port->line-stream",
+"Procedure",
+R"(
+(port->line-stream <optional-open-input-port>)
+)",
+R"(
+Form a stream lazily reading the remaining lines of <optional-open-input-port>.
+Lines are only read once their stream elt is reached, hence large inputs may
+be processed line by line.
+)",
+
+
+
+
+
 }, {
 "+",
 "Procedure",
@@ -5563,6 +5647,23 @@ Mutate <string> by pushing <char> to its end.
 
 
 
+}, {
+"string-append!",
+"Procedure",
+R"(
+(string-append! <string> <char-or-string1> <char-or-string2> ...)
+)",
+R"(
+Mutate <string> by appending each <char-or-string> to its end.
+  *) Appending is amortized O(1) per character, hence <string> doubles
+     as an efficient "string builder" for incrementally built output!
+  *) Prefer this to repeatedly reassigning the result of "append"!
+)",
+
+
+
+
+
 }, {
 "string-push-front!",
 "Procedure",
@@ -5778,8 +5879,8 @@ Confirm all left <string>s are greater than or equal to right <string>s (case-in
 "regex-replace",
 "Procedure",
 R"(
-(regex-replace <target-string> <regex-string> <replacement-string>) 
-(regex-replace <target-string> <regex-string> <callable>)
+(regex-replace <target-string> <regex-string> <replacement-string> <optional-engine>) 
+(regex-replace <target-string> <regex-string> <callable> <optional-engine>)
 )",
 R"(
 Replace 1st regex match instance!
@@ -5790,6 +5891,11 @@ See "regex-replace-all" to replace all instances rather than just the first!
 
 Regex's Use ECMAScript Syntax: 
   *) https://www.cplusplus.com/reference/regex/ECMAScript/
+
+Regex Engines: <optional-engine> ::= 'linear | 'backtracking
+  *) Defaults to the engine set by "set-linear-regex!" (initially 'backtracking)
+  *) 'linear matches in linear time w/o recursion (stack-safe on huge strings!)
+  *) 'linear supports all syntax except backreferences & lookaheads
 )",
 
 
@@ -5800,8 +5906,8 @@ Regex's Use ECMAScript Syntax:
 "regex-replace-all",
 "Procedure",
 R"(
-(regex-replace-all <target-string> <regex-string> <replacement-string>) 
-(regex-replace-all <target-string> <regex-string> <callable>)
+(regex-replace-all <target-string> <regex-string> <replacement-string> <optional-engine>) 
+(regex-replace-all <target-string> <regex-string> <callable> <optional-engine>)
 )",
 R"(
 Replace all regex match instances!
@@ -5812,6 +5918,13 @@ See "regex-replace" to replace the 1st instance rather than all of them!
 
 Regex's Use ECMAScript Syntax: 
   *) https://www.cplusplus.com/reference/regex/ECMAScript/
+
+Regex Engines: <optional-engine> ::= 'linear | 'backtracking
+  *) Defaults to the engine set by "set-linear-regex!" (initially 'backtracking)
+  *) 'linear matches in linear time w/o recursion (stack-safe on huge strings!)
+  *) 'linear supports all syntax except backreferences & lookaheads
+  *) Given a <callable>, both engines replace each match of the original
+     string in 1 pass (passing <prefix> & <suffix> from the original string)
 )",
 
 
@@ -5822,7 +5935,7 @@ Regex's Use ECMAScript Syntax:
 "regex-match",
 "Procedure",
 R"(
-(regex-match <target-string> <regex-string>)
+(regex-match <target-string> <regex-string> <optional-engine>)
 )",
 R"(
 Alist of all regex matches!
@@ -5831,6 +5944,11 @@ Alist of all regex matches!
 
 Regex's Use ECMAScript Syntax: 
   *) https://www.cplusplus.com/reference/regex/ECMAScript/
+
+Regex Engines: <optional-engine> ::= 'linear | 'backtracking
+  *) Defaults to the engine set by "set-linear-regex!" (initially 'backtracking)
+  *) 'linear matches in linear time w/o recursion (stack-safe on huge strings!)
+  *) 'linear supports all syntax except backreferences & lookaheads
 )",
 
 
@@ -5841,7 +5959,7 @@ Regex's Use ECMAScript Syntax:
 "regex-split",
 "Procedure",
 R"(
-(regex-split <target-string> <optional-regex-string> <optional-start-index>)
+(regex-split <target-string> <optional-regex-string> <optional-start-index> <optional-engine>)
 )",
 R"(
 Regex split string into a list of substrings!
@@ -5850,6 +5968,11 @@ Regex split string into a list of substrings!
 
 Regex's Use ECMAScript Syntax: 
   *) https://www.cplusplus.com/reference/regex/ECMAScript/
+
+Regex Engines: <optional-engine> ::= 'linear | 'backtracking
+  *) Defaults to the engine set by "set-linear-regex!" (initially 'backtracking)
+  *) 'linear matches in linear time w/o recursion (stack-safe on huge strings!)
+  *) 'linear supports all syntax except backreferences & lookaheads
 )",
 
 
@@ -6451,6 +6574,105 @@ Generate vector of all combinations of objects in <vector>.
 
 
 
+}, {
+"<tag>vector",
+"Procedure",
+R"(
+(<tag>vector <number1> <number2> ...)
+)",
+R"(
+Construct a SRFI-4 homogeneous vector of <number1> <number2> ..., where
+<tag> denotes the element type stored unboxed in a contiguous machine array:
+  *) s8 | s16 | s32 | s64: exact signed integers of the given bit-width
+  *) u8 | u16 | u32 | u64: exact unsigned integers of the given bit-width
+  *) f32 | f64: real numbers stored as 32/64-bit floats
+Hence: (u8vector 1 2 3) ; => #u8(1 2 3)
+
+Homogeneous vectors are supported by "length", "ref", "set-index!", "fill!",
+"map", "map!", "for-each", "fold", "fold-right", "empty", "seq->list", & "seq->vector".
+  *) NOTE: They print as #<tag>(<number1> <number2> ...), but have no reader literal!
+)",
+
+
+
+
+
+}, {
+"make-<tag>vector",
+"Procedure",
+R"(
+(make-<tag>vector <size> <optional-fill-number>)
+)",
+R"(
+Construct a <tag> homogeneous vector of <size> instances of <optional-fill-number>.
+<optional-fill-number> defaults to 0.
+  *) See "<tag>vector" for more details on homogeneous vector tags!
+)",
+
+
+
+
+
+}, {
+"<tag>vector?",
+"Procedure",
+R"(
+(<tag>vector? <obj>)
+)",
+R"(
+Returns whether <obj> is a homogeneous vector w/ <tag> elements.
+  *) See "<tag>vector" for more details on homogeneous vector tags!
+)",
+
+
+
+
+
+}, {
+"vector-><tag>vector",
+"Procedure",
+R"(
+(vector-><tag>vector <vector>)
+)",
+R"(
+Convert <vector> into a <tag> homogeneous vector.
+Throws an error if any element of <vector> isn't a valid <tag> element.
+  *) See "<tag>vector" for more details on homogeneous vector tags!
+)",
+
+
+
+
+
+}, {
+"homogeneous-vector?",
+"Procedure",
+R"(
+(homogeneous-vector? <obj>)
+)",
+R"(
+Returns whether <obj> is a homogeneous vector (of any element type).
+)",
+
+
+
+
+
+}, {
+"homogeneous-vector-type",
+"Procedure",
+R"(
+(homogeneous-vector-type <homogeneous-vector>)
+)",
+R"(
+Returns the element type tag of <homogeneous-vector> as a symbol.
+Hence: (homogeneous-vector-type (f64vector 1.5)) ; => f64
+)",
+
+
+
+
+
 }, {
 "hmap-keys",
 "Procedure",
@@ -6869,6 +7091,71 @@ Apply <callable> to each elt of each <sequence>.
 
 
 
+}, {
+"pmap",
+"Procedure",
+R"(
+(pmap <procedure-datum> <sequence>)
+=> <sequence> ::= <vector> | <homogeneous-vector>
+)",
+R"(
+Parallel "map": splits <sequence> into chunks across "parallel-workers" 
+universes (see "spawn-universe"), each running on its own persistent thread 
+(& reset per call). Idle workers steal chunks from busy ones, and results keep 
+<sequence>'s order.
+  *) <procedure-datum> is evaluated in each worker universe (w/ Heist's 
+     default bindings), hence must not depend on the caller's definitions!
+  *) Vectors are copied to workers via FASL serialization, whereas homogeneous 
+     vectors are shared directly (yielding a homogeneous vector of the same type).
+  *) Best suited for pure per-element computations over large sequences.
+
+Example:
+  (pmap '(lambda (x) (* x x)) #(1 2 3 4)) ; #(1 4 9 16)
+)",
+
+
+
+
+
+}, {
+"pfor-each",
+"Procedure",
+R"(
+(pfor-each <procedure-datum> <sequence>)
+=> <sequence> ::= <vector> | <homogeneous-vector>
+)",
+R"(
+Parallel "for-each": applies <procedure-datum> to each elt of <sequence> across
+"parallel-workers" universes (see "pmap"), in no particular order.
+  *) Side effects happen in the worker universes: use channels to send back data!
+)",
+
+
+
+
+
+}, {
+"preduce",
+"Procedure",
+R"(
+(preduce <associative-procedure-datum> <seed> <sequence>)
+=> <sequence> ::= <vector> | <homogeneous-vector>
+)",
+R"(
+Parallel "fold": folds each chunk of <sequence> across "parallel-workers" 
+universes (see "pmap"), then folds the chunks' results in order.
+  *) The 1st chunk starts from <seed>, and the others from their 1st element,
+     hence equals (fold <procedure> <seed> <sequence>) for associative procedures!
+  *) Returns <seed> if <sequence> is empty.
+
+Example:
+  (preduce '+ 0 (f64vector 1 2 3 4)) ; 10.0
+)",
+
+
+
+
+
 }, {
 "seq-copy!",
 "Procedure",
@@ -7507,8 +7794,11 @@ R"(
 => <sequence> ::= <list> | <vector> | <string>
 )",
 R"(
-Copy of <sequence> sorted based on <predicate?>.
+Copy of <sequence> stably sorted based on <predicate?>.
   *) See "sort!" for a mutative equivalent affecting <sequence>.
+  *) Sorting by the <, >, string<?, string>?, char<?, or char>? primitives 
+     compares elements natively (w/o applying <predicate?>), & large
+     sequences are sorted across multiple threads.
 )",
 
 
@@ -7523,8 +7813,9 @@ R"(
 => <sequence> ::= <list> | <vector> | <string>
 )",
 R"(
-In-place sort (based on <predicate?>) mutating <sequence>.
+In-place stable sort (based on <predicate?>) mutating <sequence>.
   *) See "sort" for a non-mutating equivalent.
+  *) Lists are sorted by reassigning the cars of their pairs.
 )",
 
 
@@ -9203,6 +9494,7 @@ R"(
 )",
 R"(
 Read the next line of input into a string.
+Returns #!eof if <optional-open-input-port-or-string> has no more lines.
 )",
 
 
@@ -9741,6 +10033,64 @@ Close the given port. Works on both input & output ports.
 
 
 
+}, {
+"open-input-string",
+"Procedure",
+R"(
+(open-input-string <string>)
+)",
+R"(
+Generate an in-memory input port reading from a copy of <string>.
+Unlike passing <string> to input procedures, <string> is never consumed.
+)",
+
+
+
+
+
+
+}, {
+"flush-output-port",
+"Procedure",
+R"(
+(flush-output-port <optional-open-output-port>)
+)",
+R"(
+Write out any output buffered by <optional-open-output-port>.
+  *) <optional-open-output-port> defaults to the current output port.
+  *) See "set-port-buffering!" for when ports buffer their output.
+)",
+
+
+
+
+
+}, {
+"set-port-buffering!",
+"Procedure",
+R"(
+(set-port-buffering! <open-output-port> <mode-symbol>)
+)",
+R"(
+Set how <open-output-port> buffers its output, per <mode-symbol>:
+  *) none:  write output immediately
+  *) line:  write output upon each newline
+  *) block: write output upon filling the port's buffer
+
+File ports default to "block", & stdout defaults to "none".
+  *) Set a file port's buffering before writing to it: changing the
+     buffering of a port already written to is undefined behavior in C.
+  *) Stdout's mode is shared by every universe. "line" & "block" just stop
+     flushing stdout after each write, leaving it to its C stdio buffer
+     (line-buffered on terminals, else block-buffered).
+  *) Closing a port (or exiting) writes its buffered output.
+  *) Use "flush-output-port" to write buffered output early.
+)",
+
+
+
+
+
 }, {
 "load",
 "Procedure",
@@ -9871,9 +10221,11 @@ R"(
 )",
 R"(
 Compile the given Heist Scheme file.
-  *) This really just pre-parses the AST into C++ expressions.
+  *) Pre-parses the AST into C++ expressions, w/ its core-syntax expanded.
+     => Core-syntax (like "let" & "cond") is expanded wrt the default global 
+        environment, save labels (re)defined by the compiled file itself.
   *) The interpreter is still linked to evaluate the C++ AST.
-  *) Enables producing a binary of scheme code for slightly faster eval.
+  *) Enables producing a binary of scheme code for faster launches.
   *) See "cps-compile" for a CPS-compilation alternative!
 
 Reader changes with compilation:
@@ -9895,9 +10247,10 @@ R"(
 R"(
 Compile the given Heist Scheme file, & wrap its contents in a single 
 large "scm->cps" block with "id" as the topmost continuation.
-  *) This really just pre-parses the AST into C++ expressions.
+  *) Pre-parses the AST into C++ expressions, already converted to CPS.
+     => Hence the compiled binary skips the "scm->cps" conversion on launch.
   *) The interpreter is still linked to evaluate the C++ AST.
-  *) Enables producing a binary of scheme code for slightly faster eval.
+  *) Enables producing a binary of scheme code for faster launches.
   *) See "compile" for a non-CPS-compilation alternative!
 
 Reader changes with cps-compilation:
@@ -10064,6 +10417,38 @@ Check max recursion depth.
 
 
 
+}, {
+"set-parallel-workers!",
+"Procedure",
+R"(
+(set-parallel-workers! <positive-integer>)
+)",
+R"(
+Set the # of worker universes used by "pmap", "pfor-each", & "preduce".
+  *) Defaults to the # of hardware threads.
+  *) Check the current # of workers via "parallel-workers".
+  *) Returns the last value that served this role!
+)",
+
+
+
+
+
+}, {
+"parallel-workers",
+"Procedure",
+R"(
+(parallel-workers)
+)",
+R"(
+Check the # of worker universes used by "pmap", "pfor-each", & "preduce".
+  *) Set the current # of workers via "set-parallel-workers!".
+)",
+
+
+
+
+
 }, {
 "set-repl-prompt!",
 "Procedure",
@@ -10157,6 +10542,38 @@ Check status as to whether dynamically tracing procedure arguments in the call s
 
 
 
+}, {
+"set-linear-regex!",
+"Procedure",
+R"(
+(set-linear-regex! <boolean>)
+)",
+R"(
+Set status as to whether regex primitives default to the linear-time engine. 
+  *) Check current status via "linear-regex?".
+  *) Returns the last value that served this role!
+  *) Overridable per call by passing 'linear or 'backtracking as the last arg.
+)",
+
+
+
+
+
+}, {
+"linear-regex?",
+"Procedure",
+R"(
+(linear-regex?)
+)",
+R"(
+Check status as to whether regex primitives default to the linear-time engine.
+  *) Set current status via "set-linear-regex!".
+)",
+
+
+
+
+
 }, {
 "set-dot!",
 "Procedure",
@@ -10405,6 +10822,7 @@ R"(
 Apply <callable> on <arg1> ... <argN>, catching any "jump!"ed values
   *) "jump!"ed values & regular returns from <callable> are indistinguishable.
   *) Jump values via the "jump!" procedure.
+  *) Jumping in a tail call of <callable> simply returns (w/o unwinding the stack)!
 )",
 
 
@@ -10412,15 +10830,29 @@ Apply <callable> on <arg1> ... <argN>, catching any "jump!"ed values
 
 
 }, {
-"trace",
+"call/ec",
 "Procedure",
 R"(
-(trace <procedure> <arg1> ... <argN>)
+(call/ec <unary-callable>)
+(call-with-escape-continuation <unary-callable>)
 )",
 R"(
-Trace the application of <procedure> on <arg1> ... <argN>.
-  *) Prints the arguments, return value, and recursive depth of each stack frame.
-  *) Avoid I/O in traced procedures for clearer results!
+Apply <unary-callable> to an escape continuation "k", where '(k <optional-arg>)'
+immediately returns <optional-arg> from the "call/ec" application.
+  *) <optional-arg> defaults to '(void)'
+  *) Escape continuations are one-shot & upward-only: invoking "k" after its
+     "call/ec" application returned is an error!
+  *) Unlike "call/cc", works outside of "scm->cps" blocks!
+  *) Escaping in a tail call of <unary-callable> simply returns (w/o unwinding 
+     the stack), making early exits from named-let loops cheap!
+  *) See "let/ec" for a more concise syntax!
+
+Example:
+  (define (find-first pred? lis)
+    (call/ec 
+      (lambda (return)
+        (for-each (lambda (x) (if (pred? x) (return x))) lis)
+        #f)))
 )",
 
 
@@ -10428,16 +10860,56 @@ Trace the application of <procedure> on <arg1> ... <argN>.
 
 
 }, {
-"gensym",
-"Procedure",
+"let/ec",
+"Macro",
 R"(
-(gensym <optional-instance-#-to-reference>)
+(let/ec <escape-symbol> <body> ...)
 )",
 R"(
-Generate a unique symbol.
-  *) (gensym 1) refers to the symbol generated by the last (gensym) invocation
-  *) (gensym 2) refers to the symbol generated by the 2nd to last (gensym) invocation
-  *) etc.
+Bind <escape-symbol> to an escape continuation w/in <body> ...
+  *) Equivalent to '(call/ec (lambda (<escape-symbol>) <body> ...))'
+  *) See "call/ec" for more details!
+
+Example:
+  (define (find-first pred? lis)
+    (let/ec return
+      (let loop ((lis lis))
+        (cond ((null? lis) #f)
+              ((pred? (car lis)) (return (car lis)))
+              (else (loop (cdr lis)))))))
+)",
+
+
+
+
+
+}, {
+"trace",
+"Procedure",
+R"(
+(trace <procedure> <arg1> ... <argN>)
+)",
+R"(
+Trace the application of <procedure> on <arg1> ... <argN>.
+  *) Prints the arguments, return value, and recursive depth of each stack frame.
+  *) Avoid I/O in traced procedures for clearer results!
+)",
+
+
+
+
+
+}, {
+"gensym",
+"Procedure",
+R"(
+(gensym <optional-instance-#-to-reference>)
+)",
+R"(
+Generate a unique symbol.
+  *) (gensym 1) refers to the symbol generated by the last (gensym) invocation
+  *) (gensym 2) refers to the symbol generated by the 2nd to last (gensym) invocation
+  *) etc.
 )",
 
 
@@ -10721,6 +11193,8 @@ Convert JSON string to a Heist Scheme datum.
   *) arrays -> vectors
   *) null -> '()
   *) maps -> alists (of key-value lists)
+  *) "\uXXXX" escapes -> UTF-8 chars
+Throws an error if <string> isn't exactly 1 valid JSON value.
 )",
 
 
@@ -10739,6 +11213,7 @@ Convert Scheme datum to a JSON string.
              | <number>
              | <'()>    ; -> <null>
              | <alist>  ; -> <map> (keys must be string | number | null | bool!)
+             | <hmap>   ; -> <map>
              | <vector> ; -> <array>
              | <boolean>
 )",
@@ -10747,6 +11222,23 @@ Convert Scheme datum to a JSON string.
 
 
 
+}, {
+"write-json",
+"Procedure",
+R"(
+(write-json <obj> <optional-open-output-port> <optional-indent-width>)
+)",
+R"(
+Write Scheme datum as JSON to <optional-open-output-port>.
+JSON is streamed to the port as it is generated, rather than first being
+built as a single string. Accepts the same <obj> as "scm->json".
+<optional-open-output-port> defaults to (current-output-port).
+)",
+
+
+
+
+
 }, {
 "object->json",
 "Procedure",
@@ -10784,10 +11276,14 @@ R"(
 )",
 R"(
 Convert CSV string to a list of lists of numbers/strings.
+  *) Quoted fields become strings, columns whose fields are all unquoted 
+     decimals/floats (IE "-12", "3.5", "1e3") become numbers, & other 
+     fields become strings (per RFC-4180)
   *) <optional-delimiter-char> defaults to #\,
 
 Other CSV procedures include: 
-  "csv->vector", "list->csv", "vector->csv", & "csv-datum?"
+  "csv->vector", "list->csv", "vector->csv", "csv-datum?",
+  "csv->alists", "read-csv-row", & "port->csv-stream"
 )",
 
 
@@ -10802,10 +11298,14 @@ R"(
 )",
 R"(
 Convert CSV string to a vector of vectors of numbers/strings.
+  *) Quoted fields become strings, columns whose fields are all unquoted 
+     decimals/floats (IE "-12", "3.5", "1e3") become numbers, & other 
+     fields become strings (per RFC-4180)
   *) <optional-delimiter-char> defaults to #\,
 
 Other CSV procedures include: 
-  "csv->list", "list->csv", "vector->csv", & "csv-datum?"
+  "csv->list", "list->csv", "vector->csv", "csv-datum?",
+  "csv->alists", "read-csv-row", & "port->csv-stream"
 )",
 
 
@@ -10824,7 +11324,8 @@ Convert list of lists of <csv-data> to a CSV string.
   *) <optional-delimiter-char> defaults to #\,
 
 Other CSV procedures include: 
-  "csv->list", "csv->vector", "vector->csv", & "csv-datum?"
+  "csv->list", "csv->vector", "vector->csv", "csv-datum?",
+  "csv->alists", "read-csv-row", & "port->csv-stream"
 )",
 
 
@@ -10843,7 +11344,8 @@ Convert vector of vectors of <csv-data> to a CSV string.
   *) <optional-delimiter-char> defaults to #\,
 
 Other CSV procedures include: 
-  "csv->list", "csv->vector", "list->csv", & "csv-datum?"
+  "csv->list", "csv->vector", "list->csv", "csv-datum?",
+  "csv->alists", "read-csv-row", & "port->csv-stream"
 )",
 
 
@@ -10861,7 +11363,365 @@ Return whether <obj> is a valid CSV datum candidate.
   *) Effectively returns whether "list->csv" or "vector->csv" would trigger an error or not.
 
 Other CSV procedures include: 
-  "csv->vector", "csv->list", "list->csv", & "vector->csv"
+  "csv->vector", "csv->list", "list->csv", "vector->csv",
+  "csv->alists", "read-csv-row", & "port->csv-stream"
+)",
+
+
+
+
+
+}, {
+"csv->alists",
+"Procedure",
+R"(
+(csv->alists <string> <optional-delimiter-char>)
+)",
+R"(
+Convert CSV string with a header row to a list of alists (of key-value lists).
+  *) Each row's alist is keyed by the header row's fields (always strings)
+  *) Columns whose fields are all unquoted decimals/floats become numbers
+  *) <optional-delimiter-char> defaults to #\,
+
+Other CSV procedures include: 
+  "csv->list", "csv->vector", "list->csv", "vector->csv", "csv-datum?",
+  "read-csv-row", & "port->csv-stream"
+)",
+
+
+
+
+
+}, {
+"read-csv-row",
+"Procedure",
+R"(
+(read-csv-row <optional-open-input-port> <optional-delimiter-char>)
+)",
+R"(
+Read the next CSV row of <optional-open-input-port> as a list of numbers/strings.
+Returns #!eof if <optional-open-input-port> has no more rows.
+  *) Unquoted decimal/float fields (IE "-12", "3.5", "1e3") become numbers:
+     as rows are read 1 at a time, fields are typed individually
+  *) <optional-delimiter-char> defaults to #\,
+
+Other CSV procedures include: 
+  "csv->list", "csv->vector", "list->csv", "vector->csv", "csv-datum?",
+  "csv->alists", & "port->csv-stream"
+)",
+
+
+
+
+
+}, {
+"port->csv-stream",
+"Procedure",
+R"(
+(port->csv-stream <optional-open-input-port> <optional-delimiter-char>)
+)",
+R"(
+Form a stream lazily reading the remaining CSV rows of <optional-open-input-port>.
+Rows are only read once their stream elt is reached, hence large CSV files may
+be processed row by row.
+  *) <optional-delimiter-char> defaults to #\,
+
+Other CSV procedures include: 
+  "csv->list", "csv->vector", "list->csv", "vector->csv", "csv-datum?",
+  "csv->alists", & "read-csv-row"
+)",
+
+
+
+
+
+}, {
+"fasl-write",
+"Procedure",
+R"(
+(fasl-write <obj> <optional-open-output-port>)
+)",
+R"(
+Write <obj> to <optional-open-output-port> in Heist's binary "fasl" format.
+Shared structure & cycles are preserved when read back by "fasl-read".
+  *) <obj> ::= <pair> | <vector> | <string> | <symbol> | <number> | <char>
+             | <boolean> | <hmap> | <homogeneous-vector> | <void>
+  *) <optional-open-output-port> defaults to (current-output-port)
+)",
+
+
+
+
+
+}, {
+"fasl-read",
+"Procedure",
+R"(
+(fasl-read <optional-open-input-port>)
+)",
+R"(
+Read the next datum written by "fasl-write" from <optional-open-input-port>.
+Returns #!eof if <optional-open-input-port> has no more data.
+  *) <optional-open-input-port> defaults to (current-input-port)
+)",
+
+
+
+}, {
+"async",
+"Procedure",
+R"(
+(async <coroutine-object-or-thunk>)
+)",
+R"(
+Run <coroutine-object-or-thunk> as an event loop "task", returning an 
+"async-operation" that resolves to its result.
+  *) "await"ing in a task only suspends the task's coroutine, letting the
+     event loop run other tasks (& I/O) in the meantime!
+  *) "yield"ing in a task lets the other ready tasks run before resuming it.
+  *) Tasks start running once the event loop runs (see "await").
+
+Example:
+  (define (worker name ms)
+    (lambda () (await (sleep-async ms)) name))
+  (define a (async (worker 'a 20)))
+  (define b (async (worker 'b 10)))
+  (list (await a) (await b)) ; (a b), after ~20ms total
+)",
+
+
+
+
+
+}, {
+"await",
+"Procedure",
+R"(
+(await <async-operation>)
+)",
+R"(
+Returns the result of <async-operation> once it completes, triggering an
+error if it failed (eg its task raised an error, or its connection failed).
+  *) In an "async" task: suspends the task until <async-operation> completes.
+  *) Elsewhere: runs the event loop until <async-operation> completes.
+  *) Triggers an error if no pending tasks, I/O, nor timers remain which
+     could ever complete <async-operation>.
+)",
+
+
+
+
+
+}, {
+"async-done?",
+"Procedure",
+R"(
+(async-done? <async-operation>)
+)",
+R"(
+Returns whether <async-operation> completed (or failed).
+)",
+
+
+
+
+
+}, {
+"run-event-loop",
+"Procedure",
+R"(
+(run-event-loop)
+)",
+R"(
+Runs the event loop's tasks, I/O, and timers until none remain pending.
+)",
+
+
+
+
+
+}, {
+"sleep-async",
+"Procedure",
+R"(
+(sleep-async <non-negative-milliseconds>)
+)",
+R"(
+Returns an "async-operation" that completes after <non-negative-milliseconds>.
+)",
+
+
+
+
+
+}, {
+"read-line-async",
+"Procedure",
+R"(
+(read-line-async <optional-open-input-port>)
+)",
+R"(
+Returns an "async-operation" resolving to the next line of 
+<optional-open-input-port> (or #!eof if it has no more data).
+  *) <optional-open-input-port> defaults to (current-input-port)
+  *) Reads via the port's own buffer, hence may be mixed w/ "read-line" & co.
+)",
+
+
+
+
+
+}, {
+"read-char-async",
+"Procedure",
+R"(
+(read-char-async <optional-open-input-port>)
+)",
+R"(
+Returns an "async-operation" resolving to the next char of 
+<optional-open-input-port> (or #!eof if it has no more data).
+  *) <optional-open-input-port> defaults to (current-input-port)
+)",
+
+
+
+
+
+}, {
+"display-async",
+"Procedure",
+R"(
+(display-async <obj> <optional-open-output-port>)
+)",
+R"(
+Returns an "async-operation" that completes once <obj> has been displayed 
+to <optional-open-output-port>.
+  *) <optional-open-output-port> defaults to (current-output-port)
+  *) Flushes <optional-open-output-port> first, preserving prior writes' order.
+)",
+
+
+
+
+
+}, {
+"run-process-async",
+"Procedure",
+R"(
+(run-process-async <command-string>)
+)",
+R"(
+Runs <command-string> via "/bin/sh" w/ its stdout piped, returning an 
+"async-operation" that resolves to (cons <exit-code> <stdout-string>).
+
+Example:
+  (await (run-process-async "echo hi")) ; (0 . "hi\n")
+)",
+
+
+
+
+
+}, {
+"open-tcp-listener",
+"Procedure",
+R"(
+(open-tcp-listener <port-number> <optional-host-string>)
+)",
+R"(
+Returns a "socket-listener" listening on <port-number> of <optional-host-string>.
+  *) <optional-host-string> defaults to "127.0.0.1" (loopback)
+  *) Port 0 binds an ephemeral port: get it via "listener-port"!
+)",
+
+
+
+
+
+}, {
+"open-unix-listener",
+"Procedure",
+R"(
+(open-unix-listener <socket-path-string>)
+)",
+R"(
+Returns a "socket-listener" listening on the unix socket <socket-path-string>.
+)",
+
+
+
+
+
+}, {
+"listener-port",
+"Procedure",
+R"(
+(listener-port <socket-listener>)
+)",
+R"(
+Returns the port number of <socket-listener> (its path for unix sockets).
+)",
+
+
+
+
+
+}, {
+"close-listener!",
+"Procedure",
+R"(
+(close-listener! <socket-listener>)
+)",
+R"(
+Close <socket-listener>, failing its pending "accept-async" operations.
+  *) Also removes unix socket listeners' socket file.
+)",
+
+
+
+
+
+}, {
+"accept-async",
+"Procedure",
+R"(
+(accept-async <socket-listener>)
+)",
+R"(
+Returns an "async-operation" resolving to the next connection of 
+<socket-listener>, as (cons <input-port> <output-port>).
+  *) The connection stays open until both ports are closed.
+)",
+
+
+
+
+
+}, {
+"connect-tcp-async",
+"Procedure",
+R"(
+(connect-tcp-async <host-string> <port-number>)
+)",
+R"(
+Returns an "async-operation" resolving to a connection to <host-string>'s 
+<port-number>, as (cons <input-port> <output-port>).
+  *) NOTE: resolving host names (rather than numeric addresses) blocks!
+)",
+
+
+
+
+
+}, {
+"connect-unix-async",
+"Procedure",
+R"(
+(connect-unix-async <socket-path-string>)
+)",
+R"(
+Returns an "async-operation" resolving to a connection to the unix socket
+<socket-path-string>, as (cons <input-port> <output-port>).
 )",
 
 
@@ -11470,9 +12330,9 @@ Class-prototype for objects generated by "define-coroutine".
 Has 1 member & 1 method:
   
   <coro-obj>.value  ; current yielded value (#f by default)
-  (<coro-obj>.next) ; reinvoke the next iteration of the coroutine:
-                    ;   returns a new coroutine object if "yield" is
-                    ;   invoked again, OR the final return value of the coro
+  (<coro-obj>.next) ; resume the coroutine on its fiber until it yields:
+                    ;   returns <coro-obj> (w/ an updated ".value") if "yield"
+                    ;   is invoked again, OR the final return value of the coro
 
 Used in conjunction with the following procedures:
   
@@ -11528,14 +12388,13 @@ Examples:
     4)
 
   (define cobj (example))
-  (set! cobj (cobj.next)) ; launch coroutine
-  (display cobj.value)    ; 1
-  (set! cobj (cobj.next))
-  (display cobj.value)    ; 2
-  (set! cobj (cobj.next))
-  (display cobj.value)    ; 3
-  (set! cobj (cobj.next)) ; last iteration returns the final value!
-  (display cobj)          ; 4
+  (cobj.next)          ; launch coroutine
+  (display cobj.value) ; 1
+  (cobj.next)
+  (display cobj.value) ; 2
+  (cobj.next)
+  (display cobj.value) ; 3
+  (display (cobj.next)) ; last iteration returns the final value: 4
 )",
 
 
@@ -11555,6 +12414,10 @@ Class-prototype for objects generated by "new-universe".
   0. "new-universe": 
      Returns a "universe" object, initialized with Heist's default bindings,
      which enables evaluation in a persistent sandboxed environment.
+     => Universes on the same thread share a frozen, copy-on-write snapshot
+        of Heist's booted global environment (booted once), hence are cheap!
+     => Mutating a shared default value in-place (e.g. "proto-add-property!"
+        on a default class) is visible to every universe on the thread.
   1. "universe?":
      Universe object predicate.
 
@@ -11570,6 +12433,120 @@ Example:
   (world.eval '(set-dot! ':))
   (write (dot))               ; #\. (Still has default dot!)
   (world.eval '(write (dot))) ; #\: (Sandboxed env maintains unique dot!)
+
+Spawned Universes:
+  (spawn-universe <procedure-datum> <argument> ...)
+
+  Evaluates <procedure-datum> in a new universe running on its own thread, 
+  then applies the resulting procedure to copies of <argument> ....
+  Returns a "channel" object that will receive the application's result, 
+  and is closed once the spawned universe finishes.
+
+  => Universes never share data: <procedure-datum> is evaluated (rather than 
+     passed as a closure), and <argument> ... & the result are copied via 
+     FASL serialization, hence can't be procedures, ports, or environments.
+     Channels CAN be passed, and are how spawned universes communicate!
+  => Errors and "exit" calls in a spawned universe only end that universe.
+  => The process waits for all spawned universes to finish before exiting.
+
+  (define c (spawn-universe '(lambda (n) (* n n)) 12))
+  (c.get) ; 144
+  (c.get) ; #<eof> (closed once the spawned universe finished)
+)",
+
+
+/******************************************************************************
+* CHANNEL TOPIC DESCRIPTION @NEW-SECTION
+******************************************************************************/
+
+
+}, {
+"channel",
+"Class Prototype",
+R"()",
+R"(
+Class-prototype for thread-safe FIFO message queues between universes, 
+generated by "make-channel" and "spawn-universe". 
+
+Messages are copied via FASL serialization, hence can't be procedures, ports,
+or environments (though they CAN contain other channels).
+
+6 associated procedures:
+  0. (make-channel)             ; Returns a new, open channel
+  1. (channel-put! <chan> <obj>); Send a copy of <obj> (errors if <chan> is closed)
+  2. (channel-get <chan>)       ; Blocks until a message is ready, returning #<eof> 
+                                ;   once <chan> is closed & empty
+  3. (channel-ready? <chan>)    ; Whether "channel-get" won't block
+  4. (channel-close! <chan>)    ; Close <chan> (pending messages may still be got)
+  5. (spawn-universe <procedure-datum> <argument> ...) ; See "universe"
+
+4 methods:
+  0. (<chan>.put! <obj>)
+  1. (<chan>.get)
+  2. (<chan>.ready?)
+  3. (<chan>.close!)
+
+Example:
+  (define jobs (make-channel))
+  (define done 
+    (spawn-universe 
+      '(lambda (jobs) 
+        (let loop ((job (jobs.get)) (sum 0))
+          (if (eof-object? job) sum (loop (jobs.get) (+ sum job)))))
+      jobs))
+  (for-each jobs.put! '(1 2 3 4))
+  (jobs.close!)
+  (done.get) ; 10
+)",
+
+
+
+/******************************************************************************
+* ASYNC-OPERATION TOPIC DESCRIPTION @NEW-SECTION
+******************************************************************************/
+
+
+}, {
+"async-operation",
+"Class Prototype",
+R"()",
+R"(
+Class-prototype for the results of asynchronous procedures (see the "eventloop" 
+procedures menu), resolved into their results via "await".
+
+Each thread has its own event loop (epoll-based on Linux, else "poll"-based),
+which runs "async" tasks (coroutines), I/O, & timers.
+
+2 methods:
+  0. (<async-op>.await) ; See "await"
+  1. (<async-op>.done?) ; See "async-done?"
+
+Example:
+  (define-coroutine (fetch cmd) 
+    (cdr (await (run-process-async cmd))))
+  (define a (async (fetch "sleep 1; echo a")))
+  (define b (async (fetch "sleep 1; echo b")))
+  (list (await a) (await b)) ; ("a\n" "b\n"), after ~1s total
+)",
+
+
+/******************************************************************************
+* SOCKET-LISTENER TOPIC DESCRIPTION @NEW-SECTION
+******************************************************************************/
+
+
+}, {
+"socket-listener",
+"Class Prototype",
+R"()",
+R"(
+Class-prototype for listening sockets, generated by "open-tcp-listener" and 
+"open-unix-listener".
+
+3 methods:
+  0. (<listener>.accept) ; See "accept-async"
+  1. (<listener>.port)   ; See "listener-port"
+  2. (<listener>.close!) ; See "close-listener!"
 )",
 
 
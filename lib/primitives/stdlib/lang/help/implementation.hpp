@@ -100,6 +100,19 @@ namespace heist::stdlib_help {
     }
 
 
+    // Replaces the SRFI-4 <tag> in homogeneous vector procedure names (ie "make-u8vector" -> "make-<tag>vector")
+    bool replace_hvector_tag(string& query)noexcept{
+      for(const auto tag_name : HVECTOR_TAG_NAMES) {
+        const auto pos = query.find(string(tag_name) + "vector");
+        if(pos != string::npos && (!pos || query[pos-1] == '-' || query[pos-1] == '>')) {
+          query.replace(pos,strlen(tag_name),"<tag>");
+          return true;
+        }
+      }
+      return false;
+    }
+
+
     void prepare_query(string& query)noexcept{
       // mk query lower-case
       for(auto& ch : query) ch = scm_numeric::mklower(ch);
@@ -225,8 +238,12 @@ namespace heist::stdlib_help {
         query = "license";
       else if(query == "associative-list" || query == "association-list") 
         query = "alist";
-      else if(query == "universes" || query == "new-universe" || query == "universe?" || query == "universe-eval") 
+      else if(query == "universes" || query == "new-universe" || query == "universe?" || query == "universe-eval" ||
+              query == "spawn-universe") 
         query = "universe";
+      else if(query == "channels" || query == "make-channel" || query == "channel-put!" || query == "channel-get" || 
+              query == "channel-ready?" || query == "channel-close!") 
+        query = "channel";
       else if(query == "\\") 
         query = "lambda";
       else if(query == "*dot" || query == "dot*") 
@@ -243,6 +260,8 @@ namespace heist::stdlib_help {
         query = "scaar ... scddddr";
       else if(is_car_cdr_composition(query) || query == "caar...cddddr")
         query = "caar ... cddddr";
+      else
+        replace_hvector_tag(query);
     }
 
 
@@ -276,7 +295,8 @@ namespace heist::stdlib_help {
         "global-environment","global-env","argc","argv","heist-platform","platform","heist-exact-platform","exact-platform","heist-dirname","exit-success",
         "exit-failure","o","e","pi","phi","euler","+inf","inf","inf.0","-inf","-nan.0","nan.0","nan","+nan","-nan","seq","coro","expr","sym","str","hash-map",
         "hashmap","heist-interop","heist-cpp-interop","heist-c++-interop","cpp-interop","c++-interop","heist-cpp","heist-c++","heist_cpp_interop","cpp_interop",
-        "interop","readme","install","embed","extend","license.md","associative-list","association-list","universes","new-universe","universe?","universe-eval","\\",
+        "interop","readme","install","embed","extend","license.md","associative-list","association-list","universes","new-universe","universe?","universe-eval","spawn-universe","channels","parallel",
+        "make-channel","channel-put!","channel-get","channel-ready?","channel-close!","\\",
         "*dot","dot*","truthiness","docs","def","diamondwand","diamond-wand","diamond","wand","<>","scaar","scadr","scdar","scddr","scaaar","scaadr","scadar",
         "scaddr","scdaar","scdadr","scddar","scdddr","scaaaar","scaaadr","scaadar","scaaddr","scadaar","scadadr","scaddar","scadddr","scdaaar","scdaadr","scdadar",
         "scdaddr","scddaar","scddadr","scdddar","scddddr","scaar...scddddr","caar","cadr","cdar","cddr","caaar","caadr","cadar","caddr","cdaar","cdadr","cddar","cdddr",
@@ -53,6 +53,15 @@ namespace heist {
     return num_type(G.MAX_RECURSION_DEPTH);
   }
 
+  data primitive_SET_PARALLEL_WORKERS_BANG(data_vector&& args) {
+    return stdlib_invariants::primitive_TOGGLE_NUMERIC_SETTING(args,"set-parallel-workers!",G.PARALLEL_WORKERS);
+  }
+
+  data primitive_PARALLEL_WORKERS(data_vector&& args) {
+    stdlib_invariants::confirm_no_args_given(args,"parallel-workers");
+    return num_type(G.PARALLEL_WORKERS);
+  }
+
   // Changes the REPL's line-by-line prompt from the default "> "
   data primitive_SET_REPL_PROMPT_BANG(data_vector&& args) {
     if(args.size() != 1)
@@ -96,6 +105,16 @@ namespace heist {
     return boolean(G.TRACE_ARGS);
   }
 
+  // Toggles the default regex engine (returns whether it was linear prior toggle)
+  data primitive_SET_LINEAR_REGEX_BANG(data_vector&& args) {
+    return stdlib_invariants::primitive_TOGGLE_BOOLEAN_SETTING(args,"set-linear-regex!",G.USING_LINEAR_REGEX_ENGINE);
+  }
+
+  data primitive_LINEAR_REGEXP(data_vector&& args) {
+    stdlib_invariants::confirm_no_args_given(args,"linear-regex?");
+    return boolean(G.USING_LINEAR_REGEX_ENGINE);
+  }
+
   data primitive_SET_DOT_BANG(data_vector&& args) {
     if(args.size() != 1 || !args[0].is_type(types::sym))
       HEIST_THROW_ERR("'set-dot! didn't receive 1 symbol!"
@@ -802,49 +802,46 @@
 (set! call/ce (lexical-scope->dynamic-scope call/ce))
 (define call-with-current-environment call/ce)
 
+;; ===============================
+;; =========== CALL/EC ===========
+;; ===============================
+
+; ESCAPE CONTINUATIONS (ONE-SHOT & UPWARD-ONLY, HENCE WORK OUTSIDE OF scm->cps BLOCKS)
+(define call-with-escape-continuation call/ec)
+
+(core-syntax let/ec
+  (syntax-rules ()
+    ((_ k body ...) (call/ec (lambda (k) body ...)))))
+
 ;; ==================================
 ;; =========== COROUTINES ===========
 ;; ==================================
 
-;; Define a call/cc equivalent for coroutines
-(define (heist:core:pass-continuation-co-call/cc f k) (heist:core:apply-with-continuation f k k))
-
-
+;; Each coroutine runs on its own fiber (native stack), launched by its 1st ".next"
 (defclass coroutine ()
-  (value #f) ; access yielded value
-  ((next)    ; continue/start coroutine
-    (if self.coroutine:private:cont                                          ; if started coroutine
-        (heist:core:apply-with-continuation self.coroutine:private:cont id)  ;   continue execution
-        (self.coroutine:private:launch)))                                    ; else launch coroutine
+  (value #f)                                  ; access yielded value
+  ((next) (heist:core:coroutine:next self))   ; continue/start coroutine
   ((self->type) 'coroutine)
   ((self->string) (append "#<coroutine[" (pointer-address self) "]>"))
-  (coroutine:private:cont #f)    ; IGNORE: USED INTERNALLY
-  (coroutine:private:launch #f)) ; IGNORE: USED INTERNALLY
+  (coroutine:private:fiber #f)) ; IGNORE: USED INTERNALLY
 
 
 (core-syntax yield 
-  (syntax-rules () ; ONLY DESIGNED TO BE USED IN define-coroutine BODIES
-    ((_ val)
-      (heist:core:pass-continuation-co-call/cc
-        (lambda (k)
-          (jump! (new-coroutine (vector val (lambda () (catch-jump k id))))))))
-    ((_)
-      (heist:core:pass-continuation-co-call/cc
-        (lambda (k)
-          (jump! (new-coroutine (vector #f (lambda () (catch-jump k id))))))))))
-
-
-;; NESTING define-coroutine CAUSES UNDEFINED BEHAVIOR
-;; LAST RETURNED VALUE IS "#<procedure id>" IF THE LAST EXPRESSION YIELDS
-;; -> IE if last expr yeilds, calling .next that result will return #<procedure id>
+  (syntax-rules () ; ONLY DESIGNED TO BE USED WHILE RUNNING A COROUTINE
+    ((_ val) (heist:core:coroutine:yield val))
+    ((_) (heist:core:coroutine:yield #f))))
+
+
+;; YIELDING UPDATES THE COROUTINE OBJECT'S ".value" IN-PLACE, & RETURNS THE OBJECT
+;; LAST RETURNED VALUE IS "#<void>" IF THE LAST EXPRESSION YIELDS
 (core-syntax define-coroutine 
   (syntax-rules () 
     ((_ (co-name) body ...)
       (define (co-name)
-        (new-coroutine (vector #f #f (lambda () (catch-jump (scm->cps body ...) id))))))
+        (new-coroutine (vector #f (lambda () body ...)))))
     ((_ (co-name arg ...) body ...)
       (define (co-name arg ...)
-        (new-coroutine (vector #f #f (lambda () (catch-jump (scm->cps body ...) id))))))))
+        (new-coroutine (vector #f (lambda () body ...)))))))
 
 
 ;; Convert a coroutine object into a generator thunk!
@@ -885,6 +882,53 @@
   ((self->type) 'universe)
   ((self->string) (append "#<universe[" (pointer-address self) "]>")))
 
+;; Channels between (thread-confined) universes, created via "make-channel" & 
+;; "spawn-universe"
+(defclass channel ()
+  (channel:private:id #f)
+  ((put! datum)
+    (channel-put! self datum))
+  ((get)
+    (channel-get self))
+  ((ready?)
+    (channel-ready? self))
+  ((close!)
+    (channel-close! self))
+  ((self->type) 'channel)
+  ((self->string) (append "#<channel[" (number->string self.channel:private:id) "]>")))
+
+;; ==================================
+;; =========== EVENT LOOP ===========
+;; ==================================
+
+;; Results of async primitives (eg "read-line-async"), resolved via "await"
+(defclass async-operation ()
+  (async-operation:private:id #f)
+  (async-operation:private:status 'pending) ; 'pending, 'done, or 'failed
+  (async-operation:private:result #f)
+  ((await)
+    (await self))
+  ((done?)
+    (async-done? self))
+  ((self->type) 'async-operation)
+  ((self->string) (append "#<async-operation[" (symbol->string self.async-operation:private:status) "]>")))
+
+;; Listening sockets, created via "open-tcp-listener" & "open-unix-listener"
+(defclass socket-listener ()
+  (socket-listener:private:fd #f)
+  (socket-listener:private:path #f)
+  ((accept)
+    (accept-async self))
+  ((port)
+    (listener-port self))
+  ((close!)
+    (close-listener! self))
+  ((self->type) 'socket-listener)
+  ((self->string) 
+    (append "#<socket-listener[" 
+            (if self.socket-listener:private:fd (number->string self.socket-listener:private:fd) "closed")
+            "]>")))
+
 ;; =============================================
 ;; =========== TAU BETA PI ASCII ART ===========
 ;; =============================================
@@ -947,6 +991,33 @@
   (close-port port)
   port-contents)
 
+(defn port->line-stream
+  (() (port->line-stream (current-input-port))) ; lazily read rest of lines in input-port
+  ((input-port)
+    (if (not (input-port? input-port))
+        (heist:stream:error 'port->line-stream "arg isn't an input port!" 
+          "(port->line-stream <optional-open-input-port>)" input-port))
+    (define (line-stream)
+      (let ((line (read-line input-port)))
+        (if (eof-object? line)
+            stream-null
+            (scons line (line-stream)))))
+    (line-stream)))
+
+(defn port->csv-stream
+  (() (port->csv-stream (current-input-port))) ; lazily read rest of csv rows in input-port
+  ((input-port) (port->csv-stream input-port #\,))
+  ((input-port delimiter)
+    (if (not (input-port? input-port))
+        (heist:stream:error 'port->csv-stream "1st arg isn't an input port!" 
+          "(port->csv-stream <optional-open-input-port> <optional-delimiter-char>)" input-port))
+    (define (csv-stream)
+      (let ((row (read-csv-row input-port delimiter)))
+        (if (eof-object? row)
+            stream-null
+            (scons row (csv-stream)))))
+    (csv-stream)))
+
 ;; ==========================================================================
 ;; =========== OPTIMIZED MACRO EXPANSION (UNWRAPPED UNARY BEGINS) ===========
 ;; ==========================================================================
@@ -57,8 +57,7 @@ namespace heist {
       "\n     (csv->list <csv-string> <optional-delimiter-char>)"
       "\n     <csv-data> ::= <string> | <number>";
     char delimiter = stdlib_csv::validate_csv_parsing_args(args,"csv->list",format);
-    std::vector<data_vector> csv_matrix;
-    return stdlib_csv::parse_csv("(list ", delimiter, *args[0].str);
+    return stdlib_csv::parse_csv<false>(*args[0].str,delimiter,args,"csv->list",format);
   }
 
 
@@ -67,8 +66,44 @@ namespace heist {
       "\n     (csv->vector <csv-string> <optional-delimiter-char>)"
       "\n     <csv-data> ::= <string> | <number>";
     char delimiter = stdlib_csv::validate_csv_parsing_args(args,"csv->vector",format);
-    std::vector<data_vector> csv_matrix;
-    return stdlib_csv::parse_csv("(vector ", delimiter, *args[0].str);
+    return stdlib_csv::parse_csv<true>(*args[0].str,delimiter,args,"csv->vector",format);
+  }
+
+
+  data primitive_COERCE_CSV_TO_ALISTS(data_vector&& args) {
+    static constexpr const char * const format = 
+      "\n     (csv->alists <csv-string-with-header-row> <optional-delimiter-char>)"
+      "\n     <csv-data> ::= <string> | <number>";
+    char delimiter = stdlib_csv::validate_csv_parsing_args(args,"csv->alists",format);
+    return stdlib_csv::parse_csv_with_header(*args[0].str,delimiter,args,"csv->alists",format);
+  }
+
+
+  data primitive_READ_CSV_ROW(data_vector&& args) {
+    static constexpr const char * const format = 
+      "\n     (read-csv-row <optional-open-input-port> <optional-delimiter-char>)"
+      "\n     <csv-data> ::= <string> | <number>";
+    if(args.size() > 2)
+      HEIST_THROW_ERR("'read-csv-row received incorrect # of args!" 
+        << format << HEIST_FCN_ERR("read-csv-row",args));
+    FILE* ins = primitive_toolkit::get_current_input_port(args,"read-csv-row",format);
+    if(!args.empty()) {
+      if(!args[0].is_type(types::fip) || !args[0].fip.is_open())
+        HEIST_THROW_ERR("'read-csv-row 1st arg " << HEIST_PROFILE(args[0]) << " isn't an open input port!" 
+          << format << HEIST_FCN_ERR("read-csv-row",args));
+      ins = *args[0].fip.fp;
+    }
+    char delimiter = ',';
+    if(args.size() == 2) {
+      if(!args[1].is_type(types::chr) || !args[1].chr || args[1].chr == '\n')
+        HEIST_THROW_ERR("'read-csv-row 2nd arg " << HEIST_PROFILE(args[1]) << " isn't a non-nul/newline character!" 
+          << format << HEIST_FCN_ERR("read-csv-row",args));
+      delimiter = char(args[1].chr);
+    }
+    stdlib_csv::csv_reader<stdlib_csv::csv_port_source> reader(stdlib_csv::csv_port_source{ins},delimiter,"read-csv-row",format,args);
+    data_vector row;
+    if(!reader.read_row(row)) return chr_type(EOF);
+    return stdlib_csv::convert_csv_row_to_list(row);
   }
 
 
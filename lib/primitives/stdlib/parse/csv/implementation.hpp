@@ -130,11 +130,27 @@ namespace heist::stdlib_csv {
   * CSV GENERATION
   ******************************************************************************/
 
+  // Generates RFC-4180 CSV: strings are always quoted (w/ '"' escaped as '""')
+  void generate_csv_field(string& csv, const data& field)noexcept{
+    if(!field.is_type(types::str)) {
+      csv += field.write();
+      return;
+    }
+    csv += '"';
+    for(const char c : *field.str) {
+      if(c == '"') csv += '"';
+      csv += c;
+    }
+    csv += '"';
+  }
+
+
   data generate_csv(const std::vector<data_vector>& csv_matrix, const char delimiter)noexcept{
     string csv;
     for(size_type i = 0, n = csv_matrix.size(); i < n; ++i) {
       for(size_type j = 0, m = csv_matrix[i].size(); j < m; ++j) {
-        csv += csv_matrix[i][j].write() + delimiter;
+        if(j) csv += delimiter;
+        generate_csv_field(csv,csv_matrix[i][j]);
       }
       csv += '\n';
     }
@@ -145,78 +161,211 @@ namespace heist::stdlib_csv {
   * CSV PARSING
   ******************************************************************************/
 
-  void trim_edge_whitespace(string& sym)noexcept{
+  // CSV ROWS ARE PARSED PER RFC-4180:
+  //   0. quoted fields -> strings (may contain delimiters & newlines, '""' -> '"')
+  //   1. unquoted decimal/float fields -> numbers
+  //      => Tables type by column: only columns of such fields become numbers
+  //      => Rows read 1 at a time (IE "read-csv-row") type by field
+  //   2. other unquoted fields -> strings (w/o surrounding whitespace)
+  //   3. rows end at "\n" or "\r\n"
+
+  // Character sources read by <csv_reader>
+  struct csv_string_source {
+    const string& csv;
     size_type i = 0;
-    for(size_type n = sym.size(); i < n && isspace(sym[i]); ++i);
-    sym.erase(sym.begin(),sym.begin()+i);
-    for(i = sym.size(); i-- != 0;) if(!isspace(sym[i])) break;
-      sym.erase(sym.begin()+i+1,sym.end());
+    int get()noexcept{return i < csv.size() ? (unsigned char)csv[i++] : EOF;}
+    int peek()const noexcept{return i < csv.size() ? (unsigned char)csv[i] : EOF;}
+  };
+
+
+  struct csv_port_source {
+    FILE* ins;
+    int get()noexcept{return getc(ins);}
+    int peek()noexcept{
+      const int c = getc(ins);
+      if(c != EOF) ungetc(c,ins);
+      return c;
+    }
+  };
+
+
+  // Whether <field> is a plain decimal/float: [+-]? (<digits> [. <digits>] | . <digits>) [[eE] [+-]? <digits>]
+  // => Other Scheme number syntax (IE "1/2", "+inf.0", "#xff") stays text, as it's rarely numeric in a CSV
+  bool is_csv_number(const string& field)noexcept{
+    size_type i = 0, digits = 0;
+    const size_type n = field.size();
+    if(i < n && (field[i] == '+' || field[i] == '-')) ++i;
+    while(i < n && isdigit(field[i])) ++i, ++digits;
+    if(i < n && field[i] == '.')
+      for(++i; i < n && isdigit(field[i]); ++i) ++digits;
+    if(!digits) return false;
+    if(i < n && (field[i] == 'e' || field[i] == 'E')) {
+      if(++i < n && (field[i] == '+' || field[i] == '-')) ++i;
+      if(i == n || !isdigit(field[i])) return false;
+      while(i < n && isdigit(field[i])) ++i;
+    }
+    return i == n;
+  }
+
+
+  // Convert an unquoted field into a number if possible, else a string
+  data infer_csv_field_type(const string& field)noexcept{
+    if(is_csv_number(field)) return num_type(field);
+    return make_str(field);
+  }
+
+
+  template<typename CSV_SOURCE>
+  struct csv_reader {
+    size_type row_number = 0;
+
+    csv_reader(CSV_SOURCE src, const char delim, const char* fcn_name, const char* fcn_format, const data_vector& fcn_args)noexcept
+      : source(src), delimiter(delim), name(fcn_name), format(fcn_format), args(fcn_args) {}
+
+    // Read the next row's fields into <row>, returning false if at EOF
+    // => Given <numeric_fields>, unquoted fields are left as strings, w/ whether
+    //    each field could be a number recorded instead (see "infer_csv_column_types")
+    bool read_row(data_vector& row, std::vector<bool>* numeric_fields = nullptr) {
+      int c = source.get();
+      if(c == EOF) return false;
+      ++row_number;
+      // empty line -> empty row
+      if(c == '\n') return true;
+      if(c == '\r' && source.peek() == '\n') {
+        source.get();
+        return true;
+      }
+      for(;;) {
+        field.clear();
+        while(c != EOF && c != delimiter && c != '\n' && isspace(c)) c = source.get();
+        if(c == '"') {
+          read_quoted_field();
+          c = source.get();
+          while(c != EOF && c != delimiter && c != '\n' && isspace(c)) c = source.get();
+          if(c != EOF && c != delimiter && c != '\n')
+            throw_malformed_csv_error("non-delimiter char after a quoted field");
+          row.push_back(make_str(field));
+          if(numeric_fields) numeric_fields->push_back(false);
+        } else {
+          while(c != EOF && c != delimiter && c != '\n') {
+            field += char(c);
+            c = source.get();
+          }
+          while(!field.empty() && isspace(field.back())) field.pop_back();
+          if(!numeric_fields) {
+            row.push_back(infer_csv_field_type(field));
+          } else {
+            row.push_back(make_str(field));
+            numeric_fields->push_back(is_csv_number(field));
+          }
+        }
+        if(c != delimiter) return true; // reached "\n" or EOF
+        c = source.get();
+      }
+    }
+
+  private:
+    CSV_SOURCE source;
+    const char delimiter;
+    const char* name;
+    const char* format;
+    const data_vector& args;
+    string field;
+
+    void throw_malformed_csv_error(const char* reason) {
+      HEIST_THROW_ERR('\''<<name<<" malformed CSV (" << reason << " in row #" << row_number << "!)"
+        << format << HEIST_FCN_ERR(name,args));
+    }
+
+    // PRECONDITION: the opening '"' was just read
+    void read_quoted_field() {
+      for(;;) {
+        const int c = source.get();
+        if(c == EOF) throw_malformed_csv_error("unterminated quoted field");
+        if(c == '"') {
+          if(source.peek() != '"') return;
+          source.get();
+        }
+        field += char(c);
+      }
+    }
+  };
+
+
+  // Convert <row> into a list (w/o recursing, as rows & tables may be large)
+  data convert_csv_row_to_list(data_vector& row)noexcept{
+    data lst = symconst::emptylist;
+    for(size_type i = row.size(); i-- > 0;) {
+      data p = make_par();
+      p.par->first = std::move(row[i]);
+      p.par->second = std::move(lst);
+      lst = std::move(p);
+    }
+    return lst;
   }
 
 
-  void print_csv_reader_error_alert(const char* seq_name) {
-    std::cerr << '\n' << HEIST_AFMT(heist::AFMT_131) << "-------" << string(7+strlen(seq_name), '-')
-      << HEIST_AFMT(heist::AFMT_01) << "--------------\n"
-      << HEIST_AFMT(heist::AFMT_131) << "> CSV->" << seq_name
-      << HEIST_AFMT(heist::AFMT_01) << " READER ERROR:" << HEIST_AFMT(heist::AFMT_0);
+  // Read the rest of <reader>'s rows, typing each column by all of its fields: 
+  //   a column's fields only become numbers if every one of them is numeric
+  template<typename CSV_SOURCE>
+  std::vector<data_vector> read_csv_table(csv_reader<CSV_SOURCE>& reader) {
+    std::vector<data_vector> rows;
+    std::vector<bool> numeric_fields, numeric_columns;
+    for(data_vector row; reader.read_row(row,&numeric_fields); row.clear(), numeric_fields.clear()) {
+      if(numeric_columns.size() < numeric_fields.size()) 
+        numeric_columns.resize(numeric_fields.size(),true);
+      for(size_type j = 0, n = numeric_fields.size(); j < n; ++j)
+        numeric_columns[j] = numeric_columns[j] && numeric_fields[j];
+      rows.push_back(std::move(row));
+    }
+    for(auto& row : rows)
+      for(size_type j = 0, n = row.size(); j < n; ++j)
+        if(numeric_columns[j]) row[j] = num_type(*row[j].str);
+    return rows;
   }
 
 
-  data parse_csv(const char* seq_prefix, const char delimiter, const string& csv){
-    // Convert CSV into a Scheme expression to be read & evaluated
-    string scm_expr(seq_prefix);
-    scm_expr += seq_prefix;
-    for(size_type i = 0, n = csv.size(); i < n; ++i) {
-      // end of row
-      if(csv[i] == '\n') {
-        scm_expr += ')';
-        scm_expr += seq_prefix;
-      // skip non-newline whitespace
-      } else if(isspace(csv[i])) {
-        continue;
-      // string literal
-      } else if(is_non_escaped_double_quote(i,csv)) { // from lib/core/reader/parser.hpp
-        auto j = i;
-        skip_string_literal(i,csv);                   // from lib/core/reader/parser.hpp
-        while(j <= i) scm_expr += csv[j++];
-      // delimiter
-      } else if(csv[i] == delimiter) {
-        scm_expr += ' ';
-      // general character (presumably part of a numeric)
+  template<bool AS_VECTOR>
+  data parse_csv(const string& csv, const char delimiter, const data_vector& args, const char* name, const char* format){
+    csv_reader<csv_string_source> reader(csv_string_source{csv},delimiter,name,format,args);
+    data_vector table;
+    for(auto& row : read_csv_table(reader)) {
+      if constexpr (AS_VECTOR) {
+        table.push_back(make_vec(std::move(row)));
       } else {
-        scm_expr += csv[i];
+        table.push_back(convert_csv_row_to_list(row));
       }
     }
-    // Prep CSV-converted scheme expression for evaluation
-    trim_edge_whitespace(scm_expr);
-    const auto seq_n = strlen(seq_prefix)-1;
-    const auto n = scm_expr.size();
-    char prefix[30];
-    strncpy(prefix,seq_prefix,30);
-    prefix[seq_n] = 0; // rm space at the end of the sequence ctor prefix
-    if(n >= seq_n && scm_expr.compare(n-seq_n,seq_n,prefix) == 0)
-      scm_expr.erase(n-seq_n,seq_n);
-    else 
-      scm_expr += ')';
-    scm_expr += ')';
-    // Try parsing the converted csv expression, & throw an error as needed
-    try { 
-      data_vector abstract_syntax_tree;
-      // Return AST if successfully parsed an expression
-      parse_input_exp(string(scm_expr),abstract_syntax_tree);
-      if(abstract_syntax_tree.empty()) return GLOBALS::VOID_DATA_OBJECT;
-      return scm_eval(std::move(abstract_syntax_tree[0]),G.GLOBAL_ENVIRONMENT_POINTER);
-    } catch(const READER_ERROR& read_error) {
-      print_csv_reader_error_alert(seq_prefix[1] == 'v' ? "VECTOR" : "LIST");
-      if(is_non_repl_reader_error(read_error))
-           alert_non_repl_reader_error(stdout,read_error,scm_expr);
-      else alert_reader_error(stdout,read_error,scm_expr);
-      throw SCM_EXCEPT::READ;
-    } catch(const size_type& read_error_index) {
-      print_csv_reader_error_alert(seq_prefix[1] == 'v' ? "VECTOR" : "LIST");
-      alert_reader_error(stdout,read_error_index,scm_expr);
-      throw SCM_EXCEPT::READ;
+    if constexpr (AS_VECTOR) {
+      return make_vec(std::move(table));
+    } else {
+      return convert_csv_row_to_list(table);
+    }
+  }
+
+
+  // Convert the rows after <csv>'s header row into alists keyed by the header's fields
+  data parse_csv_with_header(const string& csv, const char delimiter, const data_vector& args, const char* name, const char* format){
+    csv_reader<csv_string_source> reader(csv_string_source{csv},delimiter,name,format,args);
+    data_vector header, table;
+    std::vector<bool> header_numeric_fields; // header fields are names, hence always strings
+    if(!reader.read_row(header,&header_numeric_fields)) return symconst::emptylist;
+    auto rows = read_csv_table(reader);
+    for(size_type r = 0, total_rows = rows.size(); r < total_rows; ++r) {
+      auto& row = rows[r];
+      if(row.size() != header.size())
+        HEIST_THROW_ERR('\''<<name<<" row #" << r+2 << " has " << row.size() 
+          << " fields but the header has " << header.size() << '!' << format << HEIST_FCN_ERR(name,args));
+      data_vector alist(row.size());
+      for(size_type i = 0, n = row.size(); i < n; ++i) {
+        data_vector key_value_pair(2);
+        key_value_pair[0] = header[i];
+        key_value_pair[1] = std::move(row[i]);
+        alist[i] = convert_csv_row_to_list(key_value_pair);
+      }
+      table.push_back(convert_csv_row_to_list(alist));
     }
+    return convert_csv_row_to_list(table);
   }
 
 } // End of namespace heist::stdlib_csv
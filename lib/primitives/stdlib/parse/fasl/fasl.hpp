@@ -0,0 +1,67 @@
+// Author: Jordan Randleman -- jordanran199@gmail.com -- fasl.hpp
+// => Defines the primitive fasl (binary serialization) functions written in C++ for the Heist Scheme Interpreter
+
+#ifndef HEIST_SCHEME_CORE_STDLIB_FASL_HPP_
+#define HEIST_SCHEME_CORE_STDLIB_FASL_HPP_
+
+#include "implementation.hpp"
+
+namespace heist {
+
+  data primitive_FASL_WRITE(data_vector&& args) {
+    static constexpr const char * const format = 
+      "\n     (fasl-write <obj> <optional-open-output-port>)"
+      "\n     <obj> ::= <pair> | <vector> | <string> | <symbol> | <number> | <char>"
+      "\n             | <boolean> | <hmap> | <homogeneous-vector> | <void>";
+    if(args.empty() || args.size() > 2)
+      HEIST_THROW_ERR("'fasl-write received incorrect # of args!" 
+        << format << HEIST_FCN_ERR("fasl-write",args));
+    FILE* outs = primitive_toolkit::get_current_output_port(args,"fasl-write",format);
+    if(args.size() == 2) {
+      if(!args[1].is_type(types::fop) || !args[1].fop.is_open())
+        HEIST_THROW_ERR("'fasl-write 2nd arg " << HEIST_PROFILE(args[1]) << " isn't an open output port!" 
+          << format << HEIST_FCN_ERR("fasl-write",args));
+      outs = *args[1].fop.fp;
+    }
+    stdlib_fasl::fasl_writer writer(outs,args,format);
+    writer.write_datum(args[0]);
+    writer.flush();
+    flush_unbuffered_console_port(outs);
+    return GLOBALS::VOID_DATA_OBJECT;
+  }
+
+
+  data primitive_FASL_READ(data_vector&& args) {
+    static constexpr const char * const format = "\n     (fasl-read <optional-open-input-port>)";
+    if(args.size() > 1)
+      HEIST_THROW_ERR("'fasl-read received incorrect # of args!" 
+        << format << HEIST_FCN_ERR("fasl-read",args));
+    FILE* ins = primitive_toolkit::get_current_input_port(args,"fasl-read",format);
+    if(args.size() == 1) {
+      if(!args[0].is_type(types::fip) || !args[0].fip.is_open())
+        HEIST_THROW_ERR("'fasl-read arg " << HEIST_PROFILE(args[0]) << " isn't an open input port!" 
+          << format << HEIST_FCN_ERR("fasl-read",args));
+      ins = *args[0].fip.fp;
+    }
+    // Decode ports that can't seek (pipes, sockets, etc.) directly, w/o reading past the fasl
+    if(!is_seekable_file(ins)) {
+      const int ch = fgetc(ins);
+      if(ch == EOF) return chr_type(EOF);
+      ungetc(ch,ins);
+      return stdlib_fasl::fasl_reader(ins,args,format).read();
+    }
+    // Read the fasl in place (memory-mapped if possible), then mv <ins> past it
+    source_buffer source(ins);
+    if(source.text().empty()) {
+      fgetc(ins); // set EOF
+      return chr_type(EOF);
+    }
+    stdlib_fasl::fasl_reader reader(source.text(),args,format);
+    data datum = reader.read();
+    fseek(ins, long(source.offset()+reader.position()), SEEK_SET);
+    return datum;
+  }
+
+} // End of namespace heist
+
+#endif
@@ -0,0 +1,436 @@
+// Author: Jordan Randleman -- jordanran199@gmail.com -- implementation.hpp
+// => Defines helper functions for fasl.hpp
+
+#ifndef HEIST_SCHEME_CORE_STDLIB_FASL_IMPLEMENTATION_HPP_
+#define HEIST_SCHEME_CORE_STDLIB_FASL_IMPLEMENTATION_HPP_
+
+namespace heist::stdlib_universes {
+  // from "../../data/atomics/universes/implementation.hpp"
+  bool get_channel_id(const data& d, size_type& id)noexcept;
+  data make_channel_object(const size_type id, const data_vector& args, const char* name, const char* format);
+}
+
+namespace heist::stdlib_fasl {
+
+  /******************************************************************************
+  * FASL ENCODING
+  ******************************************************************************/
+
+  // FASL ("FASt Load") DATUM ENCODING:
+  //   <fasl>  ::= <FASL_MAGIC> <datum>
+  //   <datum> ::= <tag> <payload>
+  //   => Lengths & reference indices are unsigned LEB128 varints
+  //   => Pairs, strings, vectors, hmaps, homogeneous vectors, & symbols are 
+  //      numbered in the order they're first written, w/ repeat occurrences 
+  //      written as a <reference> to that number (preserving shared structure
+  //      & cycles, & only writing each symbol's name once)
+  //   => Small exact integers are written as zigzag varints, inexact reals as
+  //      raw doubles (or hex floats if a double would lose precision), & other
+  //      numbers as text
+  //   => Channels are only written (as their id) in messages between universes
+
+  constexpr const char FASL_MAGIC[] = {'\0','H','F','A','S','L','\1'};
+  constexpr size_type FASL_MAGIC_LENGTH = sizeof(FASL_MAGIC);
+
+  enum class fasl_tag : unsigned char {
+    reference,      // <index>
+    pair,           // <car-datum> <cdr-datum>
+    vector,         // <length> <datum> ...
+    string,         // <length> <char> ...
+    symbol,         // <length> <char> ...
+    fixnum,         // <zigzag-varint>
+    number,         // <length> <char> ...
+    double_flonum,  // <8-byte-double>
+    flonum,         // <length> <hex-float-char> ...
+    character,      // <char-code>
+    true_boolean,
+    false_boolean,
+    hmap,           // <length> [<key-length> <char> ... <value-datum>] ...
+    hvector,        // <hvector-tag> <length> <byte> ...
+    void_value,
+    channel         // <channel-id>
+  };
+
+  /******************************************************************************
+  * FASL WRITING
+  ******************************************************************************/
+
+  struct fasl_writer {
+    string fasl;
+
+    fasl_writer(FILE* outs, const data_vector& args, const char* format, 
+                const char* name = "fasl-write", const bool writing_channels = false)noexcept
+      : port(outs), fcn_args(args), fcn_format(format), fcn_name(name), channels(writing_channels) {
+      fasl.append(FASL_MAGIC,FASL_MAGIC_LENGTH);
+    }
+
+    // Write <d> (pairs are written iteratively along their cdrs)
+    void write_datum(const data& d) {
+      const data* iter = &d;
+      while(iter->is_type(types::par) && !write_reference_if_seen(iter->par.ptr)) {
+        write_tag(fasl_tag::pair);
+        write_datum(iter->par->first);
+        iter = &iter->par->second;
+      }
+      if(!iter->is_type(types::par)) write_non_pair(*iter);
+      if(port && fasl.size() >= FLUSH_THRESHOLD) flush();
+    }
+
+    // Write any buffered fasl data to the port
+    void flush()noexcept{
+      fwrite(fasl.data(),1,fasl.size(),port);
+      fasl.clear();
+    }
+
+  private:
+    FILE* port;
+    const data_vector& fcn_args;
+    const char* fcn_format;
+    const char* fcn_name;
+    bool channels;
+    std::unordered_map<const void*,size_type> seen_objects;
+    std::unordered_map<string,size_type> seen_symbols;
+    size_type total_numbered = 0;
+
+    static constexpr size_type FLUSH_THRESHOLD = 65536;
+
+
+    void write_tag(const fasl_tag tag)noexcept{
+      fasl += char(tag);
+    }
+
+    void write_length(size_type n)noexcept{
+      while(n >= 0x80) {
+        fasl += char((n & 0x7F) | 0x80);
+        n >>= 7;
+      }
+      fasl += char(n);
+    }
+
+    void write_bytes(const string& bytes)noexcept{
+      write_length(bytes.size());
+      fasl += bytes;
+    }
+
+    // Returns whether wrote a reference to <object> (else numbers <object>)
+    bool write_reference_if_seen(const void* object)noexcept{
+      auto [entry, inserted] = seen_objects.emplace(object,total_numbered);
+      if(inserted) {
+        ++total_numbered;
+        return false;
+      }
+      write_tag(fasl_tag::reference);
+      write_length(entry->second);
+      return true;
+    }
+
+
+    void write_symbol(const sym_type& sym)noexcept{
+      auto [entry, inserted] = seen_symbols.emplace(sym,total_numbered);
+      if(inserted) {
+        ++total_numbered;
+        write_tag(fasl_tag::symbol);
+        write_bytes(sym);
+      } else {
+        write_tag(fasl_tag::reference);
+        write_length(entry->second);
+      }
+    }
+
+
+    void write_number(const num_type& num)noexcept{
+      static constexpr long double MAX_FIXNUM = 9007199254740992.0L; // 2^53
+      if(!num.is_real() || num.is_nan() || num.is_pos_inf() || num.is_neg_inf()) {
+        write_tag(fasl_tag::number);
+        write_bytes(num.str());
+        return;
+      }
+      const long double val = num.extract_inexact();
+      if(num.is_exact()) {
+        if(!num.is_integer() || val > MAX_FIXNUM || val < -MAX_FIXNUM) {
+          write_tag(fasl_tag::number);
+          write_bytes(num.str());
+        } else {
+          const long long fixnum = (long long)val;
+          write_tag(fasl_tag::fixnum);
+          write_length(fixnum < 0 ? (size_type(-(fixnum+1)) << 1) | 1 : size_type(fixnum) << 1);
+        }
+      } else if(const double dbl = double(val); (long double)dbl == val) {
+        write_tag(fasl_tag::double_flonum);
+        fasl.append((const char*)&dbl,sizeof(dbl));
+      } else {
+        char hexfloat[64];
+        snprintf(hexfloat,sizeof(hexfloat),"%La",val);
+        write_tag(fasl_tag::flonum);
+        write_bytes(hexfloat);
+      }
+    }
+
+
+    void write_hvector(const homogeneous_vector& hv)noexcept{
+      write_tag(fasl_tag::hvector);
+      fasl += char(hv.tag());
+      std::visit([&](const auto& elts){
+        write_length(elts.size());
+        fasl.append((const char*)elts.data(),elts.size()*sizeof(elts[0]));
+      },hv.val);
+    }
+
+
+    void write_non_pair(const data& d) {
+      switch(d.type) {
+        case types::str:
+          if(write_reference_if_seen(d.str.ptr)) return;
+          write_tag(fasl_tag::string);
+          write_bytes(*d.str);
+          return;
+        case types::sym:
+          write_symbol(d.sym);
+          return;
+        case types::num:
+          write_number(d.num);
+          return;
+        case types::chr:
+          write_tag(fasl_tag::character);
+          write_length(size_type(d.chr));
+          return;
+        case types::bol:
+          write_tag(d.bol.val ? fasl_tag::true_boolean : fasl_tag::false_boolean);
+          return;
+        case types::dne:
+          write_tag(fasl_tag::void_value);
+          return;
+        case types::vec:
+          if(write_reference_if_seen(d.vec.ptr)) return;
+          write_tag(fasl_tag::vector);
+          write_length(d.vec->size());
+          for(const auto& elt : *d.vec) write_datum(elt);
+          return;
+        case types::map:
+          if(write_reference_if_seen(d.map.ptr)) return;
+          write_tag(fasl_tag::hmap);
+          write_length(d.map->val.size());
+          for(const auto& keyval : d.map->val) {
+            write_bytes(keyval.first);
+            write_datum(keyval.second);
+          }
+          return;
+        case types::hvc:
+          if(write_reference_if_seen(d.hvc.ptr)) return;
+          write_hvector(*d.hvc);
+          return;
+        default:
+          if(size_type id = 0; channels && stdlib_universes::get_channel_id(d,id)) {
+            write_tag(fasl_tag::channel);
+            write_length(id);
+            return;
+          }
+          HEIST_THROW_ERR('\'' << fcn_name << " datum " << HEIST_PROFILE(d) << " can't be serialized!" 
+            << fcn_format << HEIST_FCN_ERR(fcn_name,fcn_args));
+      }
+    }
+  };
+
+  /******************************************************************************
+  * FASL READING
+  ******************************************************************************/
+
+  struct fasl_reader {
+    fasl_reader(std::string_view source, const data_vector& args, const char* format, 
+                const char* name = "fasl-read", const bool reading_channels = false)noexcept
+      : fasl(source), fcn_args(args), fcn_format(format), fcn_name(name), channels(reading_channels) {}
+
+    // Decode the fasl directly from <source>'s current position (for ports that can't be viewed)
+    fasl_reader(FILE* source, const data_vector& args, const char* format)noexcept
+      : stream(source), fcn_args(args), fcn_format(format), fcn_name("fasl-read"), channels(false) {}
+
+    // Read the datum at the start of the fasl (past its <FASL_MAGIC>)
+    data read() {
+      if(stream ? !read_stream_header() : fasl.compare(0,FASL_MAGIC_LENGTH,std::string_view(FASL_MAGIC,FASL_MAGIC_LENGTH)) != 0)
+        throw_corrupt_fasl_error("missing fasl header");
+      pos = FASL_MAGIC_LENGTH;
+      return read_datum();
+    }
+
+    // Total bytes read
+    size_type position()const noexcept{return pos;}
+
+  private:
+    std::string_view fasl;
+    FILE* stream = nullptr;
+    string stream_bytes; // bytes last read from <stream>
+    size_type pos = 0;
+    const data_vector& fcn_args;
+    const char* fcn_format;
+    const char* fcn_name;
+    bool channels;
+    data_vector objects; // numbered pairs, strings, vectors, hmaps, hvectors, & symbols
+
+
+    void throw_corrupt_fasl_error(const char* reason) {
+      HEIST_THROW_ERR('\'' << fcn_name << " corrupt fasl data (" << reason << " at byte " << pos << "!)" 
+        << fcn_format << HEIST_FCN_ERR(fcn_name,fcn_args));
+    }
+
+    // Confirm at least <n> bytes remain (unknowable when decoding a stream)
+    void confirm_remaining_bytes(const size_type n) {
+      if(!stream && n > fasl.size()-pos) throw_corrupt_fasl_error("unexpected end of data");
+    }
+
+    bool read_stream_header()noexcept{
+      char header[FASL_MAGIC_LENGTH];
+      return fread(header,1,FASL_MAGIC_LENGTH,stream) == FASL_MAGIC_LENGTH && 
+             memcmp(header,FASL_MAGIC,FASL_MAGIC_LENGTH) == 0;
+    }
+
+    unsigned char read_byte() {
+      if(stream) {
+        const int byte = fgetc(stream);
+        if(byte == EOF) throw_corrupt_fasl_error("unexpected end of data");
+        ++pos;
+        return (unsigned char)byte;
+      }
+      if(pos >= fasl.size()) throw_corrupt_fasl_error("unexpected end of data");
+      return (unsigned char)fasl[pos++];
+    }
+
+    size_type read_length() {
+      size_type n = 0;
+      for(unsigned shift = 0; shift < 64; shift += 7) {
+        const unsigned char byte = read_byte();
+        n |= size_type(byte & 0x7F) << shift;
+        if(!(byte & 0x80)) return n;
+      }
+      throw_corrupt_fasl_error("invalid length");
+      return 0; // never triggered
+    }
+
+    std::string_view read_bytes(const size_type n) {
+      if(stream) { // read in blocks, lest a corrupt length allocate excessively
+        char block[4096];
+        stream_bytes.clear();
+        for(size_type remaining = n; remaining;) {
+          const size_type length = std::min(remaining,size_type(sizeof(block)));
+          if(fread(block,1,length,stream) != length) throw_corrupt_fasl_error("unexpected end of data");
+          stream_bytes.append(block,length), pos += length, remaining -= length;
+        }
+        return stream_bytes;
+      }
+      confirm_remaining_bytes(n);
+      pos += n;
+      return fasl.substr(pos-n,n);
+    }
+
+    std::string_view read_bytes() {
+      return read_bytes(read_length());
+    }
+
+
+    // Read a datum (pairs are read iteratively along their cdrs)
+    data read_datum() {
+      data result, *hole = &result;
+      for(;;) {
+        const fasl_tag tag = fasl_tag(read_byte());
+        if(tag != fasl_tag::pair) {
+          *hole = read_non_pair(tag);
+          return result;
+        }
+        *hole = make_par();
+        objects.push_back(*hole);
+        hole->par->first = read_datum();
+        hole = &hole->par->second;
+      }
+    }
+
+
+    data read_number(const fasl_tag tag) {
+      if(tag == fasl_tag::fixnum) {
+        const size_type zigzag = read_length();
+        return num_type((zigzag & 1) ? -(long long)(zigzag >> 1) - 1 : (long long)(zigzag >> 1));
+      }
+      if(tag == fasl_tag::double_flonum) {
+        double dbl;
+        memcpy(&dbl,read_bytes(sizeof(dbl)).data(),sizeof(dbl));
+        return num_type((long double)dbl);
+      }
+      const string text(read_bytes());
+      if(tag == fasl_tag::number) return num_type(text);
+      return num_type(strtold(text.c_str(),nullptr));
+    }
+
+
+    data read_hvector() {
+      const unsigned char tag = read_byte();
+      if(tag >= HVECTOR_TOTAL_TAGS) throw_corrupt_fasl_error("invalid homogeneous vector type");
+      const size_type n = read_length();
+      data hv = make_hvc(homogeneous_vector(hvector_tag(tag)));
+      objects.push_back(hv);
+      std::visit([&](auto& elts){
+        if(n > (stream ? GLOBALS::MAX_SIZE_TYPE : fasl.size()-pos)/sizeof(elts[0])) 
+          throw_corrupt_fasl_error("unexpected end of data");
+        const auto bytes = read_bytes(n*sizeof(elts[0]));
+        elts.resize(n);
+        memcpy((void*)elts.data(),bytes.data(),n*sizeof(elts[0]));
+      },hv.hvc->val);
+      return hv;
+    }
+
+
+    data read_non_pair(const fasl_tag tag) {
+      switch(tag) {
+        case fasl_tag::reference: {
+          const size_type idx = read_length();
+          if(idx >= objects.size()) throw_corrupt_fasl_error("invalid reference");
+          return objects[idx];
+        }
+        case fasl_tag::string: {
+          data str = make_str(string(read_bytes()));
+          objects.push_back(str);
+          return str;
+        }
+        case fasl_tag::symbol: {
+          data sym = sym_type(read_bytes());
+          objects.push_back(sym);
+          return sym;
+        }
+        case fasl_tag::fixnum: case fasl_tag::number: case fasl_tag::double_flonum: case fasl_tag::flonum: 
+          return read_number(tag);
+        case fasl_tag::character: 
+          return chr_type(read_length());
+        case fasl_tag::true_boolean:  return GLOBALS::TRUE_DATA_BOOLEAN;
+        case fasl_tag::false_boolean: return GLOBALS::FALSE_DATA_BOOLEAN;
+        case fasl_tag::void_value:    return GLOBALS::VOID_DATA_OBJECT;
+        case fasl_tag::vector: {
+          const size_type n = read_length();
+          confirm_remaining_bytes(n);
+          data vec = make_vec(data_vector());
+          if(!stream) vec.vec->reserve(n);
+          objects.push_back(vec);
+          for(size_type i = 0; i < n; ++i) vec.vec->push_back(read_datum());
+          return vec;
+        }
+        case fasl_tag::hmap: {
+          const size_type n = read_length();
+          data map = make_map(map_object());
+          objects.push_back(map);
+          for(size_type i = 0; i < n; ++i) {
+            string key(read_bytes());
+            map.map->val[std::move(key)] = read_datum();
+          }
+          return map;
+        }
+        case fasl_tag::hvector: 
+          return read_hvector();
+        case fasl_tag::channel:
+          if(!channels) throw_corrupt_fasl_error("channel outside of a universe message");
+          return stdlib_universes::make_channel_object(read_length(),fcn_args,fcn_name,fcn_format);
+        default:
+          throw_corrupt_fasl_error("invalid datum tag");
+          return data(); // never triggered
+      }
+    }
+  };
+
+} // End of namespace heist::stdlib_fasl
+
+#endif
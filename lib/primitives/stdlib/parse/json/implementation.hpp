@@ -22,170 +22,270 @@ namespace heist::stdlib_json {
   // JSON KEYS: only strings
   // JSON VALUES:
   //   0. string
-  //   1. number (fraction -> long double, NaN/Inf -> null)
-  //   2. object (alist)
+  //   1. number (fraction -> long double)
+  //   2. object (alist of key-value lists)
   //   3. array (vector)
   //   4. boolean
   //   5. null (empty list)
 
-  // CONVERTING JSON STRINGS TO A PARSABLE SCHEME DATA STRUCT:
-  // ,              -> <space>
-  // true           -> #t
-  // false          -> #f
-  // null           -> '()
-  // [...]          -> [vector ...]
-  // <string>:<obj> -> (list <string> <obj>)
+  // Recursive-descent parser converting JSON text directly into Heist data in 
+  // 1 pass (no intermediate scheme source, reading, nor evaluation required)
 
   namespace heist_json_parser {
-    void throw_malformed_json_error(const char* reason, const string& original_json) {
-      HEIST_THROW_ERR("'json->scm malformed JSON (" << reason << "!)"
-        "\n     JSON STRING: \"" << original_json << "\""
-        "\n     (json->scm <string>)" << HEIST_FCN_ERR("json->scm", data_vector(1,original_json)));
+    void throw_malformed_json_error(const char* reason, const string& json, const size_type i) {
+      HEIST_THROW_ERR("'json->scm malformed JSON (" << reason << " at index " << i << "!)"
+        "\n     JSON STRING: \"" << json << "\""
+        "\n     (json->scm <string>)" << HEIST_FCN_ERR("json->scm", data_vector(1,make_str(json))));
     }
 
 
-    void print_json_reader_error_alert() {
-      std::cerr << '\n' << HEIST_AFMT(heist::AFMT_131) << "-----------" 
-        << HEIST_AFMT(heist::AFMT_01) << "--------------\n"
-        << HEIST_AFMT(heist::AFMT_131) << "> JSON->SCM" 
-        << HEIST_AFMT(heist::AFMT_01) << " READER ERROR:" << HEIST_AFMT(heist::AFMT_0);
+    bool is_json_whitespace(const char c)noexcept{
+      return c == ' ' || c == '\n' || c == '\r' || c == '\t';
     }
 
 
-    // PRECONDITION: delimiter = '[' | '{'
-    // POSTCONDITION: ')' is added after the final closing end-delimiter
-    void add_closing_paren_after_array_or_object_value(size_type i,  const char& delimiter, 
-                                                       string& json, const string& original_json){
-      ++i; // skip past opening delimiter
-      const char end_delimiter = delimiter == '[' ? ']' : '}';
-      long long delimiter_count = 1;
-      // Find end of expression
-      for(size_type n = json.size(); i < n && delimiter_count; ++i) {
-        if(json[i] == delimiter) {
-          ++delimiter_count;
-        } else if(json[i] == end_delimiter) {
-          --delimiter_count;
-        } else if(is_non_escaped_double_quote(i,json)) { // from lib/core/reader/parser.hpp
-          skip_string_literal(i,json);                   // from lib/core/reader/parser.hpp
-        } 
+    void skip_json_whitespace(const string& json, size_type& i)noexcept{
+      const size_type n = json.size();
+      while(i < n && is_json_whitespace(json[i])) ++i;
+    }
+
+
+    // Confirm <json> has a non-whitespace char at <i> (after skipping whitespace)
+    void confirm_json_has_more_chars(const string& json, size_type& i) {
+      skip_json_whitespace(json,i);
+      if(i == json.size()) throw_malformed_json_error("unexpected end of JSON",json,i);
+    }
+
+
+    // Confirm <json> has <literal> at <i>, & skip past it
+    void parse_json_literal(const string& json, size_type& i, const char* literal) {
+      const size_type n = strlen(literal);
+      if(json.compare(i,n,literal) != 0)
+        throw_malformed_json_error("invalid JSON token detected",json,i);
+      i += n;
+    }
+
+    /* JSON NUMBER PARSING */
+
+    bool is_json_digit(const char c)noexcept{return c >= '0' && c <= '9';}
+
+
+    // PRECONDITION: json[i] = '-' | [0-9]
+    data parse_json_number(const string& json, size_type& i) {
+      const size_type start = i, n = json.size();
+      if(json[i] == '-') ++i;
+      // integral component (no leading 0s)
+      if(i == n || !is_json_digit(json[i]))
+        throw_malformed_json_error("number missing digits",json,i);
+      if(json[i] == '0') {
+        ++i;
+      } else {
+        while(i < n && is_json_digit(json[i])) ++i;
+      }
+      // fractional component
+      if(i < n && json[i] == '.') {
+        if(++i == n || !is_json_digit(json[i]))
+          throw_malformed_json_error("number missing fractional digits",json,i);
+        while(i < n && is_json_digit(json[i])) ++i;
       }
-      if(i == json.size()) { // verify not at the end of the JSON
-        char issue[] = "missing a closing '}'";
-        if(delimiter == '[') issue[19] = ']';
-        throw_malformed_json_error(issue,original_json);
+      // exponent component
+      if(i < n && (json[i] == 'e' || json[i] == 'E')) {
+        if(++i < n && (json[i] == '+' || json[i] == '-')) ++i;
+        if(i == n || !is_json_digit(json[i]))
+          throw_malformed_json_error("number missing exponent digits",json,i);
+        while(i < n && is_json_digit(json[i])) ++i;
       }
-      json.insert(i+1,")");
+      return num_type(json.substr(start,i-start));
+    }
+
+    /* JSON STRING PARSING */
+
+    int parse_json_hex_digit(const char c)noexcept{
+      if(c >= '0' && c <= '9') return c - '0';
+      if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+      if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+      return -1;
     }
 
 
-    void prepend_string_key_with_list(size_type& i, string& json, const string& original_json){
-      size_type j = i;
-      for(; j; --j) {
-        if(isspace(json[j])) continue;
-        if(json[j] == '"') break;
-        throw_malformed_json_error("non-string key detected",original_json);
+    // PRECONDITION: json[i] is the 1st hex digit of a "\uXXXX" escape
+    unsigned long parse_json_utf16_code_unit(const string& json, size_type& i) {
+      if(i+4 > json.size()) 
+        throw_malformed_json_error("incomplete unicode escape",json,i);
+      unsigned long code_unit = 0;
+      for(size_type j = i+4; i < j; ++i) {
+        const int hex_digit = parse_json_hex_digit(json[i]);
+        if(hex_digit < 0) throw_malformed_json_error("invalid unicode escape",json,i);
+        code_unit = code_unit * 16 + hex_digit;
       }
-      while(j && j-1 && !is_non_escaped_double_quote(--j,json)); // from lib/core/reader/parser.hpp
-      if(!j) throw_malformed_json_error("non-string key detected",original_json);
-      json.insert(j,"(list ");
-      i += 6;
+      return code_unit;
     }
 
 
-    // POST CONDITION: 'i' is where the original ':' was in the string (relatively)
-    void parse_json_key_val_pair(size_type& i, string& json, const string& original_json) {
-      json[i] = ' ';
-      prepend_string_key_with_list(i,json,original_json);
-      const size_type n = json.size();
-      while(i < n && isspace(json[i])) ++i; // mv up to the value
-      if(i == n) throw_malformed_json_error("missing value detected",original_json);
-      size_type j = i;
-      // Insert ')' after array or object
-      if(json[j] == '{' || json[j] == '[') {
-        add_closing_paren_after_array_or_object_value(j,json[j],json,original_json);
-      // Insert ')' after string
-      } else if(json[j] == '"') {
-        skip_string_literal(j,json); // from lib/core/reader/parser.hpp
-        json.insert(j+1, ")");
+    void append_utf8_code_point(string& str, const unsigned long code_point)noexcept{
+      if(code_point < 0x80) {
+        str += char(code_point);
+      } else if(code_point < 0x800) {
+        str += char(0xC0 | (code_point >> 6));
+        str += char(0x80 | (code_point & 0x3F));
+      } else if(code_point < 0x10000) {
+        str += char(0xE0 | (code_point >> 12));
+        str += char(0x80 | ((code_point >> 6) & 0x3F));
+        str += char(0x80 | (code_point & 0x3F));
       } else {
-        while(j < n && !isspace(json[j]) && json[j] != ',' && json[j] != '}' && json[j] != ']') ++j;
-        json.insert(j, ")");
+        str += char(0xF0 | (code_point >> 18));
+        str += char(0x80 | ((code_point >> 12) & 0x3F));
+        str += char(0x80 | ((code_point >> 6) & 0x3F));
+        str += char(0x80 | (code_point & 0x3F));
       }
-      --i; // mv 1 space prior the next value to parse
     }
 
 
-    bool char_is_valid_json_separator(const char& c)noexcept{
-      return isspace(c) || c=='[' || c==']' || c=='{' || c=='}' || c==',' || c==':';
+    // PRECONDITION: json[i] is the char after a '\\'
+    void parse_json_string_escape(const string& json, size_type& i, string& str) {
+      switch(json[i++]) {
+        case '"':  str += '"';  return;
+        case '\\': str += '\\'; return;
+        case '/':  str += '/';  return;
+        case 'b':  str += '\b'; return;
+        case 'f':  str += '\f'; return;
+        case 'n':  str += '\n'; return;
+        case 'r':  str += '\r'; return;
+        case 't':  str += '\t'; return;
+        case 'u': {
+          unsigned long code_point = parse_json_utf16_code_unit(json,i);
+          // combine UTF-16 surrogate pairs
+          if(code_point >= 0xD800 && code_point <= 0xDBFF && 
+             json.compare(i,2,"\\u") == 0) {
+            size_type j = i+2;
+            const unsigned long low_surrogate = parse_json_utf16_code_unit(json,j);
+            if(low_surrogate >= 0xDC00 && low_surrogate <= 0xDFFF) {
+              code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low_surrogate - 0xDC00);
+              i = j;
+            }
+          }
+          append_utf8_code_point(str,code_point);
+          return;
+        }
+        default: throw_malformed_json_error("invalid string escape",json,i-1);
+      }
     }
 
 
-    // VALID TOKENS: <string>, <number>, [], {}, <,>, <:>, null, true, false
-    void validate_given_json(const string& json) {
-      for(size_type i = 0, n = json.size(); i < n; ++i) {
-        // skip strings
-        if(is_non_escaped_double_quote(i,json)) { // from lib/core/reader/parser.hpp
-          skip_string_literal(i,json);            // from lib/core/reader/parser.hpp
-          continue;
-        }
-        // skip separators
-        if(char_is_valid_json_separator(json[i])) continue;
-        // skip null/true
-        if(i+3 < n && 
-          ((json[i]=='n' && json[i+1]=='u' && json[i+2]=='l' && json[i+3]=='l') || 
-           (json[i]=='t' && json[i+1]=='r' && json[i+2]=='u' && json[i+3]=='e'))) {
-          i += 3;
-        // skip false
-        } else if(i+4 < n && json[i]=='f' && json[i+1]=='a' && json[i+2]=='l' && json[i+3]=='s' && json[i+4]=='e') {
-          i += 4;
-        // confirm a number, and skip if so
-        } else {
-          string possible_num;
-          while(i < n && !char_is_valid_json_separator(json[i])) possible_num += json[i++];
-          if(num_type(possible_num).is_nan())
-            throw_malformed_json_error(("invalid JSON token detected: \"" + possible_num + '"').c_str(), json);
+    // PRECONDITION: json[i] = '"'
+    string parse_json_string(const string& json, size_type& i) {
+      string str;
+      const size_type n = json.size();
+      for(++i;;) {
+        // copy runs of unescaped chars at once
+        size_type run_end = i;
+        while(run_end < n && json[run_end] != '"' && json[run_end] != '\\' && 
+              (unsigned char)json[run_end] >= 0x20) ++run_end;
+        str.append(json,i,run_end-i);
+        i = run_end;
+        if(i == n) throw_malformed_json_error("unterminated string",json,i);
+        if(json[i] == '"') {
+          ++i;
+          return str;
         }
+        if(json[i] != '\\') throw_malformed_json_error("unescaped control char in string",json,i);
+        if(++i == n) throw_malformed_json_error("unterminated string",json,i);
+        parse_json_string_escape(json,i,str);
       }
     }
 
+    /* JSON VALUE PARSING */
+
+    data parse_json_value(const string& json, size_type& i);
 
-    string convert_json_to_scm(string json, const string& original_json) {
-      validate_given_json(json);
-      for(size_type i = 0; i < json.size(); ++i) {
-        if(isspace(json[i])) continue;
-        if(is_non_escaped_double_quote(i,json)) { // from lib/core/reader/parser.hpp
-          skip_string_literal(i,json);            // from lib/core/reader/parser.hpp
-          continue;
+
+    // PRECONDITION: json[i] = '['
+    data parse_json_array(const string& json, size_type& i) {
+      data_vector array;
+      ++i;
+      confirm_json_has_more_chars(json,i);
+      if(json[i] == ']') {
+        ++i;
+        return make_vec(std::move(array));
+      }
+      for(;;) {
+        array.push_back(parse_json_value(json,i));
+        confirm_json_has_more_chars(json,i);
+        if(json[i] == ']') {
+          ++i;
+          return make_vec(std::move(array));
         }
-        // Whitespace commas
-        if(json[i] == ',') {
-          json[i] = ' ';
-        // Add 'vector ' prefix to arrays
-        } else if(json[i] == '[') {
-          json.insert(i+1, "vector ");
-          i += 7;
-        // Add 'list ' prefix to objects
-        } else if(json[i] == '{') {
-          json.insert(i+1, "list ");
-          i += 5;
-        // Convert nulls to the empty list
-        } else if(i+3 < json.size() && json[i]=='n' && json[i+1]=='u' && json[i+2]=='l' && json[i+3]=='l') {
-          json[i] = '\'', json[i+1] = '(', json[i+2] = ')', json[i+3] = ' ';
-          i += 4;
-        // Convert true -> #t
-        } else if(i+3 < json.size() && json[i]=='t' && json[i+1]=='r' && json[i+2]=='u' && json[i+3]=='e') {
-          json[i] = '#', json[i+1] = 't', json[i+2] = ' ', json[i+3] = ' ';
-          i += 4;
-        // Convert false -> #f
-        } else if(i+4 < json.size() && json[i]=='f' && json[i+1]=='a' && json[i+2]=='l' && json[i+3]=='s' && json[i+4]=='e') {
-          json[i] = '#', json[i+1] = 'f', json[i+2] = ' ', json[i+3] = ' ', json[i+4] = ' ';
-          i += 5;
-        // Convert key-value pairs to regular pairs
-        } else if(json[i] == ':') {
-          parse_json_key_val_pair(i,json,original_json);
+        if(json[i] != ',') throw_malformed_json_error("missing ',' or ']' in array",json,i);
+        ++i;
+      }
+    }
+
+
+    // PRECONDITION: json[i] = '{'
+    // => Objects become alists of key-value lists: (("key" value) ...)
+    data parse_json_object(const string& json, size_type& i) {
+      data alist = symconst::emptylist, *tail = &alist;
+      ++i;
+      confirm_json_has_more_chars(json,i);
+      if(json[i] == '}') {
+        ++i;
+        return alist;
+      }
+      for(;;) {
+        confirm_json_has_more_chars(json,i);
+        if(json[i] != '"') throw_malformed_json_error("non-string key detected",json,i);
+        data key = make_str(parse_json_string(json,i));
+        confirm_json_has_more_chars(json,i);
+        if(json[i] != ':') throw_malformed_json_error("missing ':' after key",json,i);
+        ++i;
+        // create the (key value) list
+        data key_value_pair = make_par();
+        key_value_pair.par->first = std::move(key);
+        key_value_pair.par->second = make_par();
+        key_value_pair.par->second.par->first = parse_json_value(json,i);
+        key_value_pair.par->second.par->second = symconst::emptylist;
+        // append it to the alist
+        *tail = make_par();
+        tail->par->first = std::move(key_value_pair);
+        tail->par->second = symconst::emptylist;
+        tail = &tail->par->second;
+        confirm_json_has_more_chars(json,i);
+        if(json[i] == '}') {
+          ++i;
+          return alist;
         }
+        if(json[i] != ',') throw_malformed_json_error("missing ',' or '}' in object",json,i);
+        ++i;
       }
-      return json;
+    }
+
+
+    data parse_json_value(const string& json, size_type& i) {
+      confirm_json_has_more_chars(json,i);
+      switch(json[i]) {
+        case '{': return parse_json_object(json,i);
+        case '[': return parse_json_array(json,i);
+        case '"': return make_str(parse_json_string(json,i));
+        case 't': parse_json_literal(json,i,"true");  return GLOBALS::TRUE_DATA_BOOLEAN;
+        case 'f': parse_json_literal(json,i,"false"); return GLOBALS::FALSE_DATA_BOOLEAN;
+        case 'n': parse_json_literal(json,i,"null");  return symconst::emptylist;
+        default:
+          if(json[i] == '-' || is_json_digit(json[i])) return parse_json_number(json,i);
+          throw_malformed_json_error("invalid JSON token detected",json,i);
+          return data(); // never triggered
+      }
+    }
+
+
+    // Parse <json> as a single JSON value (VOID if only whitespace)
+    data parse_json(const string& json) {
+      size_type i = 0;
+      skip_json_whitespace(json,i);
+      if(i == json.size()) return GLOBALS::VOID_DATA_OBJECT;
+      data value = parse_json_value(json,i);
+      skip_json_whitespace(json,i);
+      if(i != json.size()) throw_malformed_json_error("trailing chars after JSON value",json,i);
+      return value;
     }
   } // End of namespace heist_json_parser
 
@@ -193,124 +293,203 @@ namespace heist::stdlib_json {
   * JSON GENERATOR HELPERS
   ******************************************************************************/
 
+  // Emits JSON in 1 pass, indenting as it goes, into a string buffer that 
+  // is flushed to an output port (if given) whenever it grows large enough
+
   namespace heist_json_generator {
-    string convert_scm_to_json(data&,const data_vector&,const char*);
-
-
-    void format_JSON_indent_width_recur(const string& json, size_type& i, const size_type n, 
-                                        string& formatted, const size_type indent_width, const size_type depth)noexcept{
-      formatted += '\n' + string(depth*indent_width, ' ');
-      while(i < n) {
-        if(is_non_escaped_double_quote(i,json)) { // from lib/core/reader/parser.hpp
-          auto start = i;
-          skip_string_literal(i,json);            // from lib/core/reader/parser.hpp
-          formatted += json.substr(start,(++i)-start);
-        } else if(json[i] == '{' || json[i] == '[') {
-          formatted += json[i++];
-          format_JSON_indent_width_recur(json,i,n,formatted,indent_width,depth+1);
-        } else if(json[i] == '}' || json[i] == ']') {
-          formatted += '\n' + string((depth-1)*indent_width, ' ') + json[i++];
-          return;
-        } else if(json[i] == ',') {
-          formatted += json[i++] + ('\n' + string(depth*indent_width, ' '));
-          while(i < n && json[i] == ' ') ++i; // skip whitespace after comma, disturbs indenting
+    bool datum_is_a_valid_json_map_key(const data& d)noexcept{
+      return d.is_type(types::str) || d.is_type(types::num) || 
+             d.is_type(types::bol) || primitive_toolkit::data_is_nil(d);
+    }
+
+
+    struct json_writer {
+      string json;
+
+      json_writer(const size_type indent, FILE* outs, const data_vector& args, const char* format)noexcept
+        : indent_width(indent), port(outs), fcn_args(args), fcn_format(format) {}
+
+      // Emit <d> as a JSON value at the given container nesting <depth>
+      void write_value(const data& d, const size_type depth) {
+        // Convert Empty List
+        if(primitive_toolkit::data_is_nil(d)) {
+          json += "null";
+        // Convert Strings
+        } else if(d.is_type(types::str)) {
+          write_string(*d.str);
+        // Convert Numbers
+        } else if(d.is_type(types::num)) {
+          // Coerce fractions to flonums
+          if(d.num.is_exact() && !d.num.is_integer())
+            json += d.num.to_inexact().str();
+          else
+            json += d.num.str();
+        // Convert boolean
+        } else if(d.is_type(types::bol)) {
+          json += d.bol.val ? "true" : "false";
+        // Convert Vectors -> Array
+        } else if(d.is_type(types::vec)) {
+          open_container('[',depth);
+          for(size_type i = 0, n = d.vec->size(); i < n; ++i) {
+            if(i) write_separator(depth);
+            write_value(d.vec->operator[](i),depth+1);
+          }
+          close_container(']',depth);
+        // Convert Alist -> Map
+        } else if(d.is_type(types::par)) {
+          write_alist(d,depth);
+        // Convert Hmap -> Map
+        } else if(d.is_type(types::map)) {
+          write_hmap(d,depth);
         } else {
-          formatted += json[i++];
+          HEIST_THROW_ERR("'scm->json invalid scheme datum " << HEIST_PROFILE(d)
+            << " can't be converted into JSON!" << fcn_format << HEIST_FCN_ERR("scm->json", fcn_args));
         }
+        if(port && json.size() >= FLUSH_THRESHOLD) flush();
       }
-    }
 
+      // Write any buffered JSON to the port
+      void flush()noexcept{
+        fwrite(json.data(),1,json.size(),port);
+        json.clear();
+      }
 
-    // PRECONDITION: ASSUMES <json> IS VALID JSON
-    string format_JSON_indent_width(const string& json, size_type indent_width)noexcept{
-      if(json.empty() || !indent_width) return json;
-      if(json[0] != '[' && json[0] != '{') return json;
-      string formatted(1,json[0]);
-      size_type i = 1;
-      format_JSON_indent_width_recur(json,i,json.size(),formatted,indent_width,1);
-      return formatted;
-    }
+    private:
+      const size_type indent_width;
+      FILE* port;
+      const data_vector& fcn_args;
+      const char* fcn_format;
 
+      static constexpr size_type FLUSH_THRESHOLD = 65536;
 
-    void convert_scm_to_json_write_map_pair(string& map_json, data_vector& item, 
-                                            const data_vector& args, const char* format){
-      if(item[0].is_type(types::str)) {
-        map_json += item[0].write() + ": " + convert_scm_to_json(item[1],args,format);
-      } else if(item[0].is_type(types::num)) {
-        map_json += '"' + item[0].write() + "\": " + convert_scm_to_json(item[1],args,format);
-      } else if(item[0].is_type(types::bol)) {
-        if(item[0].bol.val) map_json += "\"true\": " + convert_scm_to_json(item[1],args,format);
-        else                map_json += "\"false\": " + convert_scm_to_json(item[1],args,format);
-      } else {
-        map_json += "\"null\": " + convert_scm_to_json(item[1],args,format);
+
+      void write_indent(const size_type depth) {
+        json += '\n';
+        json.append(depth*indent_width,' ');
       }
-    }
 
+      void open_container(const char delimiter, const size_type depth) {
+        json += delimiter;
+        if(indent_width) write_indent(depth+1);
+      }
+
+      void close_container(const char delimiter, const size_type depth) {
+        if(indent_width) write_indent(depth);
+        json += delimiter;
+      }
+
+      void write_separator(const size_type depth) {
+        if(indent_width) {
+          json += ',';
+          write_indent(depth+1);
+        } else {
+          json += ", ";
+        }
+      }
 
-    bool datum_is_a_valid_json_map_key(const data& d)noexcept{
-      return d.is_type(types::str) || d.is_type(types::num) || 
-             d.is_type(types::bol) || primitive_toolkit::data_is_nil(d);
-    }
+
+      void write_string(const string& str) {
+        static constexpr const char* hex_digits = "0123456789abcdef";
+        json += '"';
+        for(const char c : str) {
+          switch(c) {
+            case '"':  json += "\\\""; break;
+            case '\\': json += "\\\\"; break;
+            case '\b': json += "\\b";  break;
+            case '\f': json += "\\f";  break;
+            case '\n': json += "\\n";  break;
+            case '\r': json += "\\r";  break;
+            case '\t': json += "\\t";  break;
+            default:
+              if((unsigned char)c < 0x20) {
+                json += "\\u00";
+                json += hex_digits[(unsigned char)c >> 4];
+                json += hex_digits[(unsigned char)c & 0xF];
+              } else {
+                json += c;
+              }
+          }
+        }
+        json += '"';
+      }
 
 
-    string convert_scm_to_json(data& d, const data_vector& args, const char* format) {
-      // Convert Empty List
-      if(primitive_toolkit::data_is_nil(d)) {
-        return "null";
-      // Convert Strings
-      } else if(d.is_type(types::str)) {
-        return d.write();
-      // Convert Numbers
-      } else if(d.is_type(types::num)) {
-        // Coerce fractions to flonums
-        if(d.num.is_exact() && !d.num.is_integer())
-          return d.num.to_inexact().str();
-        return d.num.str();
-      // Convert boolean
-      } else if(d.is_type(types::bol)) {
-        if(d.bol.val) return "true";
-        return "false";
-      // Convert Vectors -> Array
-      } else if(d.is_type(types::vec)) {
-        string vec_json(1,'[');
-        for(size_type i = 0, n = d.vec->size(); i < n; ++i) {
-          vec_json += convert_scm_to_json(d.vec->operator[](i),args,format);
-          if(i+1 < n) vec_json += ", ";
+      void write_key(const data& key) {
+        if(key.is_type(types::str)) {
+          write_string(*key.str);
+        } else if(key.is_type(types::num)) {
+          write_string(key.write());
+        } else if(key.is_type(types::bol)) {
+          json += key.bol.val ? "\"true\"" : "\"false\"";
+        } else {
+          json += "\"null\"";
         }
-        return vec_json + ']';
-      // Convert Alist -> Map
-      } else if(d.is_type(types::par)) {
-        string map_json(1,'{');
-        auto alist_exp = primitive_toolkit::convert_proper_list_to_data_vector(d);
-        for(size_type i = 0, n = alist_exp.size(); i < n; ++i) {
-          if(!alist_exp[i].is_type(types::par))
-            HEIST_THROW_ERR("scm->json invalid alist " << HEIST_PROFILE(d) << " elt"
-              "\n     " << HEIST_PROFILE(alist_exp[i]) << " can't convert to a map!"
-              << format << HEIST_FCN_ERR("scm->json", args));
-          auto item = primitive_toolkit::convert_proper_list_to_data_vector(alist_exp[i]);
-          if(item.size() != 2)
-            HEIST_THROW_ERR("scm->json invalid alist " << HEIST_PROFILE(d) << " key-value pair"
-              "\n     " << HEIST_PROFILE(alist_exp[i]) << " can't convert to a map!"
-              << format << HEIST_FCN_ERR("scm->json", args));
-          if(!datum_is_a_valid_json_map_key(item[0]))
-            HEIST_THROW_ERR("scm->json invalid alist " << HEIST_PROFILE(d) << " key"
-              "\n     " << HEIST_PROFILE(alist_exp[i]) << " isn't a string|number|null|bool!"
-              << format << HEIST_FCN_ERR("scm->json", args));
-          convert_scm_to_json_write_map_pair(map_json,item,args,format);
-          if(i+1 < n) map_json += ", ";
+        json += ": ";
+      }
+
+
+      void throw_invalid_alist_error(const data& d, const data& elt, const char* issue) {
+        HEIST_THROW_ERR("scm->json invalid alist " << HEIST_PROFILE(d) << ' ' << issue << "\n     " 
+          << HEIST_PROFILE(elt) << (*issue == 'k' ? " isn't a string|number|null|bool!" : " can't convert to a map!")
+          << fcn_format << HEIST_FCN_ERR("scm->json", fcn_args));
+      }
+
+
+      void write_alist(const data& d, const size_type depth) {
+        open_container('{',depth);
+        data iter = d;
+        for(bool first = true; iter.is_type(types::par); iter = iter.par->second, first = false) {
+          const data& elt = iter.par->first;
+          if(!elt.is_type(types::par)) 
+            throw_invalid_alist_error(d,elt,"elt");
+          if(!elt.par->second.is_type(types::par) || !primitive_toolkit::data_is_nil(elt.par->second.par->second))
+            throw_invalid_alist_error(d,elt,"key-value pair");
+          if(!datum_is_a_valid_json_map_key(elt.par->first))
+            throw_invalid_alist_error(d,elt,"key");
+          if(!first) write_separator(depth);
+          write_key(elt.par->first);
+          write_value(elt.par->second.par->first,depth+1);
         }
-        return map_json + '}';
-      } else {
-        HEIST_THROW_ERR("'scm->json invalid scheme datum " << HEIST_PROFILE(d)
-          << " can't be converted into JSON!" << format << HEIST_FCN_ERR("scm->json", args));
-        return ""; // never triggered
+        if(!primitive_toolkit::data_is_nil(iter))
+          throw_invalid_alist_error(d,iter,"elt");
+        close_container('}',depth);
       }
-    }
+
+
+      // Keys are converted as per <object->json> (strings & symbols -> their text)
+      void write_hmap(const data& d, const size_type depth) {
+        open_container('{',depth);
+        bool first = true;
+        for(const auto& keyval : d.map->val) {
+          if(!first) write_separator(depth);
+          first = false;
+          const auto key = map_object::unhash_key(keyval.first);
+          if(key.is_type(types::str) || key.is_type(types::sym))
+            write_string(keyval.first.substr(0,keyval.first.size()-1));
+          else
+            write_string(key.write());
+          json += ": ";
+          write_value(keyval.second,depth+1);
+        }
+        close_container('}',depth);
+      }
+    };
 
 
     // Main handler converting <d> to json and formatting it using <indent_width>
-    string format_scm_as_json(data& d, const size_type indent_width, const data_vector& args, const char* format) {
-      return format_JSON_indent_width(convert_scm_to_json(d,args,format),indent_width);
+    string format_scm_as_json(const data& d, const size_type indent_width, const data_vector& args, const char* format) {
+      json_writer writer(indent_width,nullptr,args,format);
+      writer.write_value(d,0);
+      return std::move(writer.json);
+    }
+
+
+    // Write <d> as json formatted using <indent_width> to <outs>
+    void write_scm_as_json(const data& d, FILE* outs, const size_type indent_width, const data_vector& args, const char* format) {
+      json_writer writer(indent_width,outs,args,format);
+      writer.write_value(d,0);
+      writer.flush();
+      flush_unbuffered_console_port(outs);
     }
   } // End of namespace heist_json_generator
 
@@ -338,6 +517,12 @@ namespace heist::stdlib_json {
         if(!is_valid_json_datum(item))
           return false;
       return true;
+    // Hmap
+    } else if(d.is_type(types::map)) {
+      for(const auto& keyval : d.map->val)
+        if(!is_valid_json_datum(keyval.second))
+          return false;
+      return true;
     // Alist
     } else if(d.is_type(types::par)) {
       auto alist_exp = primitive_toolkit::convert_proper_list_to_data_vector(d);
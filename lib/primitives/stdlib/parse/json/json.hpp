@@ -8,37 +8,11 @@
 
 namespace heist {
 
-  // CONVERTING JSON STRINGS TO A PARSABLE SCHEME DATA STRUCT:
-  // ,              -> <space>
-  // true           -> #t
-  // false          -> #f
-  // null           -> '()
-  // [...]          -> [vector ...]
-  // <string>:<obj> -> (list <string> <obj>)
-
   data primitive_COERCE_JSON_TO_SCM(data_vector&& args) {
     if(args.size() != 1 || !args[0].is_type(types::str))
       HEIST_THROW_ERR("'json->scm didn't receive 1 string arg!" 
         "\n     (json->scm <string>)" << HEIST_FCN_ERR("json->scm", args));
-    if(args[0].str->empty()) return GLOBALS::VOID_DATA_OBJECT;
-    string input = *args[0].str;
-    try { // Try parsing the converted json expression, & throw an error as needed
-      data_vector abstract_syntax_tree;
-      // Return AST if successfully parsed an expression
-      parse_input_exp(stdlib_json::heist_json_parser::convert_json_to_scm(*args[0].str,input),abstract_syntax_tree);
-      if(abstract_syntax_tree.empty()) return GLOBALS::VOID_DATA_OBJECT;
-      return scm_eval(std::move(abstract_syntax_tree[0]),G.GLOBAL_ENVIRONMENT_POINTER);
-    } catch(const READER_ERROR& read_error) {
-      stdlib_json::heist_json_parser::print_json_reader_error_alert();
-      if(is_non_repl_reader_error(read_error))
-           alert_non_repl_reader_error(stdout,read_error,input);
-      else alert_reader_error(stdout,read_error,input);
-      throw SCM_EXCEPT::READ;
-    } catch(const size_type& read_error_index) {
-      stdlib_json::heist_json_parser::print_json_reader_error_alert();
-      alert_reader_error(stdout,read_error_index,input);
-      throw SCM_EXCEPT::READ;
-    }
+    return stdlib_json::heist_json_parser::parse_json(*args[0].str);
   }
 
 
@@ -49,6 +23,7 @@ namespace heist {
       "\n             | <number>"
       "\n             | <'()>    ; -> <null>" 
       "\n             | <alist>  ; -> <map> (keys must be string | number | null | bool!)"
+      "\n             | <hmap>   ; -> <map>"
       "\n             | <vector> ; -> <array>"
       "\n             | <boolean>";
     if(args.empty() || args.size() > 2)
@@ -65,6 +40,41 @@ namespace heist {
   }
 
 
+  data primitive_WRITE_JSON(data_vector&& args) {
+    static constexpr const char * const format = 
+      "\n     (write-json <obj> <optional-open-output-port> <optional-indent-width>)"
+      "\n     <obj> ::= <string>"
+      "\n             | <number>"
+      "\n             | <'()>    ; -> <null>" 
+      "\n             | <alist>  ; -> <map> (keys must be string | number | null | bool!)"
+      "\n             | <hmap>   ; -> <map>"
+      "\n             | <vector> ; -> <array>"
+      "\n             | <boolean>";
+    if(args.empty() || args.size() > 3)
+      HEIST_THROW_ERR("'write-json didn't receive correct # of args:"
+        << format << HEIST_FCN_ERR("write-json",args));
+    FILE* outs = primitive_toolkit::get_current_output_port(args,"write-json",format);
+    size_type i = 1;
+    if(args.size() > 1 && args[1].is_type(types::fop)) {
+      if(!args[1].fop.is_open())
+        HEIST_THROW_ERR("'write-json 2nd arg " << HEIST_PROFILE(args[1]) << " isn't an open output port!" 
+          << format << HEIST_FCN_ERR("write-json",args));
+      outs = *args[1].fop.fp;
+      ++i;
+    }
+    size_type indent_width = 0;
+    if(i < args.size()) {
+      if(i+1 != args.size() || !stdlib_json::data_is_valid_index(args[i]))
+        HEIST_THROW_ERR("'write-json arg " << HEIST_PROFILE(args[i]) << " isn't a valid indent width!" << format 
+          << "\n     <optional-indent-width> := [0, " << GLOBALS::MAX_SIZE_TYPE << ']' << HEIST_FCN_ERR("write-json",args));
+      indent_width = (size_type)args[i].num.extract_inexact();
+    }
+    stdlib_json::heist_json_generator::write_scm_as_json(args[0],outs,indent_width,args,format);
+    G.LAST_PRINTED_TO_STDOUT = (outs == stdout);
+    return GLOBALS::VOID_DATA_OBJECT;
+  }
+
+
   data primitive_JSON_DATUMP(data_vector&& args) {
     if(args.size() != 1)
       HEIST_THROW_ERR("'json-datum? didn't receive exactly 1 arg!"
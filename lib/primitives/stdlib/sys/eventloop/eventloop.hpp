@@ -0,0 +1,318 @@
+// Author: Jordan Randleman -- jordanran199@gmail.com -- eventloop.hpp
+// => Defines the event loop & async I/O primitives (run by coroutine tasks)
+//    written in C++ for the Heist Scheme Interpreter
+
+#ifndef HEIST_SCHEME_CORE_STDLIB_EVENTLOOP_HPP_
+#define HEIST_SCHEME_CORE_STDLIB_EVENTLOOP_HPP_
+
+#include "implementation.hpp"
+
+/***
+ * NOTE:
+ *   Each thread (hence each universe thread) has its own event loop, multiplexing
+ *   file descriptors via epoll on Linux (else "poll" on other POSIX systems).
+ *
+ *   Async primitives (eg "read-line-async") return "async-operation" objects, which
+ *   "await" resolves into their results. Operations are attempted at once, hence
+ *   only ever touch the event loop should they need to block.
+ *
+ *   "async" runs a coroutine as an event loop "task": awaiting while running a task
+ *   simply suspends said task's fiber until the awaited operation completes, leaving
+ *   the event loop free to run other tasks in the meantime. Awaiting from anywhere
+ *   else (eg the REPL) instead runs the event loop until the operation completes.
+ *
+ *   Port reads go through the port's own FILE* buffer (w/ its fd only non-blocking
+ *   for the duration of each attempt), so synchronous & async reads may be mixed.
+ *
+ */
+
+namespace heist {
+
+  /******************************************************************************
+  * TASKS & AWAITING
+  ******************************************************************************/
+
+  data primitive_ASYNC(data_vector&& args) {
+    static constexpr const char * const format =
+      "\n     (async <coroutine-object-or-thunk>)";
+    if(args.size() != 1)
+      HEIST_THROW_ERR("'async didn't receive 1 arg!" << format << HEIST_FCN_ERR("async",args));
+    auto coro_proto = stdlib_coroutines::get_coroutine_class_prototype(args,"async",format);
+    data coroutine = args[0];
+    if(!stdlib_coroutines::datum_is_a_coroutine(coroutine,coro_proto)) {
+      data_vector make_object_args(2);
+      make_object_args[0] = coro_proto;
+      make_object_args[1] = make_vec(data_vector({GLOBALS::FALSE_DATA_BOOLEAN,
+        primitive_toolkit::validate_callable_and_convert_to_procedure(args[0],args,"async",format)}));
+      coroutine = primitive_HEIST_CORE_OO_MAKE_OBJECT(std::move(make_object_args));
+    } else {
+      auto& fiber = stdlib_coroutines::get_coroutine_member(coroutine,"coroutine:private:fiber","async",format);
+      if(fiber.is_type(types::fib) && fiber.fib->state != coroutine_fiber::status::suspended)
+        HEIST_THROW_ERR("'async coroutine " << coroutine << " is already running or finished!"
+          << format << HEIST_FCN_ERR("async",args));
+    }
+    auto id = stdlib_eventloop::make_async_operation(stdlib_eventloop::async_operation::kind::task,args,"async",format);
+    auto& task = stdlib_eventloop::EVENT_LOOP.pending.at(id);
+    task.subject = std::move(coroutine);
+    stdlib_eventloop::EVENT_LOOP.ready_tasks.push_back(id);
+    return task.object;
+  }
+
+
+  data primitive_AWAIT(data_vector&& args) {
+    static constexpr const char * const format = "\n     (await <async-operation>)";
+    if(args.size() != 1)
+      HEIST_THROW_ERR("'await didn't receive 1 arg!" << format << HEIST_FCN_ERR("await",args));
+    if(!stdlib_eventloop::datum_is_an_async_operation(args[0]))
+      HEIST_THROW_ERR("'await arg " << HEIST_PROFILE(args[0]) << " isn't an async-operation!"
+        << format << HEIST_FCN_ERR("await",args));
+    if(stdlib_eventloop::async_operation_is_pending(args[0])) {
+      stdlib_eventloop::suspend_running_task_until_settled(args[0],"await",format);
+      stdlib_eventloop::run_event_loop_until(&args[0],args,"await",format);
+    }
+    auto& result = stdlib_eventloop::get_async_operation_member(args[0],"async-operation:private:result");
+    auto& status = stdlib_eventloop::get_async_operation_member(args[0],"async-operation:private:status");
+    if(status.is_type(types::sym) && status.sym == "failed")
+      HEIST_THROW_ERR("'await async operation failed: " << (result.is_type(types::str) ? *result.str : result.write())
+        << format << HEIST_FCN_ERR("await",args));
+    return result;
+  }
+
+
+  data primitive_ASYNC_DONEP(data_vector&& args) {
+    static constexpr const char * const format = "\n     (async-done? <async-operation>)";
+    if(args.size() != 1)
+      HEIST_THROW_ERR("'async-done? didn't receive 1 arg!" << format << HEIST_FCN_ERR("async-done?",args));
+    if(!stdlib_eventloop::datum_is_an_async_operation(args[0]))
+      HEIST_THROW_ERR("'async-done? arg " << HEIST_PROFILE(args[0]) << " isn't an async-operation!"
+        << format << HEIST_FCN_ERR("async-done?",args));
+    return boolean(!stdlib_eventloop::async_operation_is_pending(args[0]));
+  }
+
+
+  data primitive_RUN_EVENT_LOOP(data_vector&& args) {
+    static constexpr const char * const format = "\n     (run-event-loop)";
+    if(!args.empty())
+      HEIST_THROW_ERR("'run-event-loop doesn't accept any args!" << format << HEIST_FCN_ERR("run-event-loop",args));
+    stdlib_eventloop::run_event_loop_until(nullptr,args,"run-event-loop",format);
+    return GLOBALS::VOID_DATA_OBJECT;
+  }
+
+  /******************************************************************************
+  * TIMERS
+  ******************************************************************************/
+
+  data primitive_SLEEP_ASYNC(data_vector&& args) {
+    static constexpr const char * const format = "\n     (sleep-async <non-negative-milliseconds>)";
+    if(args.size() != 1)
+      HEIST_THROW_ERR("'sleep-async didn't receive 1 arg!" << format << HEIST_FCN_ERR("sleep-async",args));
+    if(!args[0].is_type(types::num) || !args[0].num.is_real() || args[0].num.is_neg())
+      HEIST_THROW_ERR("'sleep-async arg " << HEIST_PROFILE(args[0]) << " isn't a non-negative real number!"
+        << format << HEIST_FCN_ERR("sleep-async",args));
+    auto id = stdlib_eventloop::make_async_operation(stdlib_eventloop::async_operation::kind::sleep,args,"sleep-async",format);
+    auto us = std::chrono::microseconds((long long)(args[0].num.to_inexact().extract_inexact() * 1000));
+    stdlib_eventloop::schedule_timer(id,stdlib_eventloop::event_clock::now()+us);
+    return stdlib_eventloop::EVENT_LOOP.pending.at(id).object;
+  }
+
+  /******************************************************************************
+  * PORT I/O
+  ******************************************************************************/
+
+  data primitive_READ_LINE_ASYNC(data_vector&& args) {
+    static constexpr const char * const format = "\n     (read-line-async <optional-open-input-port>)";
+    stdlib_eventloop::confirm_async_io_support(args,"read-line-async",format);
+    auto port = stdlib_eventloop::confirm_optional_port_arg(args,0,true,"read-line-async",format);
+    fflush(primitive_toolkit::get_current_output_port(args,"read-line-async",format));
+    auto id = stdlib_eventloop::make_async_operation(stdlib_eventloop::async_operation::kind::read_line,args,"read-line-async",format);
+    auto& op = stdlib_eventloop::EVENT_LOOP.pending.at(id);
+    auto object = op.object;
+    op.subject = std::move(port);
+    stdlib_eventloop::progress_async_operation(id);
+    return object;
+  }
+
+
+  data primitive_READ_CHAR_ASYNC(data_vector&& args) {
+    static constexpr const char * const format = "\n     (read-char-async <optional-open-input-port>)";
+    stdlib_eventloop::confirm_async_io_support(args,"read-char-async",format);
+    auto port = stdlib_eventloop::confirm_optional_port_arg(args,0,true,"read-char-async",format);
+    fflush(primitive_toolkit::get_current_output_port(args,"read-char-async",format));
+    auto id = stdlib_eventloop::make_async_operation(stdlib_eventloop::async_operation::kind::read_char,args,"read-char-async",format);
+    auto& op = stdlib_eventloop::EVENT_LOOP.pending.at(id);
+    auto object = op.object;
+    op.subject = std::move(port);
+    stdlib_eventloop::progress_async_operation(id);
+    return object;
+  }
+
+
+  data primitive_DISPLAY_ASYNC(data_vector&& args) {
+    static constexpr const char * const format = "\n     (display-async <obj> <optional-open-output-port>)";
+    stdlib_eventloop::confirm_async_io_support(args,"display-async",format);
+    if(args.empty())
+      HEIST_THROW_ERR("'display-async received incorrect # of args!" << format << HEIST_FCN_ERR("display-async",args));
+    auto port = stdlib_eventloop::confirm_optional_port_arg(args,1,false,"display-async",format);
+    auto id = stdlib_eventloop::make_async_operation(stdlib_eventloop::async_operation::kind::write,args,"display-async",format);
+    auto& op = stdlib_eventloop::EVENT_LOOP.pending.at(id);
+    auto object = op.object;
+    if(args[0].is_type(types::str))      op.buffer = *args[0].str;
+    else if(args[0].is_type(types::chr)) op.buffer = string(1,char(args[0].chr));
+    else if(!args[0].is_type(types::dne)) op.buffer = args[0].display();
+    FILE* outs = *port.fop.fp;
+    fflush(outs); // preserve the order of prior synchronous writes
+    G.LAST_PRINTED_TO_STDOUT = (outs == stdout);
+    if(!op.buffer.empty() && *op.buffer.rbegin() == '\n')
+      G.LAST_PRINTED_NEWLINE_TO_STDOUT = (outs == stdout);
+    op.fd = fileno(outs);
+    op.subject = std::move(port);
+    if(op.fd == -1) { // string port: never blocks
+      fputs(op.buffer.c_str(),outs);
+      stdlib_eventloop::complete_async_operation(id,GLOBALS::VOID_DATA_OBJECT);
+    } else {
+      stdlib_eventloop::progress_async_operation(id);
+    }
+    return object;
+  }
+
+  /******************************************************************************
+  * SUBPROCESSES
+  ******************************************************************************/
+
+  data primitive_RUN_PROCESS_ASYNC(data_vector&& args) {
+    static constexpr const char * const format = "\n     (run-process-async <command-string>)";
+    stdlib_eventloop::confirm_async_io_support(args,"run-process-async",format);
+    if(args.size() != 1 || !args[0].is_type(types::str))
+      HEIST_THROW_ERR("'run-process-async didn't receive 1 string arg!" << format << HEIST_FCN_ERR("run-process-async",args));
+    auto id = stdlib_eventloop::make_async_operation(stdlib_eventloop::async_operation::kind::process,args,"run-process-async",format);
+    auto object = stdlib_eventloop::EVENT_LOOP.pending.at(id).object;
+#ifndef HEIST_WINDOWS_FIBERS
+    stdlib_eventloop::launch_process(id,*args[0].str);
+#endif
+    return object;
+  }
+
+  /******************************************************************************
+  * SOCKETS
+  ******************************************************************************/
+
+  data primitive_OPEN_TCP_LISTENER(data_vector&& args) {
+    static constexpr const char * const format =
+      "\n     (open-tcp-listener <port-number> <optional-host-string>)"
+      "\n     -> <host-string> defaults to \"127.0.0.1\" (loopback)"
+      "\n     -> <port-number> 0 binds an ephemeral port (see \"listener-port\")";
+    stdlib_eventloop::confirm_async_io_support(args,"open-tcp-listener",format);
+    if(args.empty() || args.size() > 2 || (args.size() == 2 && !args[1].is_type(types::str)))
+      HEIST_THROW_ERR("'open-tcp-listener received incorrect args!" << format << HEIST_FCN_ERR("open-tcp-listener",args));
+    auto port = stdlib_eventloop::confirm_port_number(args[0],args,"open-tcp-listener",format);
+#ifndef HEIST_WINDOWS_FIBERS
+    auto host = args.size() == 2 ? *args[1].str : string("127.0.0.1");
+    int fd = stdlib_eventloop::open_tcp_listener_socket(host,port,args,"open-tcp-listener",format);
+    return stdlib_eventloop::make_socket_listener(fd,GLOBALS::FALSE_DATA_BOOLEAN,args,"open-tcp-listener",format);
+#else
+    return (void)port, GLOBALS::VOID_DATA_OBJECT;
+#endif
+  }
+
+
+  data primitive_OPEN_UNIX_LISTENER(data_vector&& args) {
+    static constexpr const char * const format = "\n     (open-unix-listener <socket-path-string>)";
+    stdlib_eventloop::confirm_async_io_support(args,"open-unix-listener",format);
+    if(args.size() != 1 || !args[0].is_type(types::str))
+      HEIST_THROW_ERR("'open-unix-listener didn't receive 1 string arg!" << format << HEIST_FCN_ERR("open-unix-listener",args));
+#ifndef HEIST_WINDOWS_FIBERS
+    int fd = stdlib_eventloop::open_unix_listener_socket(*args[0].str,args,"open-unix-listener",format);
+    return stdlib_eventloop::make_socket_listener(fd,make_str(*args[0].str),args,"open-unix-listener",format);
+#else
+    return GLOBALS::VOID_DATA_OBJECT;
+#endif
+  }
+
+
+  data primitive_LISTENER_PORT(data_vector&& args) {
+    static constexpr const char * const format = "\n     (listener-port <socket-listener>)";
+    if(args.size() != 1)
+      HEIST_THROW_ERR("'listener-port didn't receive 1 arg!" << format << HEIST_FCN_ERR("listener-port",args));
+    int fd = stdlib_eventloop::confirm_socket_listener(args[0],args,"listener-port",format);
+#ifndef HEIST_WINDOWS_FIBERS
+    auto& path = stdlib_eventloop::get_socket_listener_member(args[0],"socket-listener:private:path");
+    if(path.is_type(types::str)) return path;
+    sockaddr_storage address;
+    socklen_t length = sizeof(address);
+    if(getsockname(fd,(sockaddr*)&address,&length) == -1)
+      HEIST_THROW_ERR("'listener-port couldn't get the socket's address: " << strerror(errno)
+        << format << HEIST_FCN_ERR("listener-port",args));
+    if(address.ss_family == AF_INET6) return num_type(ntohs(((sockaddr_in6*)&address)->sin6_port));
+    return num_type(ntohs(((sockaddr_in*)&address)->sin_port));
+#else
+    return (void)fd, GLOBALS::VOID_DATA_OBJECT;
+#endif
+  }
+
+
+  data primitive_CLOSE_LISTENER_BANG(data_vector&& args) {
+    static constexpr const char * const format = "\n     (close-listener! <socket-listener>)";
+    if(args.size() != 1)
+      HEIST_THROW_ERR("'close-listener! didn't receive 1 arg!" << format << HEIST_FCN_ERR("close-listener!",args));
+    int fd = stdlib_eventloop::confirm_socket_listener(args[0],args,"close-listener!",format);
+#ifndef HEIST_WINDOWS_FIBERS
+    stdlib_eventloop::fail_fd_waiters(fd,"socket-listener was closed while accepting");
+    close(fd);
+    stdlib_eventloop::get_socket_listener_member(args[0],"socket-listener:private:fd") = GLOBALS::FALSE_DATA_BOOLEAN;
+    auto& path = stdlib_eventloop::get_socket_listener_member(args[0],"socket-listener:private:path");
+    if(path.is_type(types::str)) unlink(path.str->c_str());
+#else
+    (void)fd;
+#endif
+    return GLOBALS::VOID_DATA_OBJECT;
+  }
+
+
+  data primitive_ACCEPT_ASYNC(data_vector&& args) {
+    static constexpr const char * const format = "\n     (accept-async <socket-listener>)";
+    if(args.size() != 1)
+      HEIST_THROW_ERR("'accept-async didn't receive 1 arg!" << format << HEIST_FCN_ERR("accept-async",args));
+    int fd = stdlib_eventloop::confirm_socket_listener(args[0],args,"accept-async",format);
+    auto id = stdlib_eventloop::make_async_operation(stdlib_eventloop::async_operation::kind::accept,args,"accept-async",format);
+    auto& op = stdlib_eventloop::EVENT_LOOP.pending.at(id);
+    auto object = op.object;
+    op.fd = fd;
+    op.subject = args[0];
+    stdlib_eventloop::progress_async_operation(id);
+    return object;
+  }
+
+
+  data primitive_CONNECT_TCP_ASYNC(data_vector&& args) {
+    static constexpr const char * const format = "\n     (connect-tcp-async <host-string> <port-number>)";
+    stdlib_eventloop::confirm_async_io_support(args,"connect-tcp-async",format);
+    if(args.size() != 2 || !args[0].is_type(types::str))
+      HEIST_THROW_ERR("'connect-tcp-async received incorrect args!" << format << HEIST_FCN_ERR("connect-tcp-async",args));
+    auto port = stdlib_eventloop::confirm_port_number(args[1],args,"connect-tcp-async",format);
+    auto id = stdlib_eventloop::make_async_operation(stdlib_eventloop::async_operation::kind::connect,args,"connect-tcp-async",format);
+    auto object = stdlib_eventloop::EVENT_LOOP.pending.at(id).object;
+#ifndef HEIST_WINDOWS_FIBERS
+    stdlib_eventloop::launch_tcp_connect(id,*args[0].str,port);
+#else
+    (void)port;
+#endif
+    return object;
+  }
+
+
+  data primitive_CONNECT_UNIX_ASYNC(data_vector&& args) {
+    static constexpr const char * const format = "\n     (connect-unix-async <socket-path-string>)";
+    stdlib_eventloop::confirm_async_io_support(args,"connect-unix-async",format);
+    if(args.size() != 1 || !args[0].is_type(types::str))
+      HEIST_THROW_ERR("'connect-unix-async didn't receive 1 string arg!" << format << HEIST_FCN_ERR("connect-unix-async",args));
+    auto id = stdlib_eventloop::make_async_operation(stdlib_eventloop::async_operation::kind::connect,args,"connect-unix-async",format);
+    auto object = stdlib_eventloop::EVENT_LOOP.pending.at(id).object;
+#ifndef HEIST_WINDOWS_FIBERS
+    stdlib_eventloop::launch_unix_connect(id,*args[0].str);
+#endif
+    return object;
+  }
+
+} // End of namespace heist
+
+#endif
@@ -0,0 +1,757 @@
+// Author: Jordan Randleman -- jordanran199@gmail.com -- implementation.hpp
+// => Defines the (per-thread) event loop driving eventloop.hpp's async operations
+
+#ifndef HEIST_SCHEME_CORE_STDLIB_EVENTLOOP_IMPLEMENTATION_HPP_
+#define HEIST_SCHEME_CORE_STDLIB_EVENTLOOP_IMPLEMENTATION_HPP_
+
+#include <chrono>
+#include <deque>
+#include <queue>
+
+#ifndef HEIST_WINDOWS_FIBERS
+  #include <cerrno>
+  #include <fcntl.h>
+  #include <netdb.h>
+  #include <netinet/in.h>
+  #include <poll.h>
+  #include <spawn.h>
+  #include <sys/socket.h>
+  #include <sys/un.h>
+  #include <sys/wait.h>
+  #if defined(__linux__)
+    #define HEIST_EPOLL_EVENT_LOOP
+    #include <sys/epoll.h>
+  #endif
+  extern char** environ;
+#endif
+
+namespace heist::stdlib_eventloop {
+
+  using event_clock = std::chrono::steady_clock;
+
+  /******************************************************************************
+  * ASYNC OPERATIONS & THE EVENT LOOP
+  ******************************************************************************/
+
+  // Pending operations live in their thread's event loop until they complete, at
+  //   which point their result is stored in their "async-operation" object
+  struct async_operation {
+    enum class kind {task, read_line, read_char, write, sleep, process, accept, connect};
+    kind type;
+    data object;                    // "async-operation" object (kept alive while pending)
+    std::vector<size_type> waiters; // ids of the tasks awaiting this operation
+    data subject;                   // task's coroutine, or the port being read/written
+    int fd = -1;                    // file descriptor being waited on
+    string buffer;                  // line read so far, bytes to write, or process output
+    size_type written = 0;          // # of <buffer> bytes written so far
+    long long pid = -1;             // spawned process id
+    async_operation(kind k)noexcept : type(k) {}
+  };
+
+
+  struct event_timer {
+    event_clock::time_point deadline;
+    size_type id;
+    bool operator<(const event_timer& t)const noexcept{return deadline > t.deadline;} // min-heap
+  };
+
+
+  // Operations waiting on a file descriptor (each only ever waits for a single
+  //   readiness event, re-registering itself should it still need to block)
+  struct fd_interest {
+    std::vector<size_type> readers, writers;
+    unsigned registered = 0; // events registered w/ epoll
+  };
+
+
+  struct event_loop {
+    size_type last_id = 0;
+    std::unordered_map<size_type,async_operation> pending;
+    std::deque<size_type> ready_tasks;
+    std::priority_queue<event_timer> timers;
+    std::unordered_map<int,fd_interest> interests;
+    size_type running_task = 0;         // task being resumed by the loop (0 if none)
+    bool running_task_awaiting = false; // whether <running_task> suspended via "await"
+#ifdef HEIST_EPOLL_EVENT_LOOP
+    int epoll_fd = -1;
+    ~event_loop()noexcept{if(epoll_fd != -1) close(epoll_fd);}
+#endif
+  };
+
+  thread_local event_loop EVENT_LOOP;
+
+  /******************************************************************************
+  * ASYNC OPERATION & SOCKET LISTENER OBJECTS
+  ******************************************************************************/
+
+  // PRECONDITION: <object> is an "async-operation" or "socket-listener" (w/ <member>)
+  data& get_event_object_member(data& object, const char* member)noexcept{
+    auto& members = object.obj->member_names();
+    for(size_type i = 0, n = members.size(); i < n; ++i)
+      if(members[i] == member) return object.obj->member_values[i];
+    return object; // never triggered
+  }
+
+  data& get_async_operation_member(data& op, const char* member)noexcept{
+    return get_event_object_member(op,member);
+  }
+
+
+  bool datum_is_an_async_operation(const data& d)noexcept{
+    return d.is_type(types::obj) && d.obj->proto->class_name == "async-operation";
+  }
+
+
+  bool async_operation_is_pending(data& op)noexcept{
+    auto& status = get_async_operation_member(op,"async-operation:private:status");
+    return status.is_type(types::sym) && status.sym == "pending";
+  }
+
+
+  // Registers a new pending operation, returning its id
+  size_type make_async_operation(const async_operation::kind k, const data_vector& args, const char* name, const char* format) {
+    bool found = false;
+    auto val = G.GLOBAL_ENVIRONMENT_POINTER->lookup_variable_value("async-operation", found);
+    if(!found || !val.is_type(types::cls))
+      HEIST_THROW_ERR('\''<<name<<" 'async-operation symbol isn't bound to a class prototype!"
+        << format << HEIST_FCN_ERR(name,args));
+    auto id = ++EVENT_LOOP.last_id;
+    data_vector members(3);
+    members[0] = num_type(id);
+    members[1] = data(sym_type("pending"));
+    members[2] = GLOBALS::FALSE_DATA_BOOLEAN;
+    data_vector make_object_args(2);
+    make_object_args[0] = std::move(val);
+    make_object_args[1] = make_vec(std::move(members));
+    auto object = primitive_HEIST_CORE_OO_MAKE_OBJECT(std::move(make_object_args));
+    EVENT_LOOP.pending.emplace(id,async_operation(k)).first->second.object = std::move(object);
+    return id;
+  }
+
+
+  data& get_socket_listener_member(data& listener, const char* member)noexcept{
+    return get_event_object_member(listener,member);
+  }
+
+
+  data make_socket_listener(const int fd, data path, const data_vector& args, const char* name, const char* format) {
+    bool found = false;
+    auto val = G.GLOBAL_ENVIRONMENT_POINTER->lookup_variable_value("socket-listener", found);
+    if(!found || !val.is_type(types::cls)) {
+#ifndef HEIST_WINDOWS_FIBERS
+      close(fd);
+#endif
+      HEIST_THROW_ERR('\''<<name<<" 'socket-listener symbol isn't bound to a class prototype!"
+        << format << HEIST_FCN_ERR(name,args));
+    }
+    data_vector make_object_args(2);
+    make_object_args[0] = std::move(val);
+    make_object_args[1] = make_vec(data_vector({num_type(fd),std::move(path)}));
+    return primitive_HEIST_CORE_OO_MAKE_OBJECT(std::move(make_object_args));
+  }
+
+  /******************************************************************************
+  * OPERATION COMPLETION
+  ******************************************************************************/
+
+  // Stores <result> in the operation's object, & schedules the tasks awaiting it
+  void settle_async_operation(const size_type id, data&& result, const bool failed)noexcept{
+    auto op = EVENT_LOOP.pending.find(id);
+    if(op == EVENT_LOOP.pending.end()) return;
+    get_async_operation_member(op->second.object,"async-operation:private:status") = data(sym_type(failed ? "failed" : "done"));
+    get_async_operation_member(op->second.object,"async-operation:private:result") = std::move(result);
+    get_async_operation_member(op->second.object,"async-operation:private:id") = GLOBALS::FALSE_DATA_BOOLEAN;
+    for(auto waiter : op->second.waiters) EVENT_LOOP.ready_tasks.push_back(waiter);
+    EVENT_LOOP.pending.erase(op);
+  }
+
+
+  void complete_async_operation(const size_type id, data result)noexcept{
+    settle_async_operation(id,std::move(result),false);
+  }
+
+
+  void fail_async_operation(const size_type id, const string& message)noexcept{
+    settle_async_operation(id,make_str(message),true);
+  }
+
+  void schedule_timer(const size_type id, const event_clock::time_point deadline) {
+    EVENT_LOOP.timers.push(event_timer{deadline,id});
+  }
+
+
+  /******************************************************************************
+  * FILE DESCRIPTOR READINESS POLLING
+  ******************************************************************************/
+
+#ifndef HEIST_WINDOWS_FIBERS
+  // Syncs <fd>'s epoll registration w/ its current interests (returns success)
+  bool update_fd_registration(const int fd, fd_interest& interest)noexcept{
+#ifdef HEIST_EPOLL_EVENT_LOOP
+    unsigned events = (interest.readers.empty() ? 0u : unsigned(EPOLLIN)) | (interest.writers.empty() ? 0u : unsigned(EPOLLOUT));
+    if(events == interest.registered) return true;
+    if(EVENT_LOOP.epoll_fd == -1 && (EVENT_LOOP.epoll_fd = epoll_create1(EPOLL_CLOEXEC)) == -1) return false;
+    epoll_event event;
+    event.events = events;
+    event.data.fd = fd;
+    if(!events) {
+      epoll_ctl(EVENT_LOOP.epoll_fd,EPOLL_CTL_DEL,fd,&event);
+    } else if(epoll_ctl(EVENT_LOOP.epoll_fd,interest.registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD,fd,&event) == -1) {
+      // a reused fd may still be registered (closing an fd implicitly unregisters it)
+      if(errno != EEXIST || epoll_ctl(EVENT_LOOP.epoll_fd,EPOLL_CTL_MOD,fd,&event) == -1) return false;
+    }
+    interest.registered = events;
+#else
+    (void)fd, (void)interest; // "poll" gathers interests anew upon each wait
+#endif
+    return true;
+  }
+
+
+  void wait_for_fd(const size_type id, const int fd, const bool writing)noexcept{
+    auto& interest = EVENT_LOOP.interests[fd];
+    auto& waiters = writing ? interest.writers : interest.readers;
+    waiters.push_back(id);
+    if(update_fd_registration(fd,interest)) return;
+    auto error = errno;
+    waiters.pop_back();
+    if(interest.readers.empty() && interest.writers.empty()) EVENT_LOOP.interests.erase(fd);
+    fail_async_operation(id,string("can't wait on file descriptor: ") + strerror(error));
+  }
+
+
+  // Takes (& unregisters) the operations waiting on <fd> for the given events
+  void take_fd_waiters(const int fd, const bool readable, const bool writable, std::vector<size_type>& ready)noexcept{
+    auto interest = EVENT_LOOP.interests.find(fd);
+    if(interest == EVENT_LOOP.interests.end()) return;
+    if(readable) {
+      ready.insert(ready.end(),interest->second.readers.begin(),interest->second.readers.end());
+      interest->second.readers.clear();
+    }
+    if(writable) {
+      ready.insert(ready.end(),interest->second.writers.begin(),interest->second.writers.end());
+      interest->second.writers.clear();
+    }
+    update_fd_registration(fd,interest->second);
+    if(interest->second.readers.empty() && interest->second.writers.empty())
+      EVENT_LOOP.interests.erase(interest);
+  }
+
+
+  // Blocks for at most <timeout_ms> (-1 = indefinitely) until file descriptors
+  //   become ready, returning the ids of the operations waiting on them
+  std::vector<size_type> poll_ready_operations(const int timeout_ms)noexcept{
+    std::vector<size_type> ready;
+#ifdef HEIST_EPOLL_EVENT_LOOP
+    if(EVENT_LOOP.epoll_fd == -1) {
+      if(timeout_ms > 0) std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+      return ready;
+    }
+    epoll_event events[64];
+    int n = epoll_wait(EVENT_LOOP.epoll_fd,events,64,timeout_ms);
+    for(int i = 0; i < n; ++i) {
+      bool failed = events[i].events & (EPOLLERR|EPOLLHUP);
+      take_fd_waiters(events[i].data.fd,failed || (events[i].events & EPOLLIN),
+                                        failed || (events[i].events & EPOLLOUT),ready);
+    }
+#else
+    std::vector<pollfd> fds;
+    for(auto& interest : EVENT_LOOP.interests) {
+      pollfd p;
+      p.fd = interest.first, p.revents = 0;
+      p.events = (interest.second.readers.empty() ? 0 : POLLIN) | (interest.second.writers.empty() ? 0 : POLLOUT);
+      fds.push_back(p);
+    }
+    if(poll(fds.data(),fds.size(),timeout_ms) <= 0) return ready;
+    for(auto& p : fds) {
+      bool failed = p.revents & (POLLERR|POLLHUP|POLLNVAL);
+      if(p.revents) take_fd_waiters(p.fd,failed || (p.revents & POLLIN),failed || (p.revents & POLLOUT),ready);
+    }
+#endif
+    return ready;
+  }
+#endif // HEIST_WINDOWS_FIBERS
+
+  /******************************************************************************
+  * NON-BLOCKING I/O ATTEMPTS
+  ******************************************************************************/
+
+#ifndef HEIST_WINDOWS_FIBERS
+  // Toggles O_NONBLOCK on <fd>, returning its prior flags
+  int set_fd_nonblocking(const int fd)noexcept{
+    int flags = fcntl(fd,F_GETFL,0);
+    if(flags != -1 && !(flags & O_NONBLOCK)) fcntl(fd,F_SETFL,flags|O_NONBLOCK);
+    return flags;
+  }
+
+  void restore_fd_flags(const int fd, const int flags)noexcept{
+    if(flags != -1 && !(flags & O_NONBLOCK)) fcntl(fd,F_SETFL,flags);
+  }
+
+  void set_fd_cloexec(const int fd)noexcept{
+    fcntl(fd,F_SETFD,fcntl(fd,F_GETFD,0)|FD_CLOEXEC);
+  }
+
+
+  // Reads via the port's own FILE* (thus sharing its buffer w/ the synchronous
+  //   readers), w/ the port's fd only non-blocking for the duration of the attempt.
+  //   String ports (no fd) & regular files never block, hence complete at once.
+  void attempt_port_read(const size_type id, async_operation& op) {
+    FILE* ins = *op.subject.fip.fp;
+    int fd = fileno(ins), flags = fd == -1 ? -1 : set_fd_nonblocking(fd);
+    for(;;) {
+      errno = 0;
+      int ch = getc(ins);
+      if(ch == EOF) {
+        bool would_block = ferror(ins) && (errno == EAGAIN || errno == EWOULDBLOCK);
+        if(fd != -1) restore_fd_flags(fd,flags);
+        if(would_block) {
+          clearerr(ins);
+          op.fd = fd;
+          wait_for_fd(id,fd,false);
+          return;
+        }
+        if(ins == stdin) clearerr(ins);
+        if(op.type == async_operation::kind::read_char || op.buffer.empty())
+          return complete_async_operation(id,chr_type(EOF));
+        return complete_async_operation(id,make_str(std::move(op.buffer)));
+      }
+      if(op.type == async_operation::kind::read_char) {
+        if(fd != -1) restore_fd_flags(fd,flags);
+        return complete_async_operation(id,chr_type(ch));
+      }
+      if(ch == '\n') {
+        if(fd != -1) restore_fd_flags(fd,flags);
+        return complete_async_operation(id,make_str(std::move(op.buffer)));
+      }
+      op.buffer += char(ch);
+    }
+  }
+
+
+  // Writes straight to the port's fd (having flushed its FILE* buffer upon launch)
+  void attempt_port_write(const size_type id, async_operation& op) {
+    int fd = op.fd, flags = set_fd_nonblocking(fd);
+    while(op.written < op.buffer.size()) {
+      auto n = send(fd,op.buffer.data()+op.written,op.buffer.size()-op.written,MSG_NOSIGNAL);
+      if(n == -1 && errno == ENOTSOCK)
+        n = write(fd,op.buffer.data()+op.written,op.buffer.size()-op.written);
+      if(n >= 0) {
+        op.written += size_type(n);
+      } else if(errno == EAGAIN || errno == EWOULDBLOCK) {
+        restore_fd_flags(fd,flags);
+        return wait_for_fd(id,fd,true);
+      } else if(errno != EINTR) {
+        restore_fd_flags(fd,flags);
+        return fail_async_operation(id,string("couldn't write to port: ") + strerror(errno));
+      }
+    }
+    restore_fd_flags(fd,flags);
+    complete_async_operation(id,GLOBALS::VOID_DATA_OBJECT);
+  }
+
+
+  // Drains the (non-blocking) pipe of the process' stdout, then reaps it
+  void attempt_process_read(const size_type id, async_operation& op) {
+    if(op.fd != -1) {
+      char block[4096];
+      for(;;) {
+        auto n = read(op.fd,block,sizeof(block));
+        if(n > 0) {
+          op.buffer.append(block,size_type(n));
+        } else if(n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+          return wait_for_fd(id,op.fd,false);
+        } else if(n == -1 && errno == EINTR) {
+          continue;
+        } else { // EOF
+          close(op.fd);
+          op.fd = -1;
+          break;
+        }
+      }
+    }
+    int status = 0;
+    auto reaped = waitpid(pid_t(op.pid),&status,WNOHANG);
+    if(reaped == 0) // closed its stdout, but still running
+      return schedule_timer(id,event_clock::now()+std::chrono::milliseconds(5));
+    data result = make_par();
+    if(reaped == -1)
+      result.par->first = num_type(-1);
+    else
+      result.par->first = num_type(WIFEXITED(status) ? WEXITSTATUS(status) : 128+WTERMSIG(status));
+    result.par->second = make_str(std::move(op.buffer));
+    complete_async_operation(id,std::move(result));
+  }
+
+
+  // Wraps a connected socket as an (input-port . output-port) pair
+  data make_socket_ports(const int fd)noexcept{
+    int flags = fcntl(fd,F_GETFL,0);
+    if(flags != -1 && (flags & O_NONBLOCK)) fcntl(fd,F_SETFL,flags & ~O_NONBLOCK);
+    set_fd_cloexec(fd);
+    int out_fd = dup(fd);
+    if(out_fd != -1) set_fd_cloexec(out_fd);
+    data ports = make_par();
+    ports.par->first = iport(fdopen(fd,"r"));
+    ports.par->second = oport(out_fd == -1 ? nullptr : fdopen(out_fd,"w"));
+    return ports;
+  }
+
+
+  void attempt_accept(const size_type id, async_operation& op) {
+    for(;;) {
+      int fd = accept(op.fd,nullptr,nullptr);
+      if(fd != -1) return complete_async_operation(id,make_socket_ports(fd));
+      if(errno == EAGAIN || errno == EWOULDBLOCK) return wait_for_fd(id,op.fd,false);
+      if(errno != EINTR && errno != ECONNABORTED)
+        return fail_async_operation(id,string("couldn't accept a connection: ") + strerror(errno));
+    }
+  }
+
+
+  // Invoked once the connecting socket becomes writable
+  void attempt_connect(const size_type id, async_operation& op) {
+    int error = 0;
+    socklen_t length = sizeof(error);
+    if(getsockopt(op.fd,SOL_SOCKET,SO_ERROR,&error,&length) == -1) error = errno;
+    int fd = op.fd;
+    op.fd = -1;
+    if(error) {
+      close(fd);
+      return fail_async_operation(id,string("couldn't connect: ") + strerror(error));
+    }
+    complete_async_operation(id,make_socket_ports(fd));
+  }
+
+
+  // Launches a non-blocking connection to <address>
+  void launch_connect(const size_type id, const int domain, const sockaddr* address, const socklen_t length) {
+    auto& op = EVENT_LOOP.pending.at(id);
+    op.fd = socket(domain,SOCK_STREAM,0);
+    if(op.fd == -1) return fail_async_operation(id,string("couldn't create a socket: ") + strerror(errno));
+    set_fd_cloexec(op.fd);
+    set_fd_nonblocking(op.fd);
+    if(connect(op.fd,address,length) == 0) return attempt_connect(id,op);
+    if(errno == EINPROGRESS || errno == EAGAIN) return wait_for_fd(id,op.fd,true);
+    auto message = string("couldn't connect: ") + strerror(errno);
+    close(op.fd);
+    op.fd = -1;
+    fail_async_operation(id,message);
+  }
+
+
+  // Resolves <host> via "getaddrinfo" (NOTE: name lookups block, numeric hosts don't)
+  addrinfo* resolve_tcp_address(const string& host, const size_type port, const bool passive, string& error)noexcept{
+    addrinfo hints, *addresses = nullptr;
+    memset(&hints,0,sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if(passive) hints.ai_flags = AI_PASSIVE;
+    int status = getaddrinfo(host.c_str(),std::to_string(port).c_str(),&hints,&addresses);
+    if(status) error = gai_strerror(status);
+    return status ? nullptr : addresses;
+  }
+
+
+  void launch_tcp_connect(const size_type id, const string& host, const size_type port) {
+    string error;
+    auto addresses = resolve_tcp_address(host,port,false,error);
+    if(!addresses) return fail_async_operation(id,"couldn't resolve \""+host+"\": "+error);
+    launch_connect(id,addresses->ai_family,addresses->ai_addr,addresses->ai_addrlen);
+    freeaddrinfo(addresses);
+  }
+
+
+  bool make_unix_socket_address(const string& path, sockaddr_un& address)noexcept{
+    memset(&address,0,sizeof(address));
+    address.sun_family = AF_UNIX;
+    if(path.empty() || path.size() >= sizeof(address.sun_path)) return false;
+    memcpy(address.sun_path,path.c_str(),path.size());
+    return true;
+  }
+
+
+  void launch_unix_connect(const size_type id, const string& path) {
+    sockaddr_un address;
+    if(!make_unix_socket_address(path,address))
+      return fail_async_operation(id,"invalid unix socket path \""+path+"\"");
+    launch_connect(id,AF_UNIX,(sockaddr*)&address,sizeof(address));
+  }
+
+
+  // Binds & listens on a new (non-blocking) socket, throwing upon failure
+  int listen_on_new_socket(const int domain, const sockaddr* address, const socklen_t length, const data_vector& args, const char* name, const char* format) {
+    int fd = socket(domain,SOCK_STREAM,0), yes = 1;
+    if(fd == -1)
+      HEIST_THROW_ERR('\''<<name<<" couldn't create a socket: "<<strerror(errno) << format << HEIST_FCN_ERR(name,args));
+    set_fd_cloexec(fd);
+    if(domain != AF_UNIX) setsockopt(fd,SOL_SOCKET,SO_REUSEADDR,&yes,sizeof(yes));
+    if(bind(fd,address,length) == -1 || listen(fd,SOMAXCONN) == -1) {
+      auto error = errno;
+      close(fd);
+      HEIST_THROW_ERR('\''<<name<<" couldn't listen on the socket: "<<strerror(error) << format << HEIST_FCN_ERR(name,args));
+    }
+    set_fd_nonblocking(fd);
+    return fd;
+  }
+
+
+  int open_tcp_listener_socket(const string& host, const size_type port, const data_vector& args, const char* name, const char* format) {
+    string error;
+    auto addresses = resolve_tcp_address(host,port,true,error);
+    if(!addresses)
+      HEIST_THROW_ERR('\''<<name<<" couldn't resolve \""<<host<<"\": "<<error << format << HEIST_FCN_ERR(name,args));
+    try {
+      int fd = listen_on_new_socket(addresses->ai_family,addresses->ai_addr,addresses->ai_addrlen,args,name,format);
+      freeaddrinfo(addresses);
+      return fd;
+    } catch(...) {
+      freeaddrinfo(addresses);
+      throw;
+    }
+  }
+
+
+  int open_unix_listener_socket(const string& path, const data_vector& args, const char* name, const char* format) {
+    sockaddr_un address;
+    if(!make_unix_socket_address(path,address))
+      HEIST_THROW_ERR('\''<<name<<" invalid unix socket path \""<<path<<"\"!" << format << HEIST_FCN_ERR(name,args));
+    return listen_on_new_socket(AF_UNIX,(sockaddr*)&address,sizeof(address),args,name,format);
+  }
+
+
+  // Fails the operations waiting on <fd> (about to be closed)
+  void fail_fd_waiters(const int fd, const string& message)noexcept{
+    std::vector<size_type> waiters;
+    take_fd_waiters(fd,true,true,waiters);
+    for(auto id : waiters) fail_async_operation(id,message);
+  }
+
+
+  // Spawns "/bin/sh -c <command>" w/ its stdout piped to a non-blocking fd
+  void launch_process(const size_type id, const string& command) {
+    auto& op = EVENT_LOOP.pending.at(id);
+    int pipe_fds[2];
+    if(pipe(pipe_fds) == -1)
+      return fail_async_operation(id,string("couldn't create a pipe: ") + strerror(errno));
+    set_fd_cloexec(pipe_fds[0]);
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions,pipe_fds[1],STDOUT_FILENO);
+    posix_spawn_file_actions_addclose(&actions,pipe_fds[1]);
+    char sh[] = "/bin/sh", dash_c[] = "-c";
+    char* argv[] = {sh, dash_c, const_cast<char*>(command.c_str()), nullptr};
+    pid_t pid = 0;
+    fflush(stdout); // don't duplicate pending output in the child
+    int error = posix_spawn(&pid,sh,&actions,nullptr,argv,environ);
+    posix_spawn_file_actions_destroy(&actions);
+    close(pipe_fds[1]);
+    if(error) {
+      close(pipe_fds[0]);
+      return fail_async_operation(id,string("couldn't spawn process: ") + strerror(error));
+    }
+    op.pid = pid;
+    op.fd = pipe_fds[0];
+    set_fd_nonblocking(op.fd);
+    attempt_process_read(id,op);
+  }
+#endif // HEIST_WINDOWS_FIBERS
+
+
+  // Retries an operation whose fd became ready (or whose timer expired)
+  void progress_async_operation(const size_type id) {
+    auto op = EVENT_LOOP.pending.find(id);
+    if(op == EVENT_LOOP.pending.end()) return;
+#ifndef HEIST_WINDOWS_FIBERS
+    switch(op->second.type) {
+      case async_operation::kind::read_line:
+      case async_operation::kind::read_char:
+        if(!op->second.subject.fip.is_open())
+          return fail_async_operation(id,"input port was closed while reading");
+        return attempt_port_read(id,op->second);
+      case async_operation::kind::write:
+        if(!op->second.subject.fop.is_open())
+          return fail_async_operation(id,"output port was closed while writing");
+        return attempt_port_write(id,op->second);
+      case async_operation::kind::process: return attempt_process_read(id,op->second);
+      case async_operation::kind::accept:  return attempt_accept(id,op->second);
+      case async_operation::kind::connect: return attempt_connect(id,op->second);
+      case async_operation::kind::sleep:   return complete_async_operation(id,GLOBALS::VOID_DATA_OBJECT);
+      case async_operation::kind::task:    return;
+    }
+#else
+    if(op->second.type == async_operation::kind::sleep)
+      complete_async_operation(id,GLOBALS::VOID_DATA_OBJECT);
+#endif
+  }
+
+  /******************************************************************************
+  * TASKS (COROUTINES RUN BY THE EVENT LOOP)
+  ******************************************************************************/
+
+  coroutine_fiber* get_task_fiber(async_operation& task, const char* name, const char* format) {
+    auto& fiber = stdlib_coroutines::get_coroutine_member(task.subject,"coroutine:private:fiber",name,format);
+    return fiber.is_type(types::fib) ? fiber.fib.ptr : nullptr;
+  }
+
+
+  // Resumes the task until it finishes, awaits an operation, or yields (the
+  //   latter rescheduling it). Errors escaping the task fail its operation.
+  void resume_task(const size_type id, const char* name, const char* format) {
+    auto op = EVENT_LOOP.pending.find(id);
+    if(op == EVENT_LOOP.pending.end()) return;
+    auto fiber = get_task_fiber(op->second,name,format);
+    if(fiber && fiber->state != coroutine_fiber::status::suspended) {
+      if(fiber->state == coroutine_fiber::status::finished)
+        fail_async_operation(id,"task's coroutine was finished outside of the event loop");
+      return; // else already running (resumed by a nested event loop)
+    }
+    auto coroutine = op->second.subject;
+    auto outer_task = EVENT_LOOP.running_task;
+    auto outer_awaiting = EVENT_LOOP.running_task_awaiting;
+    EVENT_LOOP.running_task = id, EVENT_LOOP.running_task_awaiting = false;
+    data result;
+    try {
+      result = stdlib_coroutines::resume_coroutine(coroutine,name,format);
+    } catch(const SCM_EXCEPT& scm_exception) {
+      EVENT_LOOP.running_task = outer_task, EVENT_LOOP.running_task_awaiting = outer_awaiting;
+      if(scm_exception == SCM_EXCEPT::EXIT) throw;
+      fail_async_operation(id,scm_exception == SCM_EXCEPT::JUMP ? "task jumped out of its coroutine"
+                                                                 : "task raised an error");
+      return;
+    }
+    auto awaiting = EVENT_LOOP.running_task_awaiting;
+    EVENT_LOOP.running_task = outer_task, EVENT_LOOP.running_task_awaiting = outer_awaiting;
+    fiber = stdlib_coroutines::get_coroutine_member(coroutine,"coroutine:private:fiber",name,format).fib.ptr;
+    if(fiber->state == coroutine_fiber::status::finished)
+      complete_async_operation(id,std::move(result));
+    else if(!awaiting)
+      EVENT_LOOP.ready_tasks.push_back(id);
+  }
+
+  /******************************************************************************
+  * RUNNING THE EVENT LOOP
+  ******************************************************************************/
+
+  bool event_loop_is_idle()noexcept{
+    return EVENT_LOOP.ready_tasks.empty() && EVENT_LOOP.timers.empty() && EVENT_LOOP.interests.empty();
+  }
+
+
+  // Runs a single iteration: resumes the ready tasks, then blocks for I/O & timers
+  //   (only polling if tasks were resumed, since they may have completed <until>)
+  void run_event_loop_iteration(const char* name, const char* format) {
+    bool resumed_tasks = !EVENT_LOOP.ready_tasks.empty();
+    for(auto n = EVENT_LOOP.ready_tasks.size(); n && !EVENT_LOOP.ready_tasks.empty(); --n) {
+      auto id = EVENT_LOOP.ready_tasks.front();
+      EVENT_LOOP.ready_tasks.pop_front();
+      resume_task(id,name,format);
+    }
+    int timeout_ms = -1;
+    if(resumed_tasks || !EVENT_LOOP.ready_tasks.empty()) {
+      timeout_ms = 0;
+    } else if(!EVENT_LOOP.timers.empty()) {
+      auto remaining = std::chrono::ceil<std::chrono::milliseconds>(EVENT_LOOP.timers.top().deadline-event_clock::now()).count();
+      timeout_ms = remaining < 0 ? 0 : remaining > INT_MAX ? INT_MAX : int(remaining);
+    }
+#ifndef HEIST_WINDOWS_FIBERS
+    if(!EVENT_LOOP.interests.empty() || timeout_ms > 0)
+      for(auto id : poll_ready_operations(timeout_ms)) progress_async_operation(id);
+#else
+    if(timeout_ms > 0) std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+#endif
+    auto now = event_clock::now();
+    while(!EVENT_LOOP.timers.empty() && EVENT_LOOP.timers.top().deadline <= now) {
+      auto id = EVENT_LOOP.timers.top().id;
+      EVENT_LOOP.timers.pop();
+      progress_async_operation(id);
+    }
+  }
+
+
+  // Runs the loop until <op> settles (<op> = nullptr: until no work remains)
+  void run_event_loop_until(data* op, const data_vector& args, const char* name, const char* format) {
+    while(!op || async_operation_is_pending(*op)) {
+      if(event_loop_is_idle()) {
+        if(!op) return;
+        auto& awaited = *op;
+        HEIST_THROW_ERR('\''<<name<<" async operation "<<HEIST_PROFILE(awaited)<<" can never complete:"
+          "\n     No tasks, I/O, nor timers remain pending in the event loop!"
+          << format << HEIST_FCN_ERR(name,args));
+      }
+      run_event_loop_iteration(name,format);
+    }
+  }
+
+
+  // Suspends the running task until <op> settles, returning whether did so
+  //   (false if the running fiber isn't the event loop's current task)
+  bool suspend_running_task_until_settled(data& op, const char* name, const char* format) {
+    auto fiber = coroutine_fiber::running();
+    if(!fiber || !EVENT_LOOP.running_task) return false;
+    auto task = EVENT_LOOP.pending.find(EVENT_LOOP.running_task);
+    if(task == EVENT_LOOP.pending.end() || get_task_fiber(task->second,name,format) != fiber) return false;
+    size_type op_id = (size_type)get_async_operation_member(op,"async-operation:private:id").num.extract_inexact();
+    auto awaited = EVENT_LOOP.pending.find(op_id);
+    if(awaited == EVENT_LOOP.pending.end()) return false;
+    awaited->second.waiters.push_back(EVENT_LOOP.running_task);
+    EVENT_LOOP.running_task_awaiting = true;
+    fiber->transfer = op;
+    stdlib_coroutines::suspend_coroutine(*fiber);
+    return true;
+  }
+
+  /******************************************************************************
+  * ARGUMENT VALIDATION
+  ******************************************************************************/
+
+  // Confirms the host supports asynchronous file descriptor I/O
+  void confirm_async_io_support(const data_vector& args, const char* name, const char* format) {
+#ifdef HEIST_WINDOWS_FIBERS
+    HEIST_THROW_ERR('\''<<name<<" asynchronous I/O isn't supported on Windows!"
+      << format << HEIST_FCN_ERR(name,args));
+#else
+    (void)args, (void)name, (void)format;
+#endif
+  }
+
+
+  data confirm_optional_port_arg(data_vector& args, const size_type idx, const bool input, const char* name, const char* format) {
+    if(args.size() > idx+1)
+      HEIST_THROW_ERR('\''<<name<<" received incorrect # of args!" << format << HEIST_FCN_ERR(name,args));
+    if(args.size() == idx) return input ? data(G.CURRENT_INPUT_PORT) : data(G.CURRENT_OUTPUT_PORT);
+    if(input ? !args[idx].is_type(types::fip) || !args[idx].fip.is_open()
+             : !args[idx].is_type(types::fop) || !args[idx].fop.is_open())
+      HEIST_THROW_ERR('\''<<name<<" arg "<<HEIST_PROFILE(args[idx])<<" isn't an open "
+        << (input ? "input" : "output") << " port!" << format << HEIST_FCN_ERR(name,args));
+    return args[idx];
+  }
+
+
+  int confirm_socket_listener(data& listener, const data_vector& args, const char* name, const char* format) {
+    if(!listener.is_type(types::obj) || listener.obj->proto->class_name != "socket-listener")
+      HEIST_THROW_ERR('\''<<name<<" arg "<<HEIST_PROFILE(listener)<<" isn't a socket-listener!"
+        << format << HEIST_FCN_ERR(name,args));
+    for(size_type i = 0, n = listener.obj->member_names().size(); i < n; ++i) {
+      if(listener.obj->member_names()[i] == "socket-listener:private:fd") {
+        auto& fd = listener.obj->member_values[i];
+        if(fd.is_type(types::num) && fd.num.is_integer() && !fd.num.is_neg())
+          return int(fd.num.extract_inexact());
+      }
+    }
+    HEIST_THROW_ERR('\''<<name<<" socket-listener "<<HEIST_PROFILE(listener)<<" is closed!"
+      << format << HEIST_FCN_ERR(name,args));
+    return -1; // never triggered
+  }
+
+
+  size_type confirm_port_number(const data& d, const data_vector& args, const char* name, const char* format) {
+    if(!d.is_type(types::num) || !d.num.is_integer() || d.num.is_neg() || d.num > num_type(65535))
+      HEIST_THROW_ERR('\''<<name<<" arg "<<HEIST_PROFILE(d)<<" isn't a port number (an integer in [0,65535])!"
+        << format << HEIST_FCN_ERR(name,args));
+    return (size_type)d.num.extract_inexact();
+  }
+
+} // End of namespace heist::stdlib_eventloop
+
+#endif
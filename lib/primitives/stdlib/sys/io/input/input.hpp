@@ -53,10 +53,11 @@ namespace heist {
     }
     string line_buffer;
     fflush(outs);
-    int ch = 0;
-    while((ch = fgetc(ins)) != '\n' && ch != EOF) line_buffer += ch;
-    if(ch == EOF && ins == stdin) clearerr(ins);
-    return make_str(line_buffer);
+    if(!read_line_from_file(ins,line_buffer)) {
+      if(ins == stdin) clearerr(ins);
+      if(line_buffer.empty()) return chr_type(EOF); // port was already exhausted
+    }
+    return make_str(std::move(line_buffer));
   }
 
   data primitive_READ_CHAR(data_vector&& args) {
@@ -150,10 +151,10 @@ namespace heist {
     if(reading_string) return make_str(*args[0].str);
     if(reading_stdin)  return make_str("");
     string buffer;
-    int ch = 0;
-    while((ch = fgetc(ins)) != EOF) buffer += ch; // slurp entire file
-    fclose(ins);
-    return make_str(buffer);
+    { source_buffer source(ins); buffer = source.text(); } // slurp entire file
+    if(args.empty()) G.CURRENT_INPUT_PORT.close(); // close via the port to prevent a double-free
+    else             args[0].fip.close();
+    return make_str(std::move(buffer));
   }
 
   // slurp a file's contents into a string
@@ -162,10 +163,9 @@ namespace heist {
     stdlib_input::confirm_given_one_string_arg(args,"slurp-file","\n     (slurp-file <filename-string>)");
     FILE* ins = stdlib_input::confirm_valid_input_file(args[0],"slurp-file","\n     (slurp-file <filename-string>)",args);
     string buffer;
-    int ch = 0;
-    while((ch = fgetc(ins)) != EOF) buffer += ch; // slurp entire file
+    { source_buffer source(ins); buffer = source.text(); } // slurp entire file
     fclose(ins);
-    return make_str(buffer);
+    return make_str(std::move(buffer));
   }
 
 } // End of namespace heist
@@ -54,7 +54,7 @@ namespace heist::stdlib_output {
     } else if(!obj.is_type(types::dne)) {
       fputs(obj.display().c_str(), outs);
     }
-    fflush(outs);
+    flush_unbuffered_console_port(outs);
     G.LAST_PRINTED_TO_STDOUT = (outs == stdout);
     return GLOBALS::VOID_DATA_OBJECT;
   }
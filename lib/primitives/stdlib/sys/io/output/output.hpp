@@ -20,7 +20,7 @@ namespace heist {
     if(!args[0].is_type(types::dne)) {
       if(is_port) {
         fputs(args[0].pprint().c_str(), outs);
-        fflush(outs);
+        flush_unbuffered_console_port(outs);
       } else {
         return make_str(*args[1].str + args[0].pprint());
       }
@@ -37,7 +37,7 @@ namespace heist {
     if(!args[0].is_type(types::dne)) {
       if(is_port) {
         fputs(args[0].write().c_str(), outs);
-        fflush(outs);
+        flush_unbuffered_console_port(outs);
       } else {
         return make_str(*args[1].str + args[0].write());
       }
@@ -53,7 +53,7 @@ namespace heist {
     bool is_port = stdlib_output::confirm_valid_output_args(args, outs, 0, "newline", format);
     if(is_port) {
       fputc('\n', outs);
-      fflush(outs);
+      flush_unbuffered_console_port(outs);
       G.LAST_PRINTED_NEWLINE_TO_STDOUT = G.LAST_PRINTED_TO_STDOUT = (outs == stdout);
     } else {
       return make_str(*args[0].str + '\n');
@@ -82,7 +82,7 @@ namespace heist {
         << format << HEIST_FCN_ERR("write-char", args));
     if(is_port) {
       fputc(args[0].chr, outs);
-      fflush(outs);
+      flush_unbuffered_console_port(outs);
       G.LAST_PRINTED_TO_STDOUT = (outs == stdout);
     } else {
       return make_str(*args[1].str + char(args[0].chr));
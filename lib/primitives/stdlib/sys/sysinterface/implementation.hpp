@@ -9,17 +9,49 @@
 namespace heist { void set_default_global_environment(); } // from "heist.cpp"
 
 
+namespace heist {
+  // From "lib/core/evaluator/dependancies/macro_expander.hpp"
+  bool expand_macro_if_in_env(const string& label,data_vector args, env_type& env,data_vector& expanded_exp);
+  // From "lib/core/evaluator/dependancies/cps/expander.hpp"
+  data_vector generate_fundamental_form_cps(const data& code,const bool topmost_call,const bool core_unexpanded);
+  // From "lib/core/evaluator/evaluator.hpp"
+  void account_for_automatically_passed_ID_continuation(data_vector& exp)noexcept;
+}
+
+
 namespace heist::stdlib_sysinterface {
 
   /******************************************************************************
   * GLOBAL PROCESS INVARIANTS RESET & SET ABSTRACTIONS
   ******************************************************************************/
 
-  // Saves the current <G> value, then resets it to its default values.
+  // Booted invariants (w/ a frozen global environment) shared by this thread's fresh
+  //   universes, rather than re-registering every primitive & re-evaluating the
+  //   Scheme stdlib per universe. Booted upon the 1st reset w/in each thread.
+  // => See "lib/core/type_system/scheme_types/environments/implementation.hpp"
+  thread_local process_invariants_t BOOTED_UNIVERSE_SNAPSHOT;
+
+
+  // PRECONDITION: G holds its default values
+  const process_invariants_t& get_booted_universe_snapshot() {
+    if(!BOOTED_UNIVERSE_SNAPSHOT.GLOBAL_ENVIRONMENT_POINTER) {
+      set_default_global_environment();
+      G.GLOBAL_ENVIRONMENT_POINTER->frozen = true;
+      BOOTED_UNIVERSE_SNAPSHOT = std::move(G);
+    }
+    return BOOTED_UNIVERSE_SNAPSHOT;
+  }
+
+
+  // Saves the current <G> value, then resets it to its default values
+  //   (layering a fresh global environment atop the booted snapshot's).
   process_invariants_t reset_process_invariant_state() {
     process_invariants_t tmp(std::move(G));
     G = process_invariants_t();
-    set_default_global_environment();
+    G = get_booted_universe_snapshot();
+    auto global_env = make_env();
+    global_env->parent = G.GLOBAL_ENVIRONMENT_POINTER;
+    G.GLOBAL_ENVIRONMENT_POINTER = std::move(global_env);
     return tmp;
   }
 
@@ -54,11 +86,14 @@ namespace heist::stdlib_sysinterface {
       HEIST_THROW_ERR("'load received incorrect # of arguments!" << format << HEIST_FCN_ERR("load", args));
     FILE* ins = confirm_valid_input_file(args[0],"load",format,args);
     FILE* outs = primitive_toolkit::get_current_output_port(args, "load", format);
-    size_type exp_count = 1;
-    while(!feof(ins)) {
+    source_buffer source(ins);
+    size_type exp_count = 1, pos = 0;
+    for(;;) {
       // Try reading & evaluating an expression
       try {
-        scm_eval(std::move(stdlib_input::read_from_port(outs,ins)[0]),env);
+        auto exp = stdlib_input::read_from_source(outs,source.text(),pos);
+        if(pos >= source.text().size() && exp.is_type(types::chr) && exp.chr == EOF) break;
+        scm_eval(std::move(exp),env);
         ++exp_count;
       // Catch, notify 'load' error occurred, & rethrow
       } catch(const SCM_EXCEPT& load_error) {
@@ -103,12 +138,13 @@ namespace heist::stdlib_sysinterface {
       HEIST_THROW_ERR("'cps-load received incorrect # of arguments!" << format << HEIST_FCN_ERR("cps-load", args));
     FILE* ins = confirm_valid_input_file(args[0],"cps-load",format,args);
     FILE* outs = primitive_toolkit::get_current_output_port(args, "cps-load", format);
-    size_type exp_count = 1;
+    source_buffer source(ins);
+    size_type exp_count = 1, pos = 0;
     data AST = data_vector();
-    while(!feof(ins)) {
+    while(pos < source.text().size()) {
       // Try reading & evaluating an expression
       try {
-        AST.exp.push_back(stdlib_input::read_from_port(outs,ins)[0]);
+        AST.exp.push_back(stdlib_input::read_from_source(outs,source.text(),pos));
         ++exp_count;
       // Catch, notify 'CPS-load' error occurred, & rethrow
       } catch(const SCM_EXCEPT& load_error) {
@@ -146,6 +182,7 @@ namespace heist::stdlib_sysinterface {
   // Recursively generate assignments to vectors as a precomputed AST
   //   => NOTE: The reader's generated AST _ONLY_ contains 1 of 5 types:
   //            types::exp, types::str, types::sym, types::chr, & types::num
+  //            (expansion & CPS conversion may also introduce types::bol)
   void print_vector_data_assignment(const data_vector& expressions, string& vector_assigns, 
                                     const string& assignment_chain)noexcept{
     for(size_type i = 0, n = expressions.size(); i < n; ++i) {
@@ -168,22 +205,160 @@ namespace heist::stdlib_sysinterface {
           vector_assigns += assignment_chain+'['+std::to_string(i)+"] = heist::chr_type('"+
             convert_char_to_cpp_literal(expressions[i].chr)+"');\n"; 
           break;
-        default:         // NUMBER
-          vector_assigns += assignment_chain+'['+std::to_string(i)+"] = heist::num_type("+
-            expressions[i].num.str()+");\n";
+        case types::bol: // BOOLEAN
+          vector_assigns += assignment_chain+'['+std::to_string(i)+"] = heist::GLOBALS::"+
+            (expressions[i].bol.val ? "TRUE" : "FALSE")+"_DATA_BOOLEAN;\n"; 
+          break;
+        default:         // NUMBER (parsed from text to preserve ratios, bignums, & infinities)
+          vector_assigns += assignment_chain+'['+std::to_string(i)+"] = heist::num_type(heist::string(\""+
+            expressions[i].num.str()+"\"));\n";
+      }
+    }
+  }
+
+
+  // Whether <d> only holds data that <print_vector_data_assignment> can generate
+  bool data_is_compilable_ast(const data& d)noexcept{
+    switch(d.type) {
+      case types::exp:
+        for(const auto& e : d.exp) if(!data_is_compilable_ast(e)) return false;
+        return true;
+      case types::str: case types::sym: case types::chr: case types::num: case types::bol: 
+        return true;
+      default: 
+        return false;
+    }
+  }
+
+  /******************************************************************************
+  * COMPILATION CORE-SYNTAX EXPANSION
+  ******************************************************************************/
+
+  bool label_is_registered(const string& label, const str_vector& registry)noexcept{
+    return std::find(registry.begin(),registry.end(),label) != registry.end();
+  }
+
+
+  // Special forms w/ operands that aren't expressions (left to be analyzed at run-time)
+  bool is_unexpandable_compilation_form(const string& label)noexcept{
+    return label == symconst::quote      || label == symconst::cps_quote   || 
+           label == symconst::defn_syn   || label == symconst::core_syn    || 
+           label == symconst::syn_rules  || label == symconst::defclass    || 
+           label == symconst::definedp   || label == symconst::delete_bang || 
+           label == symconst::infix      || label == symconst::infixr      || 
+           label == symconst::unfix      || label == symconst::using_cpsp  || 
+           label == symconst::vec_literal|| label == symconst::map_literal || 
+           label == symconst::defn_reader_alias;
+  }
+
+
+  // Collect the labels of macros (re)defined by the compiled file: these 
+  // are unknown (or bound differently) at compile-time, so their 
+  // applications are left to be expanded at run-time
+  void collect_compiled_macro_labels(const data& d, str_vector& labels)noexcept{
+    if(!d.is_type(types::exp)) return;
+    const auto& exp = d.exp;
+    if(exp.size() > 1 && exp[0].is_type(types::sym)) {
+      if((exp[0].sym == symconst::defn_syn || exp[0].sym == symconst::core_syn) && exp[1].is_type(types::sym)) {
+        labels.push_back(exp[1].sym);
+      } else if((exp[0].sym == "let-syntax" || exp[0].sym == "letrec-syntax") && exp[1].is_type(types::exp)) {
+        for(const auto& binding : exp[1].exp)
+          if(binding.is_type(types::exp) && !binding.exp.empty() && binding.exp[0].is_type(types::sym))
+            labels.push_back(binding.exp[0].sym);
       }
     }
+    for(const auto& e : exp) collect_compiled_macro_labels(e,labels);
   }
 
 
+  data expand_compilation_core_syntax(const data& d, const str_vector& runtime_macros);
+
+
+  // Expand the core-syntax of <exp>'s operands from index <start>
+  data expand_compilation_operands(const data_vector& exp, const size_type start, const str_vector& runtime_macros) {
+    data_vector expanded(exp);
+    for(size_type i = start, n = expanded.size(); i < n; ++i)
+      expanded[i] = expand_compilation_core_syntax(exp[i],runtime_macros);
+    return expanded;
+  }
+
+
+  // Expand <d>'s core-syntax (as the analyzer would) in the global environment
+  // => Only descends into operands known to be expressions
+  data expand_compilation_core_syntax(const data& d, const str_vector& runtime_macros) {
+    if(!d.is_type(types::exp) || d.exp.empty()) return d;
+    const auto& exp = d.exp;
+    if(exp[0].is_type(types::sym)) {
+      const auto& label = exp[0].sym;
+      if(is_unexpandable_compilation_form(label) || label_is_registered(label,runtime_macros)) return d;
+      // Analysis-time macro: expand iff the expansion can be written as an AST
+      if(label_is_registered(label,G.ANALYSIS_TIME_MACRO_LABEL_REGISTRY)) {
+        if(data_vector expanded; expand_macro_if_in_env(label,data_vector(exp.begin()+1,exp.end()),G.GLOBAL_ENVIRONMENT_POINTER,expanded)
+                                 && data_is_compilable_ast(expanded)) {
+          return expand_compilation_core_syntax(expanded,runtime_macros);
+        }
+        return d;
+      }
+      // Run-time macro: operands needn't be expressions
+      if(label_is_registered(label,G.MACRO_LABEL_REGISTRY)) return d;
+      // Skip parameter lists
+      if(label == symconst::lambda || (label == symconst::define && exp.size() > 1 && exp[1].is_type(types::exp)))
+        return expand_compilation_operands(exp,2,runtime_macros);
+      if(label == symconst::fn) {
+        data_vector expanded(exp);
+        for(size_type i = 1, n = expanded.size(); i < n; ++i)
+          if(expanded[i].is_type(types::exp) && !expanded[i].exp.empty())
+            expanded[i] = expand_compilation_operands(expanded[i].exp,1,runtime_macros);
+        return expanded;
+      }
+    }
+    return expand_compilation_operands(exp,0,runtime_macros);
+  }
+
+
+  // Expand the core-syntax of the read <expressions> wrt the default global environment
+  void expand_compiled_file_core_syntax(data_vector& expressions) {
+    str_vector runtime_macros;
+    for(const auto& e : expressions) collect_compiled_macro_labels(e,runtime_macros);
+    for(auto& e : expressions) e = expand_compilation_core_syntax(e,runtime_macros);
+  }
+
+
+  // Convert the read <expressions> into a single CPS procedure accepting <id>
+  //   => Mirrors <analyze_scm_cps> in <(scm->cps <expressions> ...)>
+  //   => Returns whether succeeded (else keep the <(scm->cps ...)> wrapper)
+  bool convert_compiled_file_to_cps(data_vector& expressions) {
+    if(expressions.empty()) return false;
+    data_vector cps_exp;
+    if(expressions.size() == 1) {
+      cps_exp = generate_fundamental_form_cps(expressions[0],true,true);
+    } else {
+      data_vector begin(1+expressions.size());
+      begin[0] = symconst::begin;
+      std::copy(expressions.begin(),expressions.end(),begin.begin()+1);
+      cps_exp = generate_fundamental_form_cps(begin,true,true);
+    }
+    account_for_automatically_passed_ID_continuation(cps_exp);
+    if(!data_is_compilable_ast(cps_exp)) return false;
+    expressions = data_vector(1,std::move(cps_exp));
+    return true;
+  }
+
+  /******************************************************************************
+  * COMPILATION
+  ******************************************************************************/
+
   void read_file_being_compiled(data_vector& args, data_vector& expressions, const char* name, const char* format){
     FILE* ins = confirm_valid_input_file(args[0],name,format,args);
     FILE* outs = primitive_toolkit::get_current_output_port(args, name, format);
-    size_type exp_count = 1;
-    while(!feof(ins)) {
+    source_buffer source(ins);
+    size_type exp_count = 1, pos = 0;
+    for(;;) {
       // Try reading an expression
       try {
-        expressions.push_back(stdlib_input::read_from_port(outs,ins)[0]);
+        auto exp = stdlib_input::read_from_source(outs,source.text(),pos);
+        if(pos >= source.text().size() && exp.is_type(types::chr) && exp.chr == EOF) break;
+        expressions.push_back(std::move(exp));
         ++exp_count;
       // Catch, notify 'compile' error occurred, & rethrow
       } catch(const SCM_EXCEPT& compile_error) {
@@ -194,22 +369,41 @@ namespace heist::stdlib_sysinterface {
         throw compile_error;
       }
     }
-    expressions.pop_back(); // rm EOF character (not part of the source code)
     if(ins) fclose(ins);
   }
 
 
-  string generate_precompiled_AST(data_vector& expressions)noexcept{
+  // Advance the run-time hash counters past those used by the compiled AST's
+  //   macro & CPS expansions (prevents run-time expansions reusing their names)
+  string generate_precompiled_hash_index_updates()noexcept{
+    string updates;
+    const auto print_update = [&](const char* idx_name, const size_type idx_1, const size_type idx_2){
+      const string idx_1_name = string("heist::G.")+idx_name+"_HASH_IDX_1";
+      const string idx_2_name = string("heist::G.")+idx_name+"_HASH_IDX_2";
+      updates += "if(std::make_pair("+idx_2_name+','+idx_1_name+") < std::make_pair(heist::size_type("+
+        std::to_string(idx_2)+"),heist::size_type("+std::to_string(idx_1)+"))) "+
+        idx_2_name+" = "+std::to_string(idx_2)+", "+idx_1_name+" = "+std::to_string(idx_1)+";\n";
+    };
+    print_update("GENSYM",G.GENSYM_HASH_IDX_1,G.GENSYM_HASH_IDX_2);
+    print_update("MACRO",G.MACRO_HASH_IDX_1,G.MACRO_HASH_IDX_2);
+    print_update("CPS",G.CPS_HASH_IDX_1,G.CPS_HASH_IDX_2);
+    print_update("CPS_VALUE",G.CPS_VALUE_HASH_IDX_1,G.CPS_VALUE_HASH_IDX_2);
+    return updates;
+  }
+
+
+  string generate_precompiled_AST(data_vector& expressions, const string& hash_index_updates)noexcept{
     // Generate Vector Assignments to explicitly lay out a predetermined AST
     string ast_generator = "heist::exp_type HEIST_PRECOMPILED_READ_AST_EXPS(" + 
                                 std::to_string(expressions.size()) + ");\n"
                                 "void POPULATE_HEIST_PRECOMPILED_READ_AST_EXPS(){\n";
     print_vector_data_assignment(expressions,ast_generator,"HEIST_PRECOMPILED_READ_AST_EXPS");
-    return ast_generator + "}\n";
+    return ast_generator + hash_index_updates + "}\n";
   }
 
 
-  data write_compiled_file(data_vector& args, const string& compiled_filename, const string& ast_generator, const char* name){
+  data write_compiled_file(data_vector& args, const string& compiled_filename, const string& ast_generator, 
+                           const bool precompiled_cps, const char* name){
     FILE* outs = fopen(compiled_filename.c_str(), "w");
     if(outs == nullptr)
       HEIST_THROW_ERR('\''<<name<<" file \"" << compiled_filename 
@@ -217,7 +411,7 @@ namespace heist::stdlib_sysinterface {
         << HEIST_FCN_ERR(name,args));
     fprintf(outs, "// Heist-Scheme Compiled Source from \"%s\""
                   "\n#include \"%s%clib%ccore%ctype_system%ctypes.hpp\""
-                  "\n#define HEIST_INTERPRETING_COMPILED_AST"
+                  "\n#define HEIST_INTERPRETING_COMPILED_AST%s"
                   "\n%s"
                   "\n#include \"%s%cheist.cpp\"\n", 
                   args[0].str->c_str(), 
@@ -225,6 +419,7 @@ namespace heist::stdlib_sysinterface {
                   char(std::filesystem::path::preferred_separator),
                   char(std::filesystem::path::preferred_separator),
                   char(std::filesystem::path::preferred_separator),
+                  precompiled_cps ? "\n#define HEIST_INTERPRETING_COMPILED_CPS_AST" : "",
                   ast_generator.c_str(), 
                   HEIST_DIRECTORY_FILE_PATH,char(std::filesystem::path::preferred_separator));
     if(outs) fclose(outs);
@@ -233,10 +428,33 @@ namespace heist::stdlib_sysinterface {
 
 
   // Generates a custom or default named compiled file as needed
-  data compile_dispatch(data_vector& args, data_vector& expressions, const char* name) {
+  data compile_dispatch(data_vector& args, data_vector& expressions, const string& hash_index_updates, 
+                        const bool precompiled_cps, const char* name) {
     if(args.size() == 2)
-      return write_compiled_file(args,*args[1].str,generate_precompiled_AST(expressions),name);
-    return write_compiled_file(args,symconst::dflt_compile_name,generate_precompiled_AST(expressions),name);
+      return write_compiled_file(args,*args[1].str,generate_precompiled_AST(expressions,hash_index_updates),precompiled_cps,name);
+    return write_compiled_file(args,symconst::dflt_compile_name,generate_precompiled_AST(expressions,hash_index_updates),precompiled_cps,name);
+  }
+
+
+  // Expand (& optionally CPS-convert) the read <expressions> in a fresh 
+  //   interpreter state (matching that of the compiled program at launch)
+  //   => Returns whether converted <expressions> to CPS
+  bool precompile_AST(data_vector& expressions, string& hash_index_updates, const bool cps_style) {
+    bool converted_to_cps = false;
+    auto old_invariants = reset_process_invariant_state();
+    try {
+      if(cps_style) {
+        converted_to_cps = convert_compiled_file_to_cps(expressions);
+      } else {
+        expand_compiled_file_core_syntax(expressions);
+      }
+      hash_index_updates = generate_precompiled_hash_index_updates();
+    } catch(const SCM_EXCEPT& compile_error) {
+      set_process_invariant_state(std::move(old_invariants));
+      throw compile_error;
+    }
+    set_process_invariant_state(std::move(old_invariants));
+    return converted_to_cps;
   }
 
 
@@ -251,6 +469,9 @@ namespace heist::stdlib_sysinterface {
         "\n     ("<<name<<" <filename-string> <optional-compiled-filename>)"<<HEIST_FCN_ERR(name,args));
     data_vector expressions;
     read_file_being_compiled(args,expressions,name,format);
+    string hash_index_updates;
+    if(precompile_AST(expressions,hash_index_updates,cps_style))
+      return compile_dispatch(args,expressions,hash_index_updates,true,name);
     if(cps_style) {
       data_vector wrapped_exps(1);
       wrapped_exps[0] = data_vector(2);
@@ -258,9 +479,9 @@ namespace heist::stdlib_sysinterface {
       wrapped_exps[0].exp[0].exp[0] = symconst::scm_cps;
       std::move(expressions.begin(),expressions.end(),wrapped_exps[0].exp[0].exp.begin()+1);
       wrapped_exps[0].exp[1] = "id";
-      return compile_dispatch(args,wrapped_exps,name);
+      return compile_dispatch(args,wrapped_exps,hash_index_updates,false,name);
     }
-    return compile_dispatch(args,expressions,name);
+    return compile_dispatch(args,expressions,hash_index_updates,false,name);
   }
 
   /******************************************************************************